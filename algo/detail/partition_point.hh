@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "snn-core/core.hh"
+#include <iterator> // iter_difference_t
+
+namespace snn::algo::detail
+{
+    // Branchless binary search, returns the index of the first element for which `pred` returns
+    // false (the range must be partitioned by `pred`).
+
+    // The loop always runs `ceil(log2(count))` times and the select compiles to a conditional
+    // move, so there are no mispredicted branches. For contiguous ranges both possible midpoints
+    // of the next iteration are prefetched.
+
+    template <typename RandomAccessIt, typename OneArgPred>
+    [[nodiscard]] constexpr usize partition_point(const RandomAccessIt first,
+                                                  const RandomAccessIt last, OneArgPred& pred)
+    {
+        using diff_t = std::iter_difference_t<RandomAccessIt>;
+
+        diff_t count = last - first;
+        if (count <= 0)
+        {
+            return 0;
+        }
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        RandomAccessIt base = first;
+        while (count > 1)
+        {
+            const diff_t half = count / 2;
+            count -= half;
+
+            if constexpr (std::is_pointer_v<RandomAccessIt>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const diff_t next_half = count / 2;
+                    __builtin_prefetch(base + next_half);
+                    __builtin_prefetch(base + half + next_half);
+                }
+            }
+
+            base = pred(base[half]) ? base + half : base;
+        }
+
+        const usize index = to_usize(base - first);
+        const bool after  = static_cast<bool>(pred(*base));
+
+        SNN_DIAGNOSTIC_POP
+
+        return index + static_cast<usize>(after);
+    }
+}
@@ -3,11 +3,14 @@
 
 // # Find value via binary search (upper bound)
 
+// Branchless binary search, contiguous ranges are prefetched. For large static tables see
+// `eytzinger.hh`.
+
 #pragma once
 
 #include "snn-core/optional_index.hh"
+#include "snn-core/algo/detail/partition_point.hh"
 #include "snn-core/fn/common.hh"
-#include <algorithm> // upper_bound
 
 namespace snn::algo
 {
@@ -21,12 +24,13 @@ namespace snn::algo
                                                              TwoArgPred is_less,
                                                              assume::is_sorted_t)
     {
-        const auto first = rng.begin();
-        const auto last  = rng.end();
-        const auto upper = std::upper_bound(first, last, value, std::move(is_less));
-        if (upper != last)
+        auto pred = [&value, &is_less](const auto& e) { return !is_less(value, e); };
+        const auto first  = rng.begin();
+        const auto last   = rng.end();
+        const usize index = detail::partition_point(first, last, pred);
+        if (index < to_usize(last - first))
         {
-            return optional_index{to_usize(upper - first), assume::within_bounds};
+            return optional_index{index, assume::within_bounds};
         }
         return constant::npos;
     }
@@ -4,6 +4,7 @@
 #include "snn-core/algo/find_greater_than.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
 
 namespace snn::app
 {
@@ -38,6 +39,34 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_find_greater_than()
+        {
+            // Every position for every count (branchless search), compared to a linear search.
+            vec<int> sorted;
+            for (usize count = 0; count <= 33; ++count)
+            {
+                for (int v = -1; v <= static_cast<int>(count) + 1; ++v)
+                {
+                    usize expected = 0;
+                    while (expected < count && sorted.at(expected, assume::within_bounds) <= v)
+                    {
+                        ++expected;
+                    }
+                    if (expected == count)
+                    {
+                        expected = constant::npos;
+                    }
+
+                    snn_require(algo::find_greater_than(sorted.range(), v, assume::is_sorted)
+                                    .value_or_npos() == expected);
+                }
+
+                sorted.append(static_cast<int>(count - (count % 2))); // Duplicates.
+            }
+
+            return true;
+        }
     }
 }
 
@@ -46,5 +75,6 @@ namespace snn
     void unittest()
     {
         snn_static_require(app::example());
+        snn_static_require(app::test_find_greater_than());
     }
 }
@@ -32,6 +32,7 @@
 #include "snn-core/mem/raw/copy.hh"
 #include "snn-core/mem/raw/fill.hh"
 #include "snn-core/mem/raw/find.hh"
+#include "snn-core/mem/raw/find_any_of.hh"
 #include "snn-core/mem/raw/find_in_reverse.hh"
 #include "snn-core/mem/raw/is_equal.hh"
 #include "snn-core/mem/raw/is_overlapping.hh"
@@ -1827,6 +1828,24 @@ namespace snn
             return constant::npos;
         }
 
+        // Find the first character that is any of the characters in `chars`.
+        [[nodiscard]] constexpr optional_index find_any_of(const transient<cstrview> chars,
+                                                           const usize start_pos = 0) const noexcept
+        {
+            const cstrview c = chars.get();
+            if (start_pos < count_ && c)
+            {
+                const char* const p = mem::raw::find_any_of(not_null{data_ + start_pos},
+                                                            snn::byte_size{count_ - start_pos},
+                                                            c.data(), c.byte_size());
+                if (p != nullptr)
+                {
+                    return optional_index{to_usize(p - data_), assume::within_bounds};
+                }
+            }
+            return constant::npos;
+        }
+
         [[nodiscard]] constexpr optional_index find_in_reverse(
             const same_as<char> auto c, const usize start_pos = constant::npos) const noexcept
         {
@@ -7,6 +7,7 @@
 
 #include "snn-core/array_view.hh"
 #include "snn-core/algo/contains.hh"
+#include "snn-core/ascii/detail/simd.hh"
 #include "snn-core/ascii/fn/equal_to_icase.hh"
 #include "snn-core/range/contiguous.hh"
 
@@ -19,7 +20,13 @@ namespace snn::ascii
     [[nodiscard]] constexpr bool contains_icase(const transient<cstrview> subject,
                                                 const transient<cstrview> needle) noexcept
     {
-        return algo::contains(subject.get().range(), needle.get().range(),
-                              ascii::fn::equal_to_icase{});
+        cstrview s       = subject.get();
+        const cstrview n = needle.get();
+        if (!std::is_constant_evaluated())
+        {
+            // No match before this position.
+            s.drop_front_n(detail::simd::find_icase(s.begin(), s.size(), n.begin(), n.size()));
+        }
+        return algo::contains(s.range(), n.range(), ascii::fn::equal_to_icase{});
     }
 }
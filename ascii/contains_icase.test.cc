@@ -4,6 +4,9 @@
 #include "snn-core/ascii/contains_icase.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/ascii/upper.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -38,6 +41,52 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_contains_icase_simd()
+        {
+            // Needles of different sizes at every position.
+            random::wyrand rng{999};
+            for (usize size = 0; size < 120; ++size)
+            {
+                const str subject{init::fill, size, 'a'};
+                const array<cstrview, 6> needles{"b",
+                                                 "bC",
+                                                 "aBa",
+                                                 "xyzzy",
+                                                 "bAAAAAAAAAAAAAAAAAb",
+                                                 "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"};
+                for (const cstrview needle : needles)
+                {
+                    if (needle.size() > size)
+                    {
+                        snn_require(!ascii::contains_icase(subject, needle));
+                        continue;
+                    }
+
+                    for (usize pos = 0; pos <= (size - needle.size()); ++pos)
+                    {
+                        str s = subject;
+                        s.replace_at(pos, needle.size(), ascii::upper(needle));
+                        snn_require(ascii::contains_icase(s, needle));
+                        snn_require(ascii::contains_icase(s, ascii::upper(needle)));
+
+                        // Only the last character differs.
+                        const cstrview almost = needle.view(0, needle.size() - 1);
+                        snn_require(!ascii::contains_icase(subject, concat(almost, '!')) ||
+                                    needle.size() == 1);
+                    }
+                }
+
+                // Random subject, random needle from the subject.
+                const str random_subject = random::string(size, rng);
+                for (usize pos = 0; pos < size; pos += 7)
+                {
+                    const cstrview n = random_subject.view(pos, 9);
+                    snn_require(ascii::contains_icase(random_subject, ascii::upper(n)));
+                }
+            }
+            return true;
+        }
     }
 }
 
@@ -46,5 +95,6 @@ namespace snn
     void unittest()
     {
         snn_static_require(app::example());
+        snn_require(app::test_contains_icase_simd());
     }
 }
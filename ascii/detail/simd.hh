@@ -0,0 +1,256 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # SIMD case conversion and case-insensitive comparison kernels (SSE2/AVX2)
+
+// Only full chunks of 16 (SSE2) or 32 (AVX2) characters are processed, the caller continues with
+// the scalar code from the returned position. The functions return 0 if SSE2 is not enabled at
+// compile time.
+
+#pragma once
+
+#include "snn-core/chr/common.hh"
+#include <bit> // countr_zero
+#if SNN_SSE2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::ascii::detail::simd
+{
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+#if SNN_SSE2_ENABLED
+    namespace sse
+    {
+        inline __m128i load(const char* const data) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        }
+
+        // All bytes in the range [First, First + 25] (e.g. 'A'-'Z'), signed comparison after
+        // moving the range to the bottom (-128).
+        template <char First>
+        inline __m128i is_alpha(const __m128i in) noexcept
+        {
+            const __m128i shifted =
+                _mm_add_epi8(in, _mm_set1_epi8(static_cast<char>(0x80 - First)));
+            return _mm_cmpgt_epi8(_mm_set1_epi8(-128 + 26), shifted);
+        }
+
+        inline __m128i lower(const __m128i in) noexcept
+        {
+            return _mm_or_si128(in, _mm_and_si128(is_alpha<'A'>(in), _mm_set1_epi8(0x20)));
+        }
+
+        inline __m128i upper(const __m128i in) noexcept
+        {
+            return _mm_xor_si128(in, _mm_and_si128(is_alpha<'a'>(in), _mm_set1_epi8(0x20)));
+        }
+    }
+#endif
+
+#if SNN_AVX2_ENABLED
+    namespace avx
+    {
+        inline __m256i load(const char* const data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template <char First>
+        inline __m256i is_alpha(const __m256i in) noexcept
+        {
+            const __m256i shifted =
+                _mm256_add_epi8(in, _mm256_set1_epi8(static_cast<char>(0x80 - First)));
+            return _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), shifted);
+        }
+
+        inline __m256i lower(const __m256i in) noexcept
+        {
+            return _mm256_or_si256(in,
+                                   _mm256_and_si256(is_alpha<'A'>(in), _mm256_set1_epi8(0x20)));
+        }
+
+        inline __m256i upper(const __m256i in) noexcept
+        {
+            return _mm256_xor_si256(in,
+                                    _mm256_and_si256(is_alpha<'a'>(in), _mm256_set1_epi8(0x20)));
+        }
+    }
+#endif
+
+    // ## Functions
+
+    // ### lower_inplace/upper_inplace
+
+    // Returns the number of characters converted.
+
+    template <bool Lower>
+    inline usize convert_inplace(char* const data, const usize size) noexcept
+    {
+        usize pos = 0;
+
+#if SNN_AVX2_ENABLED
+        while ((size - pos) >= 32)
+        {
+            const __m256i in  = avx::load(data + pos);
+            const __m256i out = Lower ? avx::lower(in) : avx::upper(in);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + pos), out);
+            pos += 32;
+        }
+#endif
+
+#if SNN_SSE2_ENABLED
+        while ((size - pos) >= 16)
+        {
+            const __m128i in  = sse::load(data + pos);
+            const __m128i out = Lower ? sse::lower(in) : sse::upper(in);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data + pos), out);
+            pos += 16;
+        }
+#endif
+
+        ignore_if_unused(data, size);
+        return pos;
+    }
+
+    inline usize lower_inplace(char* const data, const usize size) noexcept
+    {
+        return convert_inplace<true>(data, size);
+    }
+
+    inline usize upper_inplace(char* const data, const usize size) noexcept
+    {
+        return convert_inplace<false>(data, size);
+    }
+
+    // ### is_equal_icase
+
+    // Returns the number of leading characters that are equal ignoring case (stops at the first
+    // difference or before the last partial chunk).
+
+    inline usize is_equal_icase(const char* const a, const char* const b, const usize size) noexcept
+    {
+        usize pos = 0;
+
+#if SNN_AVX2_ENABLED
+        while ((size - pos) >= 32)
+        {
+            const __m256i eq =
+                _mm256_cmpeq_epi8(avx::lower(avx::load(a + pos)), avx::lower(avx::load(b + pos)));
+            const u32 mask = static_cast<u32>(_mm256_movemask_epi8(eq));
+            if (mask != 0xffff'ffff)
+            {
+                return pos + static_cast<usize>(std::countr_zero(~mask));
+            }
+            pos += 32;
+        }
+#endif
+
+#if SNN_SSE2_ENABLED
+        while ((size - pos) >= 16)
+        {
+            const __m128i eq =
+                _mm_cmpeq_epi8(sse::lower(sse::load(a + pos)), sse::lower(sse::load(b + pos)));
+            const u32 mask = static_cast<u32>(_mm_movemask_epi8(eq));
+            if (mask != 0xffff)
+            {
+                return pos + static_cast<usize>(std::countr_zero(~mask));
+            }
+            pos += 16;
+        }
+#endif
+
+        ignore_if_unused(a, b, size);
+        return pos;
+    }
+
+    // ### find_icase
+
+    // Returns a position before which the needle can not be found ignoring case, this is the
+    // position of the first match if a match is found.
+
+    // Candidates are found by comparing the first and the last character of the needle (ignoring
+    // case) with 16 or 32 positions at a time, only candidates are compared in full.
+
+    inline usize find_icase(const char* const subject, const usize subject_size,
+                            const char* const needle, const usize needle_size) noexcept
+    {
+        usize pos = 0;
+
+#if SNN_SSE2_ENABLED
+        if (needle_size == 0 || needle_size > subject_size)
+        {
+            return 0;
+        }
+
+        const usize last_offset = needle_size - 1;
+        const char first_lower  = chr::to_alpha_lower(needle[0]);
+        const char last_lower   = chr::to_alpha_lower(needle[last_offset]);
+
+        // The first and the last character have already been compared.
+        const auto is_match = [&](const usize candidate) noexcept {
+            for (usize i = 1; i < last_offset; ++i)
+            {
+                if (chr::to_alpha_lower(subject[candidate + i]) != chr::to_alpha_lower(needle[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+    #if SNN_AVX2_ENABLED
+        {
+            const __m256i first = _mm256_set1_epi8(first_lower);
+            const __m256i last  = _mm256_set1_epi8(last_lower);
+            while ((subject_size - last_offset - pos) >= 32)
+            {
+                const __m256i a = avx::lower(avx::load(subject + pos));
+                const __m256i b = avx::lower(avx::load(subject + pos + last_offset));
+                u32 mask        = static_cast<u32>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+                while (mask != 0)
+                {
+                    const usize candidate = pos + static_cast<usize>(std::countr_zero(mask));
+                    if (is_match(candidate))
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1; // Clear lowest set bit.
+                }
+                pos += 32;
+            }
+        }
+    #endif
+
+        {
+            const __m128i first = _mm_set1_epi8(first_lower);
+            const __m128i last  = _mm_set1_epi8(last_lower);
+            while ((subject_size - last_offset - pos) >= 16)
+            {
+                const __m128i a = sse::lower(sse::load(subject + pos));
+                const __m128i b = sse::lower(sse::load(subject + pos + last_offset));
+                u32 mask        = static_cast<u32>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+                while (mask != 0)
+                {
+                    const usize candidate = pos + static_cast<usize>(std::countr_zero(mask));
+                    if (is_match(candidate))
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1; // Clear lowest set bit.
+                }
+                pos += 16;
+            }
+        }
+#endif
+
+        ignore_if_unused(subject, subject_size, needle, needle_size);
+        return pos;
+    }
+
+    SNN_DIAGNOSTIC_POP
+}
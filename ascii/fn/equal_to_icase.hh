@@ -7,6 +7,7 @@
 
 #include "snn-core/array_view.hh"
 #include "snn-core/algo/is_equal.hh"
+#include "snn-core/ascii/detail/simd.hh"
 #include "snn-core/chr/common.hh"
 #include "snn-core/range/contiguous.hh"
 
@@ -28,7 +29,16 @@ namespace snn::ascii::fn
         [[nodiscard]] constexpr bool operator()(const transient<cstrview> a,
                                                 const transient<cstrview> b) const noexcept
         {
-            return algo::is_equal(a.get().range(), b.get().range(), equal_to_icase{});
+            cstrview x = a.get();
+            cstrview y = b.get();
+            if (!std::is_constant_evaluated() && x.size() == y.size())
+            {
+                const usize equal_count = detail::simd::is_equal_icase(x.begin(), y.begin(),
+                                                                       x.size());
+                x.drop_front_n(equal_count);
+                y.drop_front_n(equal_count);
+            }
+            return algo::is_equal(x.range(), y.range(), equal_to_icase{});
         }
     };
 
@@ -4,6 +4,10 @@
 #include "snn-core/ascii/is_equal_icase.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/ascii/lower.hh"
+#include "snn-core/ascii/upper.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -40,6 +44,44 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_is_equal_icase_simd()
+        {
+            random::wyrand rng{888};
+            for (usize size = 0; size < 200; ++size)
+            {
+                const str s     = random::string(size, rng);
+                const str lower = ascii::lower(s);
+                const str upper = ascii::upper(s);
+                snn_require(ascii::is_equal_icase(s, lower));
+                snn_require(ascii::is_equal_icase(upper, s));
+                snn_require(ascii::is_equal_icase(lower, upper));
+
+                // A difference at every position.
+                for (usize pos = 0; pos < size; ++pos)
+                {
+                    str other = upper;
+                    char& c   = other.at(pos, assume::within_bounds);
+                    c         = (c == '!') ? '#' : '!';
+                    if (chr::to_alpha_lower(c) != chr::to_alpha_lower(s.at(pos).value()))
+                    {
+                        snn_require(!ascii::is_equal_icase(s, other));
+                        snn_require(!ascii::is_equal_icase(other, lower));
+                    }
+
+                    str alpha = lower;
+                    char& a   = alpha.at(pos, assume::within_bounds);
+                    if (chr::is_alpha(a))
+                    {
+                        // '@' (0x40) and '`' (0x60) are one below 'A' and 'a', '[' and '{' are one
+                        // above 'Z' and 'z'.
+                        a = (a == 'a' || a == 'A') ? '`' : '{';
+                        snn_require(!ascii::is_equal_icase(s, alpha));
+                    }
+                }
+            }
+            return true;
+        }
     }
 }
 
@@ -48,5 +90,6 @@ namespace snn
     void unittest()
     {
         snn_static_require(app::example());
+        snn_require(app::test_is_equal_icase_simd());
     }
 }
@@ -6,12 +6,30 @@
 #pragma once
 
 #include "snn-core/strcore.hh"
+#include "snn-core/ascii/detail/simd.hh"
 #include "snn-core/chr/common.hh"
 
 namespace snn::ascii
 {
     // ## Functions
 
+    // ### lower_inplace
+
+    constexpr void lower_inplace(strview s) noexcept
+    {
+        if (!std::is_constant_evaluated())
+        {
+            s.drop_front_n(detail::simd::lower_inplace(s.begin(), s.size()));
+        }
+        s.transform(chr::to_alpha_lower);
+    }
+
+    template <typename Buf>
+    constexpr void lower_inplace(strcore<Buf>& s) noexcept
+    {
+        lower_inplace(s.view());
+    }
+
     // ### lower
 
     template <typename Buf>
@@ -20,7 +38,7 @@ namespace snn::ascii
         // Can overlap.
         const usize offset = append_to.size();
         append_to.append(s.get());
-        append_to.view(offset).transform(chr::to_alpha_lower);
+        lower_inplace(append_to.view(offset));
     }
 
     template <any_strcore Str = str>
@@ -4,6 +4,8 @@
 #include "snn-core/ascii/lower.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 #include "snn-core/range/integral.hh"
 
 namespace snn::app
@@ -85,6 +87,39 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_lower_inplace()
+        {
+            str s{"aBcDEF123Åäö"};
+            ascii::lower_inplace(s);
+            snn_require(s == ascii::lower("aBcDEF123Åäö"));
+
+            str t{"aBcDEF123Åäö"};
+            ascii::lower_inplace(t.view(1, 3));
+            snn_require(t == concat("a", ascii::lower("BcD"), "EF123Åäö"));
+
+            return true;
+        }
+
+        bool test_lower_simd()
+        {
+            // Compare with per-character conversion, all chunk/tail sizes.
+            random::wyrand rng{555};
+            for (usize size = 0; size < 200; ++size)
+            {
+                const str s = random::string(size, rng);
+
+                str expected = s;
+                expected.transform(chr::to_alpha_lower);
+
+                snn_require(ascii::lower(s) == expected);
+
+                str inplace = s;
+                ascii::lower_inplace(inplace);
+                snn_require(inplace == expected);
+            }
+            return true;
+        }
     }
 }
 
@@ -94,5 +129,7 @@ namespace snn
     {
         snn_static_require(app::example());
         snn_static_require(app::test_lower());
+        snn_static_require(app::test_lower_inplace());
+        snn_require(app::test_lower_simd());
     }
 }
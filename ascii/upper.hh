@@ -6,12 +6,30 @@
 #pragma once
 
 #include "snn-core/strcore.hh"
+#include "snn-core/ascii/detail/simd.hh"
 #include "snn-core/chr/common.hh"
 
 namespace snn::ascii
 {
     // ## Functions
 
+    // ### upper_inplace
+
+    constexpr void upper_inplace(strview s) noexcept
+    {
+        if (!std::is_constant_evaluated())
+        {
+            s.drop_front_n(detail::simd::upper_inplace(s.begin(), s.size()));
+        }
+        s.transform(chr::to_alpha_upper);
+    }
+
+    template <typename Buf>
+    constexpr void upper_inplace(strcore<Buf>& s) noexcept
+    {
+        upper_inplace(s.view());
+    }
+
     // ### upper
 
     template <typename Buf>
@@ -20,7 +38,7 @@ namespace snn::ascii
         // Can overlap.
         const usize offset = append_to.size();
         append_to.append(s.get());
-        append_to.view(offset).transform(chr::to_alpha_upper);
+        upper_inplace(append_to.view(offset));
     }
 
     template <any_strcore Str = str>
@@ -4,6 +4,8 @@
 #include "snn-core/ascii/upper.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 #include "snn-core/range/integral.hh"
 
 namespace snn::app
@@ -85,6 +87,39 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_upper_inplace()
+        {
+            str s{"aBcDEF123Åäö"};
+            ascii::upper_inplace(s);
+            snn_require(s == ascii::upper("aBcDEF123Åäö"));
+
+            str t{"aBcDEF123Åäö"};
+            ascii::upper_inplace(t.view(1, 3));
+            snn_require(t == concat("a", ascii::upper("BcD"), "EF123Åäö"));
+
+            return true;
+        }
+
+        bool test_upper_simd()
+        {
+            // Compare with per-character conversion, all chunk/tail sizes.
+            random::wyrand rng{777};
+            for (usize size = 0; size < 200; ++size)
+            {
+                const str s = random::string(size, rng);
+
+                str expected = s;
+                expected.transform(chr::to_alpha_upper);
+
+                snn_require(ascii::upper(s) == expected);
+
+                str inplace = s;
+                ascii::upper_inplace(inplace);
+                snn_require(inplace == expected);
+            }
+            return true;
+        }
     }
 }
 
@@ -94,5 +129,7 @@ namespace snn
     {
         snn_static_require(app::example());
         snn_static_require(app::test_upper());
+        snn_static_require(app::test_upper_inplace());
+        snn_require(app::test_upper_simd());
     }
 }
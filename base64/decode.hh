@@ -9,6 +9,7 @@
 #include "snn-core/result.hh"
 #include "snn-core/strcore.hh"
 #include "snn-core/base64/error.hh"
+#include "snn-core/base64/detail/simd.hh"
 #include "snn-core/base64/table/decode/common.hh"
 
 namespace snn::base64
@@ -72,7 +73,22 @@ namespace snn::base64
                 strview buffer = append_to.append_for_overwrite(unpadded_block_count * 3);
                 auto dst       = buffer.begin();
 
-                do
+                // SIMD for the standard and URL tables (only at runtime).
+                if (!std::is_constant_evaluated())
+                {
+                    if (&lookup == &table::decode::standard || &lookup == &table::decode::url)
+                    {
+                        const auto a            = (&lookup == &table::decode::standard)
+                                                      ? simd::alphabet::standard
+                                                      : simd::alphabet::url;
+                        const usize block_count = simd::decode(cur, unpadded_block_count, dst, a);
+                        cur += block_count * 4;
+                        dst += block_count * 3;
+                        unpadded_block_count -= block_count;
+                    }
+                }
+
+                while (unpadded_block_count > 0)
                 {
                     // Look up Base64 values for each byte in the block.
                     const u8 val1 = lookup.at(to_byte(*(cur++)), assume::within_bounds);
@@ -94,7 +110,7 @@ namespace snn::base64
                     *(dst++) = static_cast<char>((val3 << 6u) | val4);
 
                     --unpadded_block_count;
-                } while (unpadded_block_count > 0);
+                }
 
                 snn_should(dst == buffer.end());
             }
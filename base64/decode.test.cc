@@ -4,6 +4,10 @@
 #include "snn-core/base64/decode.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/base64/url/decode.hh"
+#include "snn-core/base64/url/encode.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -116,6 +120,65 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_decode_simd()
+        {
+            // The SIMD path is only used with the standard and URL tables (by address), a copy of
+            // a table always uses the scalar path.
+            const array<u8, 256> standard_copy = base64::table::decode::standard;
+
+            random::wyrand rng{64};
+            for (usize size = 0; size < 300; ++size)
+            {
+                const str data = random::string(size, rng);
+
+                const str standard = base64::encode(data);
+                snn_require(base64::decode(standard).value() == data);
+
+                const str url = base64::url::encode(data);
+                snn_require(base64::url::decode(url).value() == data);
+            }
+
+            // Every invalid byte at every position.
+            const str data    = random::string(150, rng);
+            const str encoded = base64::encode(data); // 200 characters, no padding.
+            snn_require(encoded.size() == 200);
+            snn_require(!encoded.contains('='));
+            for (usize pos = 0; pos < encoded.size(); pos += 7)
+            {
+                for (usize b = 0; b < 256; ++b)
+                {
+                    const auto c = static_cast<char>(b);
+                    str s        = encoded;
+                    s.at(pos, assume::within_bounds) = c;
+
+                    const auto simd   = base64::decode(s);
+                    const auto scalar =
+                        base64::decode(s, base64::padding_required, '=', standard_copy);
+                    snn_require(simd.has_value() == scalar.has_value());
+                    if (simd)
+                    {
+                        snn_require(simd.value() == scalar.value());
+                    }
+                    else
+                    {
+                        snn_require(simd.error_code() == base64::error::invalid_character);
+                        snn_require(scalar.error_code() == base64::error::invalid_character);
+                    }
+                }
+            }
+
+            {
+                // Error with append, the string is restored.
+                str s = encoded;
+                s.at(150, assume::within_bounds) = '*';
+                str append_to{"abc"};
+                snn_require(!base64::decode(s, append_to, assume::no_overlap));
+                snn_require(append_to == "abc");
+            }
+
+            return true;
+        }
     }
 }
 
@@ -124,5 +187,7 @@ namespace snn
     void unittest()
     {
         snn_static_require(app::example());
+        snn_require(app::test_decode_simd());
+
     }
 }
@@ -0,0 +1,278 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # SIMD encode/decode kernels (SSSE3/AVX2)
+
+// Based on "Faster Base64 Encoding and Decoding Using AVX2 Instructions" by Wojciech Muła and
+// Daniel Lemire (https://arxiv.org/abs/1704.00605).
+
+// Only full blocks are processed, the caller handles the rest (and any padding) with the scalar
+// code. The functions return 0 if neither SSSE3 nor AVX2 is enabled at compile time.
+
+#pragma once
+
+#include "snn-core/core.hh"
+#if SNN_SSSE3_ENABLED || SNN_AVX2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::base64::detail::simd
+{
+    // ## Enums
+
+    // ### alphabet
+
+    enum class alphabet : u8
+    {
+        standard,
+        url,
+    };
+
+    // ## Functions
+
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+#if SNN_SSSE3_ENABLED
+    namespace sse
+    {
+        inline __m128i encode_lookup(const alphabet a) noexcept
+        {
+            // Offsets added to each 6-bit value, indexed by a reduced value (see `encode_block`).
+            const char plus  = (a == alphabet::standard) ? '+' : '-';
+            const char slash = (a == alphabet::standard) ? '/' : '_';
+            return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                 '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                 static_cast<char>(plus - 62), static_cast<char>(slash - 63), 'A',
+                                 0, 0);
+        }
+
+        // 12 bytes (loads 16) to 16 characters.
+        inline __m128i encode_block(__m128i in, const __m128i lookup) noexcept
+        {
+            // Spread 3 bytes over 4 bytes (in each 32-bit lane) and extract the 6-bit values.
+            in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11,
+                                                    10));
+            const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+            const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+            const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+            const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+            const __m128i indices = _mm_or_si128(t1, t3);
+
+            // Map 0..25 to 13, 26..51 to 0, 52..61 to 1..10, 62 to 11 and 63 to 12.
+            __m128i reduced   = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            const __m128i lt  = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+            reduced           = _mm_or_si128(reduced, _mm_and_si128(lt, _mm_set1_epi8(13)));
+            const __m128i add = _mm_shuffle_epi8(lookup, reduced);
+            return _mm_add_epi8(indices, add);
+        }
+
+        struct decode_lookup final
+        {
+            __m128i lo;
+            __m128i hi;
+            __m128i roll;
+            __m128i special; // The only character that needs its own roll offset.
+        };
+
+        inline decode_lookup make_decode_lookup(const alphabet a) noexcept
+        {
+            // A character is valid if `lo[low_nibble] & hi[high_nibble]` is zero.
+            if (a == alphabet::standard)
+            {
+                return decode_lookup{
+                    _mm_setr_epi8(0x13, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+                                  0x07, 0x0d, 0x0f, 0x0f, 0x0f, 0x0d),
+                    _mm_setr_epi8(0x01, 0x01, 0x02, 0x04, 0x10, 0x08, 0x10, 0x08, 0x01, 0x01,
+                                  0x01, 0x01, 0x01, 0x01, 0x01, 0x01),
+                    _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 16, 0, 0, 0, 0, 0),
+                    _mm_set1_epi8('/'),
+                };
+            }
+
+            return decode_lookup{
+                _mm_setr_epi8(0x23, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07,
+                              0x1f, 0x1f, 0x1d, 0x1f, 0x0f),
+                _mm_setr_epi8(0x01, 0x01, 0x02, 0x04, 0x20, 0x10, 0x20, 0x08, 0x01, 0x01, 0x01,
+                              0x01, 0x01, 0x01, 0x01, 0x01),
+                _mm_setr_epi8(0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, -32, 0, 0),
+                _mm_set1_epi8('_'),
+            };
+        }
+
+        // 16 characters to 12 bytes (in the low 12 bytes), returns false if any character is
+        // invalid.
+        inline bool decode_block(const __m128i in, const decode_lookup& lookup,
+                                 __m128i& out) noexcept
+        {
+            const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+            const __m128i hi_nibbles  = _mm_and_si128(_mm_srli_epi32(in, 4), nibble_mask);
+            const __m128i lo_nibbles  = _mm_and_si128(in, nibble_mask);
+            const __m128i lo          = _mm_shuffle_epi8(lookup.lo, lo_nibbles);
+            const __m128i hi          = _mm_shuffle_epi8(lookup.hi, hi_nibbles);
+
+            const __m128i invalid = _mm_and_si128(lo, hi);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xffff)
+            {
+                return false;
+            }
+
+            // Select roll offset by high nibble (or 8 + high nibble for the special character).
+            const __m128i is_special = _mm_cmpeq_epi8(in, lookup.special);
+            const __m128i index =
+                _mm_or_si128(hi_nibbles, _mm_and_si128(is_special, _mm_set1_epi8(8)));
+            const __m128i values = _mm_add_epi8(in, _mm_shuffle_epi8(lookup.roll, index));
+
+            // Pack 4 x 6-bit values to 3 bytes (in each 32-bit lane).
+            const __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+            out = _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                                         -1, -1, -1, -1));
+            return true;
+        }
+    }
+#endif
+
+    // ### encode
+
+    // Encode blocks of 3 bytes, returns the number of bytes encoded (a multiple of 3).
+    // Reads up to 4 bytes past the last encoded byte (but never past `size`).
+
+    inline usize encode(const char* const src, const usize size, char* const dst,
+                        const alphabet a) noexcept
+    {
+        usize src_pos = 0;
+        usize dst_pos = 0;
+
+#if SNN_AVX2_ENABLED
+        {
+            const __m256i lookup = _mm256_broadcastsi128_si256(sse::encode_lookup(a));
+            while ((size - src_pos) >= 28)
+            {
+                const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + src_pos));
+                const __m128i hi =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + src_pos + 12));
+                __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+                in = _mm256_shuffle_epi8(
+                    in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2,
+                                         1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+                const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+                const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+                const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+                const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+                const __m256i indices = _mm256_or_si256(t1, t3);
+
+                __m256i reduced  = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+                const __m256i lt = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+                reduced = _mm256_or_si256(reduced, _mm256_and_si256(lt, _mm256_set1_epi8(13)));
+                const __m256i out =
+                    _mm256_add_epi8(indices, _mm256_shuffle_epi8(lookup, reduced));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + dst_pos), out);
+                src_pos += 24;
+                dst_pos += 32;
+            }
+        }
+#endif
+
+#if SNN_SSSE3_ENABLED
+        {
+            const __m128i lookup = sse::encode_lookup(a);
+            while ((size - src_pos) >= 16)
+            {
+                const __m128i in =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + src_pos));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + dst_pos),
+                                 sse::encode_block(in, lookup));
+                src_pos += 12;
+                dst_pos += 16;
+            }
+        }
+#endif
+
+        ignore_if_unused(src, size, dst, a, dst_pos);
+        return src_pos;
+    }
+
+    // ### decode
+
+    // Decode blocks of 4 characters (without padding), returns the number of blocks decoded.
+    // Stops before any chunk with an invalid character (the scalar code reports the error).
+    // Never writes past `block_count * 3` bytes.
+
+    inline usize decode(const char* const src, const usize block_count, char* const dst,
+                        const alphabet a) noexcept
+    {
+        usize block_pos = 0;
+
+#if SNN_SSSE3_ENABLED
+        const sse::decode_lookup lookup = sse::make_decode_lookup(a);
+#endif
+
+#if SNN_AVX2_ENABLED
+        {
+            const __m256i lo_lookup   = _mm256_broadcastsi128_si256(lookup.lo);
+            const __m256i hi_lookup   = _mm256_broadcastsi128_si256(lookup.hi);
+            const __m256i roll_lookup = _mm256_broadcastsi128_si256(lookup.roll);
+            const __m256i special     = _mm256_broadcastsi128_si256(lookup.special);
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+
+            // 8 blocks per iteration, the store writes 32 bytes (24 used).
+            while ((block_count - block_pos) >= 11)
+            {
+                const __m256i in =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + (block_pos * 4)));
+
+                const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), nibble_mask);
+                const __m256i lo_nibbles = _mm256_and_si256(in, nibble_mask);
+                const __m256i lo         = _mm256_shuffle_epi8(lo_lookup, lo_nibbles);
+                const __m256i hi         = _mm256_shuffle_epi8(hi_lookup, hi_nibbles);
+                if (!_mm256_testz_si256(lo, hi))
+                {
+                    break;
+                }
+
+                const __m256i is_special = _mm256_cmpeq_epi8(in, special);
+                const __m256i index      = _mm256_or_si256(
+                    hi_nibbles, _mm256_and_si256(is_special, _mm256_set1_epi8(8)));
+                const __m256i values =
+                    _mm256_add_epi8(in, _mm256_shuffle_epi8(roll_lookup, index));
+
+                const __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+                __m256i out          = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+                out                  = _mm256_shuffle_epi8(
+                    out, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+                out = _mm256_permutevar8x32_epi32(out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (block_pos * 3)), out);
+                block_pos += 8;
+            }
+        }
+#endif
+
+#if SNN_SSSE3_ENABLED
+        {
+            // 4 blocks per iteration, the store writes 16 bytes (12 used).
+            while ((block_count - block_pos) >= 6)
+            {
+                const __m128i in =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (block_pos * 4)));
+                __m128i out;
+                if (!sse::decode_block(in, lookup, out))
+                {
+                    break;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (block_pos * 3)), out);
+                block_pos += 4;
+            }
+        }
+#endif
+
+        ignore_if_unused(src, block_count, dst, a);
+        return block_pos;
+    }
+
+    SNN_DIAGNOSTIC_POP
+}
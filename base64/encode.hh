@@ -7,6 +7,7 @@
 
 #include "snn-core/array.hh"
 #include "snn-core/strcore.hh"
+#include "snn-core/base64/detail/simd.hh"
 #include "snn-core/base64/table/encode/common.hh"
 
 namespace snn::base64
@@ -75,6 +76,20 @@ namespace snn::base64
             auto cur        = string.cbegin();
             const auto last = string.cend();
 
+            // SIMD for the standard and URL tables (only at runtime).
+            if (!std::is_constant_evaluated())
+            {
+                if (&lookup == &table::encode::standard || &lookup == &table::encode::url)
+                {
+                    const auto a           = (&lookup == &table::encode::standard)
+                                                 ? simd::alphabet::standard
+                                                 : simd::alphabet::url;
+                    const usize byte_count = simd::encode(cur, string.size(), dst, a);
+                    cur += byte_count;
+                    dst += (byte_count / 3) * 4;
+                }
+            }
+
             // Blocks of 3 bytes.
             while ((last - cur) >= 3)
             {
@@ -4,6 +4,9 @@
 #include "snn-core/base64/encode.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/base64/url/encode.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -114,6 +117,33 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_encode_simd()
+        {
+            // The SIMD path is only used with the standard and URL tables (by address), a copy of
+            // a table always uses the scalar path.
+            const array<char, 64> standard_copy = base64::table::encode::standard;
+            const array<char, 64> url_copy      = base64::table::encode::url;
+
+            random::wyrand rng{64};
+            for (usize size = 0; size < 300; ++size)
+            {
+                const str data = random::string(size, rng);
+
+                const str standard = base64::encode(data);
+                snn_require(standard ==
+                            base64::encode(data, base64::with_padding, '=', standard_copy));
+
+                const str url = base64::url::encode(data);
+                snn_require(url == base64::encode(data, base64::without_padding, '=', url_copy));
+            }
+
+            const str data = random::string(100'000, rng);
+            snn_require(base64::encode(data) ==
+                        base64::encode(data, base64::with_padding, '=', standard_copy));
+
+            return true;
+        }
     }
 }
 
@@ -124,5 +154,7 @@ namespace snn
         snn_static_require(app::example());
         snn_static_require(app::test_encode());
         snn_static_require(app::test_encoded_size());
+        snn_require(app::test_encode_simd());
+
     }
 }
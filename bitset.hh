@@ -0,0 +1,374 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Dynamic bitset
+
+// A run-time number of bits (`bit_count()`) stored in 64-bit words.
+// * `count()`, `rank(...)` and `find_next(...)` process a word at a time with `popcount` and
+//   `countr_zero` (single instructions with e.g. `-march=native`).
+// * The bulk operations (`&=`, `|=`, `^=`, `and_not(...)` and `count_and(...)`) use SSE2/AVX2
+//   when enabled at compile time, see [detail/bitset/simd.hh](detail/bitset/simd.hh).
+
+// Bits past `bit_count()` are always unset.
+
+#pragma once
+
+#include "snn-core/array_view.hh"
+#include "snn-core/optional_index.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/detail/bitset/simd.hh"
+#include "snn-core/math/common.hh"
+#include <bit> // countr_zero, popcount
+
+namespace snn
+{
+    // ## Classes
+
+    // ### bitset
+
+    class bitset final
+    {
+      public:
+        // #### Constants
+
+        static constexpr usize word_bits = 64;
+
+        // #### Default constructor
+
+        constexpr bitset() noexcept = default;
+
+        // #### Explicit constructors
+
+        // All bits are unset.
+        constexpr explicit bitset(const usize bit_count)
+        {
+            resize(bit_count);
+        }
+
+        // #### Bit count
+
+        [[nodiscard]] constexpr usize bit_count() const noexcept
+        {
+            return bit_count_;
+        }
+
+        // Bits added are unset.
+        constexpr void resize(const usize bit_count)
+        {
+            const usize word_count = (bit_count / word_bits) + ((bit_count % word_bits) != 0);
+            if (word_count > words_.count())
+            {
+                words_.reserve(word_count);
+                while (words_.count() < word_count)
+                {
+                    words_.append(0);
+                }
+            }
+            else
+            {
+                words_.truncate(word_count);
+            }
+            bit_count_ = bit_count;
+            trim_();
+        }
+
+        // #### Single bit access
+
+        // Returns `false` if `pos` is out of bounds.
+        [[nodiscard]] constexpr bool is_set(const usize pos) const noexcept
+        {
+            if (pos < bit_count_)
+            {
+                return (words_.at(pos / word_bits, assume::within_bounds) & bit_(pos)) != 0;
+            }
+            return false;
+        }
+
+        constexpr void set(const usize pos) noexcept
+        {
+            snn_assert(pos < bit_count_);
+            words_.at(pos / word_bits, assume::within_bounds) |= bit_(pos);
+        }
+
+        constexpr void unset(const usize pos) noexcept
+        {
+            snn_assert(pos < bit_count_);
+            words_.at(pos / word_bits, assume::within_bounds) &= ~bit_(pos);
+        }
+
+        constexpr void flip(const usize pos) noexcept
+        {
+            snn_assert(pos < bit_count_);
+            words_.at(pos / word_bits, assume::within_bounds) ^= bit_(pos);
+        }
+
+        // #### All bits
+
+        constexpr void set_all() noexcept
+        {
+            words_.view().fill(constant::limit<u64>::max);
+            trim_();
+        }
+
+        constexpr void unset_all() noexcept
+        {
+            words_.view().fill(u64{0});
+        }
+
+        [[nodiscard]] constexpr bool all() const noexcept
+        {
+            return count() == bit_count_;
+        }
+
+        [[nodiscard]] constexpr bool any() const noexcept
+        {
+            for (const u64 w : words_)
+            {
+                if (w != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] constexpr bool none() const noexcept
+        {
+            return !any();
+        }
+
+        // #### Count/rank
+
+        // Number of bits set.
+        [[nodiscard]] constexpr usize count() const noexcept
+        {
+            return count_and_(words_.cbegin(), words_.cbegin(), words_.count());
+        }
+
+        // Number of bits set before `pos` (`pos` is clamped to `bit_count()`).
+        [[nodiscard]] constexpr usize rank(usize pos) const noexcept
+        {
+            pos              = math::min(pos, bit_count_);
+            const usize full = pos / word_bits;
+            usize rank       = count_and_(words_.cbegin(), words_.cbegin(), full);
+            if ((pos % word_bits) != 0)
+            {
+                rank += popcount_(words_.at(full, assume::within_bounds) & (bit_(pos) - 1));
+            }
+            return rank;
+        }
+
+        // Number of bits set in both bitsets.
+        [[nodiscard]] constexpr usize count_and(const bitset& other) const noexcept
+        {
+            return count_and_(words_.cbegin(), other.words_.cbegin(),
+                              math::min(words_.count(), other.words_.count()));
+        }
+
+        // #### Find
+
+        // Position of the first set bit at or after `pos`.
+        [[nodiscard]] constexpr optional_index find_next(const usize pos) const noexcept
+        {
+            if (pos >= bit_count_)
+            {
+                return constant::npos;
+            }
+
+            usize index = pos / word_bits;
+            u64 word    = words_.at(index, assume::within_bounds) & ~(bit_(pos) - 1);
+            while (word == 0)
+            {
+                ++index;
+                if (index == words_.count())
+                {
+                    return constant::npos;
+                }
+                word = words_.at(index, assume::within_bounds);
+            }
+            return optional_index{(index * word_bits) + static_cast<usize>(std::countr_zero(word)),
+                                  assume::within_bounds};
+        }
+
+        // Position of the first unset bit at or after `pos`.
+        [[nodiscard]] constexpr optional_index find_next_unset(const usize pos) const noexcept
+        {
+            if (pos >= bit_count_)
+            {
+                return constant::npos;
+            }
+
+            usize index = pos / word_bits;
+            u64 word    = ~words_.at(index, assume::within_bounds) & ~(bit_(pos) - 1);
+            while (word == 0)
+            {
+                ++index;
+                if (index == words_.count())
+                {
+                    return constant::npos;
+                }
+                word = ~words_.at(index, assume::within_bounds);
+            }
+            const usize found = (index * word_bits) + static_cast<usize>(std::countr_zero(word));
+            if (found < bit_count_)
+            {
+                return optional_index{found, assume::within_bounds};
+            }
+            return constant::npos;
+        }
+
+        // #### Bulk operations
+
+        // The bit count doesn't change, bits in `other` past `bit_count()` are ignored and bits
+        // past `other.bit_count()` are treated as unset.
+
+        constexpr bitset& operator&=(const bitset& other) noexcept
+        {
+            apply_<detail::bitset::simd::operation::and_op>(other);
+            return *this;
+        }
+
+        constexpr bitset& operator|=(const bitset& other) noexcept
+        {
+            apply_<detail::bitset::simd::operation::or_op>(other);
+            return *this;
+        }
+
+        constexpr bitset& operator^=(const bitset& other) noexcept
+        {
+            apply_<detail::bitset::simd::operation::xor_op>(other);
+            return *this;
+        }
+
+        // Unset all bits that are set in `other`.
+        constexpr bitset& and_not(const bitset& other) noexcept
+        {
+            apply_<detail::bitset::simd::operation::and_not_op>(other);
+            return *this;
+        }
+
+        // #### Words
+
+        [[nodiscard]] constexpr array_view<const u64> words() const noexcept
+        {
+            return words_.view();
+        }
+
+        // #### Swap
+
+        constexpr void swap(bitset& other) noexcept
+        {
+            words_.swap(other.words_);
+            std::swap(bit_count_, other.bit_count_);
+        }
+
+        // #### Comparison
+
+        constexpr bool operator==(const bitset& other) const noexcept = default;
+
+      private:
+        vec<u64> words_;
+        usize bit_count_{0};
+
+        static constexpr u64 bit_(const usize pos) noexcept
+        {
+            return u64{1} << (pos % word_bits);
+        }
+
+        static constexpr usize popcount_(const u64 word) noexcept
+        {
+            return static_cast<usize>(std::popcount(word));
+        }
+
+        static constexpr usize count_and_(const u64* const a, const u64* const b,
+                                          const usize count) noexcept
+        {
+            usize total = 0;
+            usize i     = 0;
+            if (!std::is_constant_evaluated())
+            {
+                i = detail::bitset::simd::count_and(a, b, count, total);
+            }
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            for (; i < count; ++i)
+            {
+                total += popcount_(a[i] & b[i]);
+            }
+
+            SNN_DIAGNOSTIC_POP
+
+            return total;
+        }
+
+        template <detail::bitset::simd::operation Op>
+        constexpr void apply_(const bitset& other) noexcept
+        {
+            using detail::bitset::simd::operation;
+
+            u64* const dst    = words_.begin();
+            const u64* const src = other.words_.cbegin();
+            const usize count = math::min(words_.count(), other.words_.count());
+
+            usize i = 0;
+            if (!std::is_constant_evaluated())
+            {
+                i = detail::bitset::simd::apply<Op>(dst, src, count);
+            }
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            for (; i < count; ++i)
+            {
+                if constexpr (Op == operation::and_op)
+                {
+                    dst[i] &= src[i];
+                }
+                else if constexpr (Op == operation::or_op)
+                {
+                    dst[i] |= src[i];
+                }
+                else if constexpr (Op == operation::xor_op)
+                {
+                    dst[i] ^= src[i];
+                }
+                else
+                {
+                    dst[i] &= ~src[i];
+                }
+            }
+
+            if constexpr (Op == operation::and_op)
+            {
+                for (; i < words_.count(); ++i)
+                {
+                    dst[i] = 0;
+                }
+            }
+
+            SNN_DIAGNOSTIC_POP
+
+            trim_();
+        }
+
+        constexpr void trim_() noexcept
+        {
+            if ((bit_count_ % word_bits) != 0)
+            {
+                words_.back(assume::not_empty) &= bit_(bit_count_) - 1;
+            }
+        }
+    };
+
+    // ## Functions
+
+    // ### swap
+
+    constexpr void swap(bitset& a, bitset& b) noexcept
+    {
+        a.swap(b);
+    }
+}
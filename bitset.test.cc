@@ -0,0 +1,189 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/bitset.hh"
+
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            bitset b{100};
+            snn_require(b.bit_count() == 100);
+            snn_require(b.count() == 0);
+            snn_require(b.none());
+
+            b.set(3);
+            b.set(64);
+            b.set(99);
+            snn_require(b.is_set(3));
+            snn_require(!b.is_set(4));
+            snn_require(!b.is_set(100)); // Out of bounds.
+            snn_require(b.count() == 3);
+
+            // Number of bits set before a position.
+            snn_require(b.rank(0) == 0);
+            snn_require(b.rank(4) == 1);
+            snn_require(b.rank(65) == 2);
+            snn_require(b.rank(1000) == 3);
+
+            // Iterate over all set bits.
+            usize sum = 0;
+            for (auto pos = b.find_next(0); pos; pos = b.find_next(pos.value() + 1))
+            {
+                sum += pos.value();
+            }
+            snn_require(sum == 3 + 64 + 99);
+
+            bitset filter{100};
+            filter.set(64);
+            filter.set(70);
+            snn_require(b.count_and(filter) == 1);
+            b &= filter;
+            snn_require(b.count() == 1);
+            snn_require(b.is_set(64));
+
+            return true;
+        }
+
+        constexpr bool test_bitset()
+        {
+            {
+                bitset b;
+                snn_require(b.bit_count() == 0);
+                snn_require(b.count() == 0);
+                snn_require(b.all());
+                snn_require(!b.find_next(0));
+                snn_require(!b.find_next_unset(0));
+                snn_require(b.words().is_empty());
+            }
+            {
+                bitset b{130};
+                snn_require(b.words().count() == 3);
+
+                b.set_all();
+                snn_require(b.count() == 130);
+                snn_require(b.all());
+                snn_require(b.words().at(2).value() == 0b11); // Bits past bit_count are unset.
+                snn_require(!b.find_next_unset(0));
+
+                b.unset(129);
+                b.flip(5);
+                snn_require(b.count() == 128);
+                snn_require(b.find_next_unset(0).value() == 5);
+                snn_require(b.find_next_unset(6).value() == 129);
+                snn_require(!b.find_next(129));
+
+                b.unset_all();
+                snn_require(b.none());
+                snn_require(!b.find_next(0));
+
+                // Resize.
+                b.set(127);
+                b.resize(128);
+                snn_require(b.words().count() == 2);
+                snn_require(b.is_set(127));
+                b.resize(100);
+                snn_require(b.count() == 0);
+                b.resize(200);
+                snn_require(b.count() == 0);
+                snn_require(b.bit_count() == 200);
+                b.set(199);
+                snn_require(b.find_next(0).value() == 199);
+            }
+            {
+                // Different sizes.
+                bitset a{70};
+                bitset b{200};
+                a.set_all();
+                b.set_all();
+
+                bitset c = a;
+                c |= b;
+                snn_require(c.count() == 70);
+
+                c = b;
+                c &= a;
+                snn_require(c.count() == 70);
+                snn_require(c.bit_count() == 200);
+
+                c = b;
+                c.and_not(a);
+                snn_require(c.count() == 130);
+                snn_require(c.find_next(0).value() == 70);
+
+                c ^= b;
+                snn_require(c.count() == 70);
+                snn_require(c.rank(70) == 70);
+
+                swap(a, c);
+                snn_require(a.bit_count() == 200);
+                snn_require(c.bit_count() == 70);
+                snn_require(a != c);
+            }
+
+            return true;
+        }
+
+        bool test_bulk()
+        {
+            // Large enough for the SIMD kernels (with a scalar tail).
+            constexpr usize bit_count = 10'000'003;
+
+            bitset a{bit_count};
+            bitset b{bit_count};
+            for (usize i = 0; i < bit_count; i += 3)
+            {
+                a.set(i);
+            }
+            for (usize i = 0; i < bit_count; i += 5)
+            {
+                b.set(i);
+            }
+
+            const usize a_count = (bit_count + 2) / 3;
+            const usize b_count = (bit_count + 4) / 5;
+            const usize both    = (bit_count + 14) / 15;
+            snn_require(a.count() == a_count);
+            snn_require(b.count() == b_count);
+            snn_require(a.count_and(b) == both);
+            snn_require(a.rank(bit_count - 1) == a_count - 1); // The last bit is set.
+
+            bitset c = a;
+            c &= b;
+            snn_require(c.count() == both);
+            snn_require(c.find_next(1).value() == 15);
+
+            c = a;
+            c |= b;
+            snn_require(c.count() == a_count + b_count - both);
+
+            c = a;
+            c ^= b;
+            snn_require(c.count() == a_count + b_count - (2 * both));
+
+            c = a;
+            c.and_not(b);
+            snn_require(c.count() == a_count - both);
+            snn_require(!c.is_set(15));
+            snn_require(c.is_set(3));
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_require(app::example());
+        snn_static_require(app::test_bitset());
+        snn_require(app::test_bitset());
+        snn_require(app::test_bulk());
+    }
+}
@@ -0,0 +1,267 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Vectorized lookup (SSE2/SSSE3/AVX2)
+
+// Find the first character in a string that is not "pass-through" according to a `bool` lookup
+// table (e.g. the first character that needs escaping), 16 or 32 characters at a time.
+
+// The lookup table is converted at compile time:
+// * SSSE3/AVX2: A nibble based classification (two `pshufb` table lookups per chunk), this works
+//   for any table where the high nibbles share at most 8 distinct sets of low nibbles.
+// * SSE2: Comparisons, this works for any table where the characters that are not pass-through
+//   are (optionally) all control characters (0x00-0x1F), (optionally) all non-ASCII characters
+//   (0x80-0xFF) and at most 8 other characters.
+
+// Tables that can not be converted are rejected at compile time (SSSE3/AVX2) or fall back to the
+// scalar code (SSE2). Constant evaluation always uses the scalar code.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/chr/fn/lookup.hh"
+#include "snn-core/range/contiguous.hh"
+#include <bit> // countr_zero
+#if SNN_SSE2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::chr::detail::simd
+{
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+    // ## Classes
+
+    // ### lookup
+
+    class lookup final
+    {
+      public:
+        // #### Explicit constructors
+
+        // `true` in the table means pass-through.
+
+        constexpr explicit lookup(const array<bool, 256>& table)
+            : is_passthrough_{table}
+        {
+            init_nibble_tables_(table);
+            init_comparisons_(table);
+        }
+
+        explicit lookup(const array<bool, 256>&&) = delete;
+
+        // #### Count
+
+        // Count leading pass-through characters. Only full chunks are processed, the caller must
+        // continue with the scalar code from the returned position.
+
+        [[nodiscard]] usize count(const char* const data, const usize size) const noexcept
+        {
+            usize pos = 0;
+
+#if SNN_AVX2_ENABLED
+            {
+                const __m256i lo_table = _mm256_broadcastsi128_si256(load_(lo_nibble_.begin()));
+                const __m256i hi_table = _mm256_broadcastsi128_si256(load_(hi_nibble_.begin()));
+                const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+                while ((size - pos) >= 32)
+                {
+                    const __m256i in =
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+                    const __m256i lo =
+                        _mm256_shuffle_epi8(lo_table, _mm256_and_si256(in, nibble_mask));
+                    const __m256i hi = _mm256_shuffle_epi8(
+                        hi_table, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask));
+                    const __m256i is_passthrough =
+                        _mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256());
+                    const u32 mask = static_cast<u32>(_mm256_movemask_epi8(is_passthrough));
+                    if (mask != 0xffff'ffff)
+                    {
+                        return pos + static_cast<usize>(std::countr_zero(~mask));
+                    }
+                    pos += 32;
+                }
+            }
+#endif
+
+#if SNN_SSSE3_ENABLED
+            {
+                const __m128i lo_table    = load_(lo_nibble_.begin());
+                const __m128i hi_table    = load_(hi_nibble_.begin());
+                const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+                while ((size - pos) >= 16)
+                {
+                    const __m128i in = load_(data + pos);
+                    const __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(in, nibble_mask));
+                    const __m128i hi = _mm_shuffle_epi8(
+                        hi_table, _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask));
+                    const __m128i is_passthrough =
+                        _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+                    const u32 mask = static_cast<u32>(_mm_movemask_epi8(is_passthrough));
+                    if (mask != 0xffff)
+                    {
+                        return pos + static_cast<usize>(std::countr_zero(~mask));
+                    }
+                    pos += 16;
+                }
+            }
+#elif SNN_SSE2_ENABLED
+            if (has_comparisons_)
+            {
+                const __m128i control_max = _mm_set1_epi8(0x1f);
+                while ((size - pos) >= 16)
+                {
+                    const __m128i in = load_(data + pos);
+
+                    __m128i is_special = _mm_setzero_si128();
+                    if (control_)
+                    {
+                        // Unsigned `in <= 0x1f`.
+                        is_special = _mm_cmpeq_epi8(_mm_max_epu8(in, control_max), control_max);
+                    }
+                    if (non_ascii_)
+                    {
+                        // Only the high bit is used by `_mm_movemask_epi8()`.
+                        is_special = _mm_or_si128(is_special, in);
+                    }
+                    for (usize i = 0; i < special_count_; ++i)
+                    {
+                        const __m128i c = _mm_set1_epi8(special_.at(i, assume::within_bounds));
+                        is_special      = _mm_or_si128(is_special, _mm_cmpeq_epi8(in, c));
+                    }
+
+                    const u32 mask = static_cast<u32>(_mm_movemask_epi8(is_special));
+                    if (mask != 0)
+                    {
+                        return pos + static_cast<usize>(std::countr_zero(mask));
+                    }
+                    pos += 16;
+                }
+            }
+#endif
+
+            ignore_if_unused(data, size);
+            return pos;
+        }
+
+        // #### Pop
+
+        // Pop leading pass-through characters.
+
+        [[nodiscard]] constexpr cstrview pop_front_while(range::contiguous<const char*>& rng) const
+        {
+            const char* const first = rng.begin();
+            if (!std::is_constant_evaluated())
+            {
+                ignore_if_unused(rng.pop_front_n(count(rng.begin(), rng.count())));
+            }
+            ignore_if_unused(rng.pop_front_while(is_passthrough_));
+            return cstrview{init::from, first, rng.begin()};
+        }
+
+      private:
+        chr::fn::lookup<bool> is_passthrough_;
+
+        // A character is pass-through if `(lo_nibble_[c & 0xf] & hi_nibble_[c >> 4]) == 0`.
+        array<u8, 16> lo_nibble_{};
+        array<u8, 16> hi_nibble_{};
+
+        array<char, 8> special_{};
+        usize special_count_{0};
+        bool control_{false};
+        bool non_ascii_{false};
+        bool has_comparisons_{false};
+
+        constexpr void init_nibble_tables_(const array<bool, 256>& table)
+        {
+            // Group high nibbles with the same set of (not pass-through) low nibbles, each group
+            // gets one bit.
+            array<u16, 8> groups{};
+            usize group_count = 0;
+            for (usize hi = 0; hi < 16; ++hi)
+            {
+                u16 low_nibbles = 0;
+                for (usize lo = 0; lo < 16; ++lo)
+                {
+                    if (!table.at((hi << 4u) | lo, assume::within_bounds))
+                    {
+                        low_nibbles = static_cast<u16>(low_nibbles | (1u << lo));
+                    }
+                }
+
+                if (low_nibbles != 0)
+                {
+                    usize group = 0;
+                    while (group < group_count && groups.at(group, bounds::mask) != low_nibbles)
+                    {
+                        ++group;
+                    }
+
+                    if (group == group_count)
+                    {
+                        snn_assert(group_count < groups.count());
+                        groups.at(group, bounds::mask) = low_nibbles;
+                        ++group_count;
+                    }
+
+                    const auto bit                   = static_cast<u8>(1u << group);
+                    hi_nibble_.at(hi, bounds::mask) = bit;
+                    for (usize lo = 0; lo < 16; ++lo)
+                    {
+                        if (low_nibbles & (1u << lo))
+                        {
+                            u8& lo_bits = lo_nibble_.at(lo, bounds::mask);
+                            lo_bits     = static_cast<u8>(lo_bits | bit);
+                        }
+                    }
+                }
+            }
+        }
+
+        constexpr void init_comparisons_(const array<bool, 256>& table)
+        {
+            const auto is_range_special = [&table](const usize first, const usize last) {
+                for (usize i = first; i <= last; ++i)
+                {
+                    if (table.at(i, assume::within_bounds))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            control_   = is_range_special(0x00, 0x1f);
+            non_ascii_ = is_range_special(0x80, 0xff);
+
+            for (usize i = 0; i < table.count(); ++i)
+            {
+                if (table.at(i, assume::within_bounds))
+                {
+                    continue;
+                }
+                if ((control_ && i <= 0x1f) || (non_ascii_ && i >= 0x80))
+                {
+                    continue;
+                }
+                if (special_count_ == special_.count())
+                {
+                    return; // Too many characters, SSE2 can't be used.
+                }
+                special_.at(special_count_, assume::within_bounds) = static_cast<char>(i);
+                ++special_count_;
+            }
+
+            has_comparisons_ = true;
+        }
+
+#if SNN_SSE2_ENABLED
+        static __m128i load_(const auto* const data) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        }
+#endif
+    };
+    SNN_DIAGNOSTIC_POP
+}
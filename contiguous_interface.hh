@@ -116,6 +116,13 @@ namespace snn
             return derived_().view().find(std::forward<V>(value), start_pos);
         }
 
+        template <typename V>
+        [[nodiscard]] constexpr optional_index find_any_of(V&& values,
+                                                           const usize start_pos = 0) const noexcept
+        {
+            return derived_().view().find_any_of(std::forward<V>(values), start_pos);
+        }
+
         SNN_DIAGNOSTIC_PUSH
         SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
 
@@ -158,6 +158,39 @@ static_assert(std::is_same_v<std::uint8_t, unsigned char>, "std::uint8_t must be
     #define SNN_INT128_ENABLED 0
 #endif
 
+// ### SNN_SSE2_ENABLED, SNN_SSSE3_ENABLED & SNN_AVX2_ENABLED
+
+// Instruction sets available at compile time (e.g. with `-march=native`), there is no runtime
+// dispatch. Code using these must have a portable fallback.
+
+#if defined(__SSE2__)
+    #define SNN_SSE2_ENABLED 1
+#else
+    #define SNN_SSE2_ENABLED 0
+#endif
+
+#if defined(__SSSE3__)
+    #define SNN_SSSE3_ENABLED 1
+#else
+    #define SNN_SSSE3_ENABLED 0
+#endif
+
+#if defined(__AVX2__)
+    #define SNN_AVX2_ENABLED 1
+#else
+    #define SNN_AVX2_ENABLED 0
+#endif
+
+// ### SNN_SHA_ENABLED
+
+// SHA extensions (SHA-NI), together with SSE4.1 (used for the state shuffling).
+
+#if defined(__SHA__) && defined(__SSE4_1__)
+    #define SNN_SHA_ENABLED 1
+#else
+    #define SNN_SHA_ENABLED 0
+#endif
+
 namespace snn
 {
     // ## Types
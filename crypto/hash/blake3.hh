@@ -0,0 +1,167 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # BLAKE3
+
+// Hash mode with a 32-byte output (no keyed hashing, key derivation or extendable output).
+// Full chunks are hashed 8 at a time with AVX2 (if enabled at compile time). See
+// `blake3_parallel.hh` for multithreaded hashing of large inputs.
+
+#pragma once
+
+#include "snn-core/crypto/hash/base.hh"
+#include "snn-core/crypto/hash/detail/blake3.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/raw/copy.hh"
+
+namespace snn::crypto::hash
+{
+    // ## Classes
+
+    // ### blake3
+
+    class blake3 final : public base<blake3, detail::blake3::output_size>
+    {
+      public:
+        static constexpr usize block_size  = detail::blake3::block_size;
+        static constexpr usize chunk_size  = detail::blake3::chunk_size;
+        static constexpr usize output_size = detail::blake3::output_size;
+
+        blake3() noexcept
+        {
+            init_();
+        }
+
+      private:
+        friend class base<blake3, output_size>;
+
+        detail::blake3::cv_stack cv_stack_;
+
+        // Current chunk.
+        array<u32, 8> cv_;
+        array<char, block_size> block_;
+        u64 chunk_counter_;
+        usize block_size_;
+        usize blocks_compressed_;
+
+        void init_() noexcept
+        {
+            cv_stack_.clear();
+            start_chunk_(0);
+        }
+
+        void start_chunk_(const u64 chunk_counter) noexcept
+        {
+            cv_                = detail::blake3::iv;
+            chunk_counter_     = chunk_counter;
+            block_size_        = 0;
+            blocks_compressed_ = 0;
+        }
+
+        [[nodiscard]] usize chunk_byte_count_() const noexcept
+        {
+            return (blocks_compressed_ * block_size) + block_size_;
+        }
+
+        [[nodiscard]] u32 start_flag_() const noexcept
+        {
+            return blocks_compressed_ == 0 ? detail::blake3::chunk_start : 0;
+        }
+
+        void update_(cstrview string) noexcept
+        {
+            while (string)
+            {
+                if (chunk_byte_count_() == chunk_size)
+                {
+                    // The chunk is complete and more input follows, so it is not the root.
+                    const array<u32, 8> cv = detail::blake3::first_8(detail::blake3::compress(
+                        cv_, block_.begin(), chunk_counter_, block_size,
+                        start_flag_() | detail::blake3::chunk_end));
+                    cv_stack_.push(cv, chunk_counter_ + 1);
+                    start_chunk_(chunk_counter_ + 1);
+                }
+
+                // Hash whole chunks directly, but always keep the last one (it might be the root).
+                if (chunk_byte_count_() == 0 && string.size() > chunk_size)
+                {
+                    const usize chunk_count = (string.size() - 1) / chunk_size;
+                    hash_chunks_(string.begin(), chunk_count);
+                    string.drop_front_n(chunk_count * chunk_size);
+                }
+
+                if (block_size_ == block_size)
+                {
+                    cv_ = detail::blake3::first_8(detail::blake3::compress(
+                        cv_, block_.begin(), chunk_counter_, block_size, start_flag_()));
+                    ++blocks_compressed_;
+                    block_size_ = 0;
+                }
+
+                const usize size =
+                    math::min(block_size - block_size_, chunk_size - chunk_byte_count_());
+                const usize copy_size = math::min(size, string.size());
+                mem::raw::copy(string.data(), not_null{block_.begin() + block_size_},
+                               byte_size{copy_size}, assume::no_overlap);
+                block_size_ += copy_size;
+                string.drop_front_n(copy_size);
+            }
+        }
+
+        void hash_chunks_(const char* chunks, usize chunk_count) noexcept
+        {
+            constexpr usize batch_size = 16;
+            array<array<u32, 8>, batch_size> cvs;
+            while (chunk_count > 0)
+            {
+                const usize count = math::min(chunk_count, batch_size);
+                detail::blake3::hash_chunks(chunks, count, chunk_counter_, cvs.begin());
+                for (usize i = 0; i < count; ++i)
+                {
+                    ++chunk_counter_;
+                    cv_stack_.push(cvs.at(i, assume::within_bounds), chunk_counter_);
+                }
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+                chunks += count * chunk_size;
+                SNN_DIAGNOSTIC_POP
+                chunk_count -= count;
+            }
+            start_chunk_(chunk_counter_);
+        }
+
+        template <usize Count>
+            requires(Count >= output_size && Count != constant::dynamic_count)
+        void final_(array_view<char, Count> digest) noexcept
+        {
+            // Zero pad the last block of the current chunk.
+            for (usize i = block_size_; i < block_size; ++i)
+            {
+                block_.at(i, assume::within_bounds) = '\0';
+            }
+
+            if (cv_stack_.count() == 0)
+            {
+                // Single chunk, it is the root.
+                detail::blake3::root_output(cv_, block_.begin(), static_cast<u32>(block_size_),
+                                            start_flag_() | detail::blake3::chunk_end,
+                                            digest.begin());
+                return;
+            }
+
+            array<u32, 8> right = detail::blake3::first_8(detail::blake3::compress(
+                cv_, block_.begin(), chunk_counter_, static_cast<u32>(block_size_),
+                start_flag_() | detail::blake3::chunk_end));
+
+            while (cv_stack_.count() > 1)
+            {
+                right = detail::blake3::parent_cv(cv_stack_.pop(), right);
+            }
+
+            const array<char, block_size> block =
+                detail::blake3::parent_block(cv_stack_.pop(), right);
+            detail::blake3::root_output(detail::blake3::iv, block.begin(), block_size,
+                                        detail::blake3::parent, digest.begin());
+        }
+    };
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/crypto/hash/blake3.hh"
+
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            crypto::hash::blake3 h;
+
+            h.update("abc");
+            str digest = h.final_hex();
+            snn_require(digest ==
+                        "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85");
+
+            h.reset();
+
+            h << "a" << "b" << "c";
+            digest = h.final_hex();
+            snn_require(digest ==
+                        "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85");
+
+            return true;
+        }
+
+        // Input from the official test vectors: bytes 0, 1, ..., 250, 0, 1, ...
+        str test_input(const usize size)
+        {
+            str s{init::reserve, size};
+            for (usize i = 0; i < size; ++i)
+            {
+                s.append(static_cast<char>(i % 251));
+            }
+            return s;
+        }
+
+        str hash_hex(const cstrview input)
+        {
+            crypto::hash::blake3 h;
+            h.update(input);
+            return h.final_hex();
+        }
+
+        bool test_vector(const usize size, const cstrview expected)
+        {
+            const str input = test_input(size);
+            return hash_hex(input) == expected;
+        }
+
+        // Hash in pieces of `piece_size` bytes.
+        str hash_hex(const cstrview input, const usize piece_size)
+        {
+            crypto::hash::blake3 h;
+            for (usize i = 0; i < input.size(); i += piece_size)
+            {
+                h.update(input.view(i, piece_size));
+            }
+            return h.final_hex();
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+
+        static_assert(crypto::hash::blake3::block_size == 64);
+        static_assert(crypto::hash::blake3::chunk_size == 1024);
+        static_assert(crypto::hash::blake3::output_size == 32);
+
+        // Official test vectors (first 32 bytes of the hash).
+        snn_require(app::test_vector(
+            0, "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"));
+        snn_require(app::test_vector(
+            1, "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213"));
+        snn_require(app::test_vector(
+            1023, "10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11"));
+        snn_require(app::test_vector(
+            1024, "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7"));
+        snn_require(app::test_vector(
+            1025, "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444"));
+        snn_require(app::test_vector(
+            2048, "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a"));
+        snn_require(app::test_vector(
+            8192, "aae792484c8efe4f19e2ca7d371d8c467ffb10748d8a5a1ae579948f718a2a63"));
+
+        // Same digest whether hashed at once (full chunks 8 at a time with AVX2) or in pieces.
+        for (const auto size : init_list<usize>{0, 1, 64, 65, 1023, 1024, 1025, 3000, 8191, 8192,
+                                                 8193, 9216, 9217, 17408, 40000, 65536, 100000})
+        {
+            const str input    = app::test_input(size);
+            const str expected = app::hash_hex(input);
+            snn_require(app::hash_hex(input, 1) == expected);
+            snn_require(app::hash_hex(input, 63) == expected);
+            snn_require(app::hash_hex(input, 1024) == expected);
+            snn_require(app::hash_hex(input, 5000) == expected);
+        }
+    }
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # BLAKE3 (multithreaded)
+
+// Hash a large in-memory input (e.g. from `file::read`) with multiple threads. The BLAKE3 tree is
+// split into left and right subtrees, each hashed on its own thread until `thread_count` threads
+// are used. The digest is identical to `crypto::hash::blake3`.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/crypto/hash/blake3.hh"
+#include "snn-core/crypto/hash/detail/blake3.hh"
+#include "snn-core/math/common.hh"
+#include <bit>       // bit_floor
+#include <exception> // current_exception, exception_ptr, rethrow_exception
+#include <thread>    // hardware_concurrency, thread
+
+namespace snn::crypto::hash
+{
+    namespace detail::blake3
+    {
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        // Subtrees smaller than this are never split between threads.
+        inline constexpr usize min_parallel_size = 256 * chunk_size;
+
+        // Size of the left subtree: the largest power of 2 number of full chunks that leaves at
+        // least one byte for the right subtree.
+        [[nodiscard]] constexpr usize left_size(const usize size) noexcept
+        {
+            snn_should(size > chunk_size);
+            const usize chunk_count = (size - 1) / chunk_size; // Full chunks, excluding the last.
+            return std::bit_floor(chunk_count) * chunk_size;
+        }
+
+        // Call `left()` on a new thread and `right()` on the calling thread. The thread is always
+        // joined, an exception from either side is rethrown after that.
+        template <typename Left, typename Right>
+        void fork_join(Left& left, Right& right)
+        {
+            std::exception_ptr left_error;
+            std::thread thread{[&left, &left_error] {
+                try
+                {
+                    left();
+                }
+                catch (...)
+                {
+                    left_error = std::current_exception();
+                }
+            }};
+
+            try
+            {
+                right();
+            }
+            catch (...)
+            {
+                thread.join();
+                throw;
+            }
+            thread.join();
+
+            if (left_error)
+            {
+                std::rethrow_exception(left_error);
+            }
+        }
+
+        inline array<u32, 8> subtree_cv_serial(const char* data, usize size,
+                                               u64 chunk_counter) noexcept
+        {
+            snn_should(size > 0);
+
+            constexpr usize batch_size = 16;
+            array<array<u32, 8>, batch_size> cvs;
+            cv_stack stack;
+            u64 total_chunks = 0;
+
+            while (size > chunk_size)
+            {
+                const usize count = math::min((size - 1) / chunk_size, batch_size);
+                hash_chunks(data, count, chunk_counter, cvs.begin());
+                for (usize i = 0; i < count; ++i)
+                {
+                    ++total_chunks;
+                    stack.push(cvs.at(i, assume::within_bounds), total_chunks);
+                }
+                data += count * chunk_size;
+                size -= count * chunk_size;
+                chunk_counter += count;
+            }
+
+            ++total_chunks;
+            stack.push(chunk_cv(data, size, chunk_counter), total_chunks);
+
+            return stack.merge();
+        }
+
+        inline array<u32, 8> subtree_cv(const char* const data, const usize size,
+                                        const u64 chunk_counter, const usize thread_count)
+        {
+            if (thread_count <= 1 || size < min_parallel_size)
+            {
+                return subtree_cv_serial(data, size, chunk_counter);
+            }
+
+            const usize left      = left_size(size);
+            const usize left_thds = thread_count / 2;
+
+            array<u32, 8> left_cv;
+            array<u32, 8> right_cv;
+            auto hash_left = [&left_cv, data, left, chunk_counter, left_thds] {
+                left_cv = subtree_cv(data, left, chunk_counter, left_thds);
+            };
+            auto hash_right = [&right_cv, data, size, left, chunk_counter, thread_count,
+                               left_thds] {
+                right_cv = subtree_cv(data + left, size - left,
+                                      chunk_counter + (left / chunk_size),
+                                      thread_count - left_thds);
+            };
+            fork_join(hash_left, hash_right);
+
+            return parent_cv(left_cv, right_cv);
+        }
+
+        SNN_DIAGNOSTIC_POP
+    }
+
+    // ## Functions
+
+    // ### blake3_parallel
+
+    // Hash `data` using (at most) `thread_count` threads (0 for one per hardware thread). Small
+    // inputs are hashed on the calling thread.
+
+    inline void blake3_parallel(const transient<cstrview> data,
+                                array<char, detail::blake3::output_size>& digest,
+                                usize thread_count = 0)
+    {
+        const cstrview s = data.get();
+
+        if (thread_count == 0)
+        {
+            thread_count = math::max(usize{std::thread::hardware_concurrency()}, usize{1});
+        }
+
+        if (s.size() <= detail::blake3::chunk_size)
+        {
+            blake3 h;
+            h.update(s);
+            h.final(digest);
+            return;
+        }
+
+        const usize left      = detail::blake3::left_size(s.size());
+        const usize left_thds = thread_count / 2;
+
+        array<u32, 8> left_cv;
+        array<u32, 8> right_cv;
+        if (left_thds > 0 && s.size() >= detail::blake3::min_parallel_size)
+        {
+            auto hash_left = [&left_cv, &s, left, left_thds] {
+                left_cv = detail::blake3::subtree_cv(s.begin(), left, 0, left_thds);
+            };
+            auto hash_right = [&right_cv, &s, left, left_thds, thread_count] {
+                right_cv = detail::blake3::subtree_cv(s.view(left).begin(), s.size() - left,
+                                                      left / detail::blake3::chunk_size,
+                                                      thread_count - left_thds);
+            };
+            detail::blake3::fork_join(hash_left, hash_right);
+        }
+        else
+        {
+            left_cv  = detail::blake3::subtree_cv_serial(s.begin(), left, 0);
+            right_cv = detail::blake3::subtree_cv_serial(
+                s.view(left).begin(), s.size() - left, left / detail::blake3::chunk_size);
+        }
+
+        const array<char, detail::blake3::block_size> block =
+            detail::blake3::parent_block(left_cv, right_cv);
+        detail::blake3::root_output(detail::blake3::iv, block.begin(),
+                                    detail::blake3::block_size, detail::blake3::parent,
+                                    digest.begin());
+    }
+
+    template <any_strcore Str = str>
+    [[nodiscard]] Str blake3_parallel(const transient<cstrview> data, const usize thread_count = 0)
+    {
+        array<char, detail::blake3::output_size> digest;
+        blake3_parallel(data, digest, thread_count);
+        return Str{digest.view()};
+    }
+}
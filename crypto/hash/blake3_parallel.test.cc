@@ -0,0 +1,70 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/crypto/hash/blake3_parallel.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/hex/encode.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // const auto data = file::read<strbuf>("large.bin").value();
+            const str data{init::fill, 3 * constant::size::mebibyte<usize>, 'a'};
+
+            array<char, 32> digest;
+            crypto::hash::blake3_parallel(data, digest, 4);
+
+            crypto::hash::blake3 h;
+            h.update(data);
+            snn_require(digest.view() == h.final());
+
+            return true;
+        }
+
+        str test_input(const usize size)
+        {
+            str s{init::reserve, size};
+            for (usize i = 0; i < size; ++i)
+            {
+                s.append(static_cast<char>(i % 251));
+            }
+            return s;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+
+        snn_require(hex::encode(crypto::hash::blake3_parallel("abc")) ==
+                    "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85");
+
+        static_assert(crypto::hash::detail::blake3::left_size(1025) == 1024);
+        static_assert(crypto::hash::detail::blake3::left_size(2048) == 1024);
+        static_assert(crypto::hash::detail::blake3::left_size(2049) == 2048);
+        static_assert(crypto::hash::detail::blake3::left_size(4096) == 2048);
+        static_assert(crypto::hash::detail::blake3::left_size(5000) == 4096);
+
+        for (const auto size : init_list<usize>{0, 1, 1024, 1025, 8192, 9217, 262'144, 262'145,
+                                                 1'000'000, 2'097'152, 2'500'001})
+        {
+            const str input = app::test_input(size);
+
+            crypto::hash::blake3 h;
+            h.update(input);
+            const str expected = h.final();
+
+            for (const auto thread_count : init_list<usize>{0, 1, 2, 3, 8})
+            {
+                snn_require(crypto::hash::blake3_parallel(input, thread_count) == expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,479 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # BLAKE3 compression (portable and 8-lane AVX2)
+
+// * `compress()`: One 64-byte block.
+// * `hash_chunk()`: One full (non-root) 1024-byte chunk.
+// * `hash_chunks()`: Any number of consecutive full (non-root) chunks, 8 at a time with AVX2.
+// * `chunk_cv()`: One partial or full (non-root) chunk.
+// * `parent_cv()`/`root_output()`: Tree nodes.
+// * `cv_stack`: Chaining values of completed subtrees.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/crypto/hash/detail/simd.hh"
+#include <bit> // rotr
+#if SNN_AVX2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::crypto::hash::detail::blake3
+{
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+    // ## Constants
+
+    inline constexpr usize block_size  = 64;
+    inline constexpr usize chunk_size  = 1024;
+    inline constexpr usize output_size = 32;
+
+    inline constexpr u32 chunk_start = 1 << 0;
+    inline constexpr u32 chunk_end   = 1 << 1;
+    inline constexpr u32 parent      = 1 << 2;
+    inline constexpr u32 root        = 1 << 3;
+
+    // clang-format off
+    inline constexpr array<u32, 8> iv{
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    // The message word permutation applied to the identity, once per round.
+    inline constexpr array<array<u8, 16>, 7> schedule{{
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+        {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+        {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+        {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+        {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+        {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13},
+    }};
+    // clang-format on
+
+    // ## Functions
+
+    [[nodiscard]] constexpr u32 load_le(const char* const data) noexcept
+    {
+        return u32{to_byte(data[0])} | (u32{to_byte(data[1])} << 8u) |
+               (u32{to_byte(data[2])} << 16u) | (u32{to_byte(data[3])} << 24u);
+    }
+
+    constexpr void store_le(const u32 w, char* const data) noexcept
+    {
+        data[0] = static_cast<char>(w);
+        data[1] = static_cast<char>(w >> 8u);
+        data[2] = static_cast<char>(w >> 16u);
+        data[3] = static_cast<char>(w >> 24u);
+    }
+
+    // ### compress
+
+    constexpr void g(array<u32, 16>& v, const usize a, const usize b, const usize c,
+                     const usize d, const u32 x, const u32 y) noexcept
+    {
+        u32& va = v.at(a, bounds::mask);
+        u32& vb = v.at(b, bounds::mask);
+        u32& vc = v.at(c, bounds::mask);
+        u32& vd = v.at(d, bounds::mask);
+
+        va = va + vb + x;
+        vd = std::rotr(vd ^ va, 16);
+        vc = vc + vd;
+        vb = std::rotr(vb ^ vc, 12);
+        va = va + vb + y;
+        vd = std::rotr(vd ^ va, 8);
+        vc = vc + vd;
+        vb = std::rotr(vb ^ vc, 7);
+    }
+
+    // Returns the full 16-word output, the first 8 words are the new chaining value.
+    [[nodiscard]] constexpr array<u32, 16> compress(const array<u32, 8>& cv,
+                                                    const char* const block, const u64 counter,
+                                                    const u32 block_len, const u32 flags) noexcept
+    {
+        array<u32, 16> m;
+        for (usize i = 0; i < 16; ++i)
+        {
+            m.at(i, bounds::mask) = load_le(block + (i * 4));
+        }
+
+        array<u32, 16> v{
+            cv.at(0, bounds::mask), cv.at(1, bounds::mask), cv.at(2, bounds::mask),
+            cv.at(3, bounds::mask), cv.at(4, bounds::mask), cv.at(5, bounds::mask),
+            cv.at(6, bounds::mask), cv.at(7, bounds::mask), iv.at(0, bounds::mask),
+            iv.at(1, bounds::mask), iv.at(2, bounds::mask), iv.at(3, bounds::mask),
+            static_cast<u32>(counter), static_cast<u32>(counter >> 32u), block_len,
+            flags,
+        };
+
+        for (const auto& s : schedule)
+        {
+            const auto msg = [&m, &s](const usize i) {
+                return m.at(s.at(i, bounds::mask), bounds::mask);
+            };
+
+            // Columns.
+            g(v, 0, 4, 8, 12, msg(0), msg(1));
+            g(v, 1, 5, 9, 13, msg(2), msg(3));
+            g(v, 2, 6, 10, 14, msg(4), msg(5));
+            g(v, 3, 7, 11, 15, msg(6), msg(7));
+
+            // Diagonals.
+            g(v, 0, 5, 10, 15, msg(8), msg(9));
+            g(v, 1, 6, 11, 12, msg(10), msg(11));
+            g(v, 2, 7, 8, 13, msg(12), msg(13));
+            g(v, 3, 4, 9, 14, msg(14), msg(15));
+        }
+
+        for (usize i = 0; i < 8; ++i)
+        {
+            v.at(i, bounds::mask) ^= v.at(i + 8, bounds::mask);
+            v.at(i + 8, bounds::mask) ^= cv.at(i, bounds::mask);
+        }
+
+        return v;
+    }
+
+    [[nodiscard]] constexpr array<u32, 8> first_8(const array<u32, 16>& v) noexcept
+    {
+        return array<u32, 8>{
+            v.at(0, bounds::mask), v.at(1, bounds::mask), v.at(2, bounds::mask),
+            v.at(3, bounds::mask), v.at(4, bounds::mask), v.at(5, bounds::mask),
+            v.at(6, bounds::mask), v.at(7, bounds::mask),
+        };
+    }
+
+    // ### hash_chunk
+
+    [[nodiscard]] constexpr array<u32, 8> hash_chunk(const char* const chunk,
+                                                     const u64 chunk_counter) noexcept
+    {
+        array<u32, 8> cv = iv;
+        for (usize i = 0; i < (chunk_size / block_size); ++i)
+        {
+            u32 flags = 0;
+            if (i == 0)
+            {
+                flags |= chunk_start;
+            }
+            if (i == (chunk_size / block_size) - 1)
+            {
+                flags |= chunk_end;
+            }
+            cv = first_8(compress(cv, chunk + (i * block_size), chunk_counter, block_size, flags));
+        }
+        return cv;
+    }
+
+    // ### hash_chunks
+
+#if SNN_AVX2_ENABLED
+    namespace avx
+    {
+        inline __m256i rotr(const __m256i x, const int n) noexcept
+        {
+            return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+        }
+
+        inline void g(simd::vec256_array<16>& v, const usize a, const usize b, const usize c,
+                      const usize d, const __m256i x, const __m256i y) noexcept
+        {
+            __m256i& va = v.at(a, bounds::mask);
+            __m256i& vb = v.at(b, bounds::mask);
+            __m256i& vc = v.at(c, bounds::mask);
+            __m256i& vd = v.at(d, bounds::mask);
+
+            va = _mm256_add_epi32(_mm256_add_epi32(va, vb), x);
+            vd = rotr(_mm256_xor_si256(vd, va), 16);
+            vc = _mm256_add_epi32(vc, vd);
+            vb = rotr(_mm256_xor_si256(vb, vc), 12);
+            va = _mm256_add_epi32(_mm256_add_epi32(va, vb), y);
+            vd = rotr(_mm256_xor_si256(vd, va), 8);
+            vc = _mm256_add_epi32(vc, vd);
+            vb = rotr(_mm256_xor_si256(vb, vc), 7);
+        }
+
+        // Transpose an 8x8 matrix of 32-bit words (rows to columns).
+        inline void transpose(__m256i* const m) noexcept
+        {
+            const __m256i t0 = _mm256_unpacklo_epi32(m[0], m[1]);
+            const __m256i t1 = _mm256_unpackhi_epi32(m[0], m[1]);
+            const __m256i t2 = _mm256_unpacklo_epi32(m[2], m[3]);
+            const __m256i t3 = _mm256_unpackhi_epi32(m[2], m[3]);
+            const __m256i t4 = _mm256_unpacklo_epi32(m[4], m[5]);
+            const __m256i t5 = _mm256_unpackhi_epi32(m[4], m[5]);
+            const __m256i t6 = _mm256_unpacklo_epi32(m[6], m[7]);
+            const __m256i t7 = _mm256_unpackhi_epi32(m[6], m[7]);
+
+            const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+            const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+            const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+            const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+            const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+            const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+            const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+            const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+            m[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+            m[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+            m[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+            m[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+            m[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+            m[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+            m[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+            m[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+        }
+
+        // Hash 8 consecutive full chunks, one chunk per 32-bit lane.
+        inline void hash_chunks_x8(const char* const chunks, const u64 chunk_counter,
+                                   array<array<u32, 8>, 8>& cvs) noexcept
+        {
+            simd::vec256_array<8> h;
+            for (usize i = 0; i < 8; ++i)
+            {
+                h.at(i, bounds::mask) =
+                    _mm256_set1_epi32(static_cast<int>(iv.at(i, bounds::mask)));
+            }
+
+            array<u32, 8> counter_low;
+            array<u32, 8> counter_high;
+            for (usize lane = 0; lane < 8; ++lane)
+            {
+                const u64 counter               = chunk_counter + lane;
+                counter_low.at(lane, bounds::mask)  = static_cast<u32>(counter);
+                counter_high.at(lane, bounds::mask) = static_cast<u32>(counter >> 32u);
+            }
+            const __m256i counter_low_v =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counter_low.begin()));
+            const __m256i counter_high_v =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counter_high.begin()));
+
+            for (usize block = 0; block < (chunk_size / block_size); ++block)
+            {
+                // Message words, transposed: `m[i]` holds word `i` of all 8 lanes.
+                simd::vec256_array<16> m;
+                for (usize half = 0; half < 2; ++half)
+                {
+                    for (usize lane = 0; lane < 8; ++lane)
+                    {
+                        m.at((half * 8) + lane, bounds::mask) =
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                                chunks + (lane * chunk_size) + (block * block_size) +
+                                (half * 32)));
+                    }
+                    transpose(m.begin() + (half * 8));
+                }
+
+                u32 flags = 0;
+                if (block == 0)
+                {
+                    flags |= chunk_start;
+                }
+                if (block == (chunk_size / block_size) - 1)
+                {
+                    flags |= chunk_end;
+                }
+
+                simd::vec256_array<16> v{
+                    h.at(0, bounds::mask),
+                    h.at(1, bounds::mask),
+                    h.at(2, bounds::mask),
+                    h.at(3, bounds::mask),
+                    h.at(4, bounds::mask),
+                    h.at(5, bounds::mask),
+                    h.at(6, bounds::mask),
+                    h.at(7, bounds::mask),
+                    _mm256_set1_epi32(static_cast<int>(iv.at(0, bounds::mask))),
+                    _mm256_set1_epi32(static_cast<int>(iv.at(1, bounds::mask))),
+                    _mm256_set1_epi32(static_cast<int>(iv.at(2, bounds::mask))),
+                    _mm256_set1_epi32(static_cast<int>(iv.at(3, bounds::mask))),
+                    counter_low_v,
+                    counter_high_v,
+                    _mm256_set1_epi32(static_cast<int>(block_size)),
+                    _mm256_set1_epi32(static_cast<int>(flags)),
+                };
+
+                for (const auto& s : schedule)
+                {
+                    const auto msg = [&m, &s](const usize i) {
+                        return m.at(s.at(i, bounds::mask), bounds::mask);
+                    };
+
+                    g(v, 0, 4, 8, 12, msg(0), msg(1));
+                    g(v, 1, 5, 9, 13, msg(2), msg(3));
+                    g(v, 2, 6, 10, 14, msg(4), msg(5));
+                    g(v, 3, 7, 11, 15, msg(6), msg(7));
+
+                    g(v, 0, 5, 10, 15, msg(8), msg(9));
+                    g(v, 1, 6, 11, 12, msg(10), msg(11));
+                    g(v, 2, 7, 8, 13, msg(12), msg(13));
+                    g(v, 3, 4, 9, 14, msg(14), msg(15));
+                }
+
+                for (usize i = 0; i < 8; ++i)
+                {
+                    h.at(i, bounds::mask) =
+                        _mm256_xor_si256(v.at(i, bounds::mask), v.at(i + 8, bounds::mask));
+                }
+            }
+
+            transpose(h.begin());
+            for (usize lane = 0; lane < 8; ++lane)
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(cvs.at(lane, bounds::mask).begin()),
+                                    h.at(lane, bounds::mask));
+            }
+        }
+    }
+#endif
+
+    // Hash `count` consecutive full (non-root) chunks, writes one chaining value per chunk.
+    inline void hash_chunks(const char* chunks, usize count, u64 chunk_counter,
+                            array<u32, 8>* cvs) noexcept
+    {
+#if SNN_AVX2_ENABLED
+        while (count >= 8)
+        {
+            array<array<u32, 8>, 8> cvs_x8;
+            avx::hash_chunks_x8(chunks, chunk_counter, cvs_x8);
+            for (usize lane = 0; lane < 8; ++lane)
+            {
+                cvs[lane] = cvs_x8.at(lane, bounds::mask);
+            }
+            chunks += 8 * chunk_size;
+            count -= 8;
+            chunk_counter += 8;
+            cvs += 8;
+        }
+#endif
+        while (count > 0)
+        {
+            *cvs = hash_chunk(chunks, chunk_counter);
+            chunks += chunk_size;
+            --count;
+            ++chunk_counter;
+            ++cvs;
+        }
+    }
+
+    // ### chunk_cv
+
+    // Chaining value of a (non-root) chunk of 1-1024 bytes.
+    [[nodiscard]] constexpr array<u32, 8> chunk_cv(const char* data, usize size,
+                                                   const u64 chunk_counter) noexcept
+    {
+        snn_should(size > 0 && size <= chunk_size);
+
+        array<u32, 8> cv = iv;
+        u32 flags        = chunk_start;
+        while (size > block_size)
+        {
+            cv = first_8(compress(cv, data, chunk_counter, block_size, flags));
+            flags = 0;
+            data += block_size;
+            size -= block_size;
+        }
+
+        array<char, block_size> block{};
+        for (usize i = 0; i < size; ++i)
+        {
+            block.at(i, assume::within_bounds) = data[i];
+        }
+        return first_8(compress(cv, block.begin(), chunk_counter, static_cast<u32>(size),
+                                flags | chunk_end));
+    }
+
+    // ### Tree nodes
+
+    [[nodiscard]] constexpr array<char, block_size> parent_block(
+        const array<u32, 8>& left, const array<u32, 8>& right) noexcept
+    {
+        array<char, block_size> block;
+        for (usize i = 0; i < 8; ++i)
+        {
+            store_le(left.at(i, bounds::mask), block.begin() + (i * 4));
+            store_le(right.at(i, bounds::mask), block.begin() + 32 + (i * 4));
+        }
+        return block;
+    }
+
+    [[nodiscard]] constexpr array<u32, 8> parent_cv(const array<u32, 8>& left,
+                                                    const array<u32, 8>& right) noexcept
+    {
+        const array<char, block_size> block = parent_block(left, right);
+        return first_8(compress(iv, block.begin(), 0, block_size, parent));
+    }
+
+    // Write the root output (32 bytes) of a compression that was deferred with its flags.
+    constexpr void root_output(const array<u32, 8>& cv, const char* const block,
+                               const u32 block_len, const u32 flags, char* const out) noexcept
+    {
+        const array<u32, 16> v = compress(cv, block, 0, block_len, flags | root);
+        for (usize i = 0; i < 8; ++i)
+        {
+            store_le(v.at(i, bounds::mask), out + (i * 4));
+        }
+    }
+
+    // ### cv_stack
+
+    // Chaining values of completed subtrees, merged as chunks are added.
+
+    class cv_stack final
+    {
+      public:
+        constexpr cv_stack() noexcept = default;
+
+        [[nodiscard]] constexpr usize count() const noexcept
+        {
+            return count_;
+        }
+
+        // Add the chaining value of a chunk, `total_chunks` is the number of chunks added so
+        // far (including this one). Completed subtrees are merged, one per trailing zero bit.
+        constexpr void push(array<u32, 8> cv, u64 total_chunks) noexcept
+        {
+            while ((total_chunks & 1) == 0)
+            {
+                cv = parent_cv(pop(), cv);
+                total_chunks >>= 1u;
+            }
+            snn_should(count_ < cvs_.count());
+            cvs_.at(count_, assume::within_bounds) = cv;
+            ++count_;
+        }
+
+        [[nodiscard]] constexpr array<u32, 8> pop() noexcept
+        {
+            snn_should(count_ > 0);
+            --count_;
+            return cvs_.at(count_, assume::within_bounds);
+        }
+
+        // Merge all chaining values into one (a non-root node).
+        [[nodiscard]] constexpr array<u32, 8> merge() noexcept
+        {
+            array<u32, 8> cv = pop();
+            while (count_ > 0)
+            {
+                cv = parent_cv(pop(), cv);
+            }
+            return cv;
+        }
+
+        constexpr void clear() noexcept
+        {
+            count_ = 0;
+        }
+
+      private:
+        // Enough for 2^54 chunks (2^64 bytes).
+        array<array<u32, 8>, 54> cvs_{};
+        usize count_{0};
+    };
+
+    SNN_DIAGNOSTIC_POP
+}
@@ -0,0 +1,488 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # SHA-256 compression (portable, SHA-NI and 8-lane AVX2)
+
+// * `compress()`: One or more 64-byte blocks of a single message, with SHA-NI if enabled at
+//   compile time (and not constant evaluated), otherwise portable code.
+// * `compress_words()`: Same as `compress()` but one block of 16 words (no byte order
+//   conversion).
+// * `compress_x8()`: One block each of 8 independent messages (multi-buffer), AVX2 only.
+// * `hash_one()`: A complete message.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/array_view.hh"
+#include "snn-core/crypto/hash/detail/simd.hh"
+#include <bit> // rotr
+#if SNN_SSE2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::crypto::hash::detail::sha256
+{
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+    // ## Constants
+
+    inline constexpr usize block_size  = 64;
+    inline constexpr usize output_size = 32;
+
+    // clang-format off
+    inline constexpr array<u32, 8> initial_state{
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    inline constexpr array<u32, 64> k{
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    };
+    // clang-format on
+
+    // ## Functions
+
+    [[nodiscard]] constexpr u32 load_be(const char* const data) noexcept
+    {
+        return (u32{to_byte(data[0])} << 24u) | (u32{to_byte(data[1])} << 16u) |
+               (u32{to_byte(data[2])} << 8u) | u32{to_byte(data[3])};
+    }
+
+    constexpr void store_be(const u32 w, char* const data) noexcept
+    {
+        data[0] = static_cast<char>(w >> 24u);
+        data[1] = static_cast<char>(w >> 16u);
+        data[2] = static_cast<char>(w >> 8u);
+        data[3] = static_cast<char>(w);
+    }
+
+    // ### compress_portable
+
+    // The first 16 words of `w` must be set, the rest is overwritten (message schedule).
+    constexpr void compress_words_portable(array<u32, 8>& state, array<u32, 64>& w) noexcept
+    {
+        for (usize i = 16; i < 64; ++i)
+        {
+            const u32 w15 = w.at(i - 15, assume::within_bounds);
+            const u32 w2  = w.at(i - 2, assume::within_bounds);
+            const u32 s0  = std::rotr(w15, 7) ^ std::rotr(w15, 18) ^ (w15 >> 3u);
+            const u32 s1  = std::rotr(w2, 17) ^ std::rotr(w2, 19) ^ (w2 >> 10u);
+            w.at(i, assume::within_bounds) = w.at(i - 16, assume::within_bounds) + s0 +
+                                             w.at(i - 7, assume::within_bounds) + s1;
+        }
+
+        u32 a = state.at(0, bounds::mask);
+        u32 b = state.at(1, bounds::mask);
+        u32 c = state.at(2, bounds::mask);
+        u32 d = state.at(3, bounds::mask);
+        u32 e = state.at(4, bounds::mask);
+        u32 f = state.at(5, bounds::mask);
+        u32 g = state.at(6, bounds::mask);
+        u32 h = state.at(7, bounds::mask);
+
+        for (usize i = 0; i < 64; ++i)
+        {
+            const u32 s1    = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+            const u32 ch    = (e & f) ^ (~e & g);
+            const u32 temp1 = h + s1 + ch + k.at(i, bounds::mask) + w.at(i, bounds::mask);
+            const u32 s0    = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+            const u32 maj   = (a & b) ^ (a & c) ^ (b & c);
+            const u32 temp2 = s0 + maj;
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + temp1;
+            d = c;
+            c = b;
+            b = a;
+            a = temp1 + temp2;
+        }
+
+        state.at(0, bounds::mask) += a;
+        state.at(1, bounds::mask) += b;
+        state.at(2, bounds::mask) += c;
+        state.at(3, bounds::mask) += d;
+        state.at(4, bounds::mask) += e;
+        state.at(5, bounds::mask) += f;
+        state.at(6, bounds::mask) += g;
+        state.at(7, bounds::mask) += h;
+    }
+
+    constexpr void compress_portable(array<u32, 8>& state, const char* data,
+                                     usize block_count) noexcept
+    {
+        while (block_count > 0)
+        {
+            array<u32, 64> w;
+            for (usize i = 0; i < 16; ++i)
+            {
+                w.at(i, assume::within_bounds) = load_be(data + (i * 4));
+            }
+            compress_words_portable(state, w);
+
+            data += block_size;
+            --block_count;
+        }
+    }
+
+    // ### compress_shani
+
+#if SNN_SHA_ENABLED
+    // Based on the public domain SHA-NI code by Sean Gulley (Intel) and Jeffrey Walton.
+
+    namespace shani
+    {
+        // The state in the layout used by the SHA instructions.
+        struct state final
+        {
+            __m128i abef;
+            __m128i cdgh;
+        };
+
+        [[nodiscard]] inline state load(const array<u32, 8>& st) noexcept
+        {
+            __m128i tmp  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(st.begin()));
+            __m128i efgh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(st.begin() + 4));
+            tmp          = _mm_shuffle_epi32(tmp, 0xb1);  // CDAB
+            efgh         = _mm_shuffle_epi32(efgh, 0x1b); // EFGH
+            return state{_mm_alignr_epi8(tmp, efgh, 8), _mm_blend_epi16(efgh, tmp, 0xf0)};
+        }
+
+        // Returns the words in order: A-D and E-H (also usable as message words).
+        [[nodiscard]] inline simd::vec128_array<2> words(const state st) noexcept
+        {
+            const __m128i feba = _mm_shuffle_epi32(st.abef, 0x1b);
+            const __m128i dchg = _mm_shuffle_epi32(st.cdgh, 0xb1);
+            return simd::vec128_array<2>{_mm_blend_epi16(feba, dchg, 0xf0),
+                                         _mm_alignr_epi8(dchg, feba, 8)};
+        }
+
+        inline void store(const state st, array<u32, 8>& out) noexcept
+        {
+            const simd::vec128_array<2> w = words(st);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out.begin()), w.at(0, bounds::mask));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out.begin() + 4), w.at(1, bounds::mask));
+        }
+
+        // One block, `msg` is the 16 message words (native byte order).
+        [[nodiscard]] inline state compress(const state st, simd::vec128_array<4> msg) noexcept
+        {
+            __m128i state0 = st.abef;
+            __m128i state1 = st.cdgh;
+
+            // 16 groups of 4 rounds, the message schedule is computed 4 words at a time in the
+            // 4 rotating message registers.
+            for (usize i = 0; i < 16; ++i)
+            {
+                const __m128i cur = msg.at(i, bounds::mask);
+
+                __m128i m = _mm_add_epi32(
+                    cur, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k.begin() + (i * 4))));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, m);
+
+                if (i >= 3 && i < 15)
+                {
+                    __m128i& next   = msg.at(i + 1, bounds::mask);
+                    const __m128i t = _mm_alignr_epi8(cur, msg.at(i + 3, bounds::mask), 4);
+                    next            = _mm_sha256msg2_epu32(_mm_add_epi32(next, t), cur);
+                }
+
+                m      = _mm_shuffle_epi32(m, 0x0e);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, m);
+
+                if (i >= 1 && i < 13)
+                {
+                    __m128i& prev = msg.at(i + 3, bounds::mask);
+                    prev          = _mm_sha256msg1_epu32(prev, cur);
+                }
+            }
+
+            return state{_mm_add_epi32(state0, st.abef), _mm_add_epi32(state1, st.cdgh)};
+        }
+    }
+
+    // `data` is big-endian if `ByteSwap` is true, otherwise native 32-bit words.
+    template <bool ByteSwap = true>
+    void compress_shani(array<u32, 8>& state, const char* data, usize block_count) noexcept
+    {
+    #if SNN_AVX2_ENABLED
+        // The SHA instructions are SSE-encoded, avoid the AVX-SSE transition penalty.
+        _mm256_zeroupper();
+    #endif
+
+        const __m128i byteswap_mask =
+            _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+        shani::state st = shani::load(state);
+
+        while (block_count > 0)
+        {
+            simd::vec128_array<4> msg;
+            for (usize i = 0; i < 4; ++i)
+            {
+                msg.at(i, bounds::mask) =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + (i * 16)));
+                if constexpr (ByteSwap)
+                {
+                    msg.at(i, bounds::mask) =
+                        _mm_shuffle_epi8(msg.at(i, bounds::mask), byteswap_mask);
+                }
+            }
+
+            st = shani::compress(st, msg);
+
+            data += block_size;
+            --block_count;
+        }
+
+        shani::store(st, state);
+    }
+#endif
+
+    // ### compress
+
+    constexpr void compress(array<u32, 8>& state, const char* const data,
+                            const usize block_count) noexcept
+    {
+#if SNN_SHA_ENABLED
+        if (!std::is_constant_evaluated())
+        {
+            compress_shani(state, data, block_count);
+            return;
+        }
+#endif
+        compress_portable(state, data, block_count);
+    }
+
+    // One block as 16 (native) words.
+    constexpr void compress_words(array<u32, 8>& state, const array<u32, 16>& words) noexcept
+    {
+#if SNN_SHA_ENABLED
+        if (!std::is_constant_evaluated())
+        {
+            compress_shani<false>(state, reinterpret_cast<const char*>(words.begin()), 1);
+            return;
+        }
+#endif
+        array<u32, 64> w;
+        for (usize i = 0; i < 16; ++i)
+        {
+            w.at(i, bounds::mask) = words.at(i, bounds::mask);
+        }
+        compress_words_portable(state, w);
+    }
+
+    // ### compress_x8
+
+#if SNN_AVX2_ENABLED
+    namespace avx
+    {
+        inline __m256i rotr(const __m256i x, const int n) noexcept
+        {
+            return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+        }
+
+        inline __m256i add(const __m256i a, const __m256i b) noexcept
+        {
+            return _mm256_add_epi32(a, b);
+        }
+
+        // Transpose an 8x8 matrix of 32-bit words (rows to columns).
+        inline void transpose(simd::vec256_array<8>& m) noexcept
+        {
+            const __m256i t0 = _mm256_unpacklo_epi32(m.at(0, bounds::mask), m.at(1, bounds::mask));
+            const __m256i t1 = _mm256_unpackhi_epi32(m.at(0, bounds::mask), m.at(1, bounds::mask));
+            const __m256i t2 = _mm256_unpacklo_epi32(m.at(2, bounds::mask), m.at(3, bounds::mask));
+            const __m256i t3 = _mm256_unpackhi_epi32(m.at(2, bounds::mask), m.at(3, bounds::mask));
+            const __m256i t4 = _mm256_unpacklo_epi32(m.at(4, bounds::mask), m.at(5, bounds::mask));
+            const __m256i t5 = _mm256_unpackhi_epi32(m.at(4, bounds::mask), m.at(5, bounds::mask));
+            const __m256i t6 = _mm256_unpacklo_epi32(m.at(6, bounds::mask), m.at(7, bounds::mask));
+            const __m256i t7 = _mm256_unpackhi_epi32(m.at(6, bounds::mask), m.at(7, bounds::mask));
+
+            const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+            const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+            const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+            const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+            const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+            const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+            const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+            const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+            m.at(0, bounds::mask) = _mm256_permute2x128_si256(u0, u4, 0x20);
+            m.at(1, bounds::mask) = _mm256_permute2x128_si256(u1, u5, 0x20);
+            m.at(2, bounds::mask) = _mm256_permute2x128_si256(u2, u6, 0x20);
+            m.at(3, bounds::mask) = _mm256_permute2x128_si256(u3, u7, 0x20);
+            m.at(4, bounds::mask) = _mm256_permute2x128_si256(u0, u4, 0x31);
+            m.at(5, bounds::mask) = _mm256_permute2x128_si256(u1, u5, 0x31);
+            m.at(6, bounds::mask) = _mm256_permute2x128_si256(u2, u6, 0x31);
+            m.at(7, bounds::mask) = _mm256_permute2x128_si256(u3, u7, 0x31);
+        }
+    }
+
+    // The state and the message words are transposed: `state[i]` holds word `i` of all 8 lanes
+    // and so does `w[i]`. Only the first 16 message words are read, the rest is overwritten.
+    inline void compress_x8_words(simd::vec256_array<8>& state,
+                                  simd::vec256_array<64>& w) noexcept
+    {
+        for (usize i = 16; i < 64; ++i)
+        {
+            const __m256i w15 = w.at(i - 15, assume::within_bounds);
+            const __m256i w2  = w.at(i - 2, assume::within_bounds);
+            const __m256i s0  = _mm256_xor_si256(
+                _mm256_xor_si256(avx::rotr(w15, 7), avx::rotr(w15, 18)), _mm256_srli_epi32(w15, 3));
+            const __m256i s1 = _mm256_xor_si256(
+                _mm256_xor_si256(avx::rotr(w2, 17), avx::rotr(w2, 19)), _mm256_srli_epi32(w2, 10));
+            w.at(i, assume::within_bounds) =
+                avx::add(avx::add(w.at(i - 16, assume::within_bounds), s0),
+                         avx::add(w.at(i - 7, assume::within_bounds), s1));
+        }
+
+        __m256i a = state.at(0, bounds::mask);
+        __m256i b = state.at(1, bounds::mask);
+        __m256i c = state.at(2, bounds::mask);
+        __m256i d = state.at(3, bounds::mask);
+        __m256i e = state.at(4, bounds::mask);
+        __m256i f = state.at(5, bounds::mask);
+        __m256i g = state.at(6, bounds::mask);
+        __m256i h = state.at(7, bounds::mask);
+
+        for (usize i = 0; i < 64; ++i)
+        {
+            const __m256i s1 = _mm256_xor_si256(
+                _mm256_xor_si256(avx::rotr(e, 6), avx::rotr(e, 11)), avx::rotr(e, 25));
+            const __m256i ch =
+                _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+            const __m256i temp1 = avx::add(
+                avx::add(avx::add(h, s1), ch),
+                avx::add(_mm256_set1_epi32(static_cast<int>(k.at(i, bounds::mask))),
+                         w.at(i, bounds::mask)));
+            const __m256i s0 = _mm256_xor_si256(
+                _mm256_xor_si256(avx::rotr(a, 2), avx::rotr(a, 13)), avx::rotr(a, 22));
+            const __m256i maj = _mm256_xor_si256(
+                _mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(a, c)),
+                _mm256_and_si256(b, c));
+            const __m256i temp2 = avx::add(s0, maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = avx::add(d, temp1);
+            d = c;
+            c = b;
+            b = a;
+            a = avx::add(temp1, temp2);
+        }
+
+        state.at(0, bounds::mask) = avx::add(state.at(0, bounds::mask), a);
+        state.at(1, bounds::mask) = avx::add(state.at(1, bounds::mask), b);
+        state.at(2, bounds::mask) = avx::add(state.at(2, bounds::mask), c);
+        state.at(3, bounds::mask) = avx::add(state.at(3, bounds::mask), d);
+        state.at(4, bounds::mask) = avx::add(state.at(4, bounds::mask), e);
+        state.at(5, bounds::mask) = avx::add(state.at(5, bounds::mask), f);
+        state.at(6, bounds::mask) = avx::add(state.at(6, bounds::mask), g);
+        state.at(7, bounds::mask) = avx::add(state.at(7, bounds::mask), h);
+    }
+
+    // The state is transposed: `state[i]` holds word `i` of all 8 lanes. `blocks[lane]` points
+    // to the 64-byte block of each lane.
+    inline void compress_x8(simd::vec256_array<8>& state,
+                            const array<const char*, 8>& blocks) noexcept
+    {
+        const __m256i byteswap_mask = _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, //
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+        simd::vec256_array<64> w;
+        for (usize half = 0; half < 2; ++half)
+        {
+            simd::vec256_array<8> m;
+            for (usize lane = 0; lane < 8; ++lane)
+            {
+                m.at(lane, bounds::mask) = _mm256_shuffle_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                        blocks.at(lane, bounds::mask) + (half * 32))),
+                    byteswap_mask);
+            }
+            avx::transpose(m);
+            for (usize i = 0; i < 8; ++i)
+            {
+                w.at((half * 8) + i, assume::within_bounds) = m.at(i, bounds::mask);
+            }
+        }
+
+        compress_x8_words(state, w);
+    }
+#endif
+
+    // ### pad
+
+    // Write the final block(s) of a message: the remaining bytes (less than a block), 0x80, zeros
+    // and the message size in bits (big-endian). Returns the number of blocks written (1 or 2).
+
+    constexpr usize pad(const char* const remaining, const usize remaining_size,
+                        const u64 message_size, array<char, block_size * 2>& blocks) noexcept
+    {
+        snn_should(remaining_size < block_size);
+
+        blocks.fill('\0');
+        for (usize i = 0; i < remaining_size; ++i)
+        {
+            blocks.at(i, assume::within_bounds) = remaining[i];
+        }
+        blocks.at(remaining_size, assume::within_bounds) = static_cast<char>(0x80);
+
+        const usize block_count = (remaining_size + 1 + 8) > block_size ? 2 : 1;
+        const u64 bit_size      = message_size * 8;
+        char* const end         = blocks.begin() + (block_count * block_size);
+        store_be(static_cast<u32>(bit_size >> 32u), end - 8);
+        store_be(static_cast<u32>(bit_size), end - 4);
+
+        return block_count;
+    }
+
+    // ### digest
+
+    constexpr void digest(const array<u32, 8>& state, char* const out) noexcept
+    {
+        for (usize i = 0; i < 8; ++i)
+        {
+            store_be(state.at(i, bounds::mask), out + (i * 4));
+        }
+    }
+
+    // ### hash_one
+
+    constexpr void hash_one(const cstrview message, array<char, output_size>& digest) noexcept
+    {
+        array<u32, 8> state     = initial_state;
+        const usize block_count = message.size() / block_size;
+        compress(state, message.begin(), block_count);
+
+        array<char, block_size * 2> blocks;
+        const usize tail_size  = message.size() - (block_count * block_size);
+        const usize tail_count = pad(message.begin() + (block_count * block_size), tail_size,
+                                     message.size(), blocks);
+        compress(state, blocks.begin(), tail_count);
+
+        detail::sha256::digest(state, digest.begin());
+    }
+
+    SNN_DIAGNOSTIC_POP
+}
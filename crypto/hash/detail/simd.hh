@@ -0,0 +1,105 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Fixed-size arrays of SIMD vectors
+
+// `array<__m128i, N>` and `array<__m256i, N>` ignore the attributes of the vector types
+// (-Wignored-attributes). These are plain arrays in a struct templated only on the count, with the
+// subset of the `array` interface used by the SIMD hash code.
+
+#pragma once
+
+#include "snn-core/core.hh"
+#if SNN_SSE2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::crypto::hash::detail::simd
+{
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+#if SNN_SSE2_ENABLED
+
+    // ## vec128_array
+
+    template <usize Count>
+        requires(power_of_two<Count>)
+    struct vec128_array final
+    {
+        // "Private" buffer, should never be accessed directly.
+        __m128i priv_buf_[Count]{};
+
+        [[nodiscard]] __m128i& at(const usize pos, assume::within_bounds_t) noexcept
+        {
+            snn_assert(pos < Count);
+            return priv_buf_[pos];
+        }
+
+        [[nodiscard]] const __m128i& at(const usize pos, assume::within_bounds_t) const noexcept
+        {
+            snn_assert(pos < Count);
+            return priv_buf_[pos];
+        }
+
+        [[nodiscard]] __m128i& at(const usize pos, bounds::mask_t) noexcept
+        {
+            return priv_buf_[pos & (Count - 1)];
+        }
+
+        [[nodiscard]] const __m128i& at(const usize pos, bounds::mask_t) const noexcept
+        {
+            return priv_buf_[pos & (Count - 1)];
+        }
+
+        [[nodiscard]] __m128i* begin() noexcept
+        {
+            return priv_buf_;
+        }
+    };
+
+#endif
+
+#if SNN_AVX2_ENABLED
+
+    // ## vec256_array
+
+    template <usize Count>
+        requires(power_of_two<Count>)
+    struct vec256_array final
+    {
+        // "Private" buffer, should never be accessed directly.
+        __m256i priv_buf_[Count]{};
+
+        [[nodiscard]] __m256i& at(const usize pos, assume::within_bounds_t) noexcept
+        {
+            snn_assert(pos < Count);
+            return priv_buf_[pos];
+        }
+
+        [[nodiscard]] const __m256i& at(const usize pos, assume::within_bounds_t) const noexcept
+        {
+            snn_assert(pos < Count);
+            return priv_buf_[pos];
+        }
+
+        [[nodiscard]] __m256i& at(const usize pos, bounds::mask_t) noexcept
+        {
+            return priv_buf_[pos & (Count - 1)];
+        }
+
+        [[nodiscard]] const __m256i& at(const usize pos, bounds::mask_t) const noexcept
+        {
+            return priv_buf_[pos & (Count - 1)];
+        }
+
+        [[nodiscard]] __m256i* begin() noexcept
+        {
+            return priv_buf_;
+        }
+    };
+
+#endif
+
+    SNN_DIAGNOSTIC_POP
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// Used instead of BearSSL (which has no hardware acceleration) when SHA-NI is enabled at compile
+// time.
+
+#pragma once
+
+#include "snn-core/crypto/hash/base.hh"
+#include "snn-core/crypto/hash/detail/sha256.hh"
+#include "snn-core/mem/raw/copy.hh"
+
+namespace snn::crypto::hash
+{
+    class sha256 final : public base<sha256, detail::sha256::output_size>
+    {
+      public:
+        static constexpr usize block_size  = detail::sha256::block_size;
+        static constexpr usize output_size = detail::sha256::output_size;
+
+        sha256() noexcept
+        {
+            init_();
+        }
+
+      private:
+        friend class base<sha256, output_size>;
+
+        array<u32, 8> state_;
+        array<char, block_size> buffer_;
+        usize buffer_size_;
+        u64 message_size_;
+
+        void init_() noexcept
+        {
+            state_        = detail::sha256::initial_state;
+            buffer_size_  = 0;
+            message_size_ = 0;
+        }
+
+        template <usize Count>
+            requires(Count >= output_size && Count != constant::dynamic_count)
+        void final_(array_view<char, Count> digest) noexcept
+        {
+            array<char, block_size * 2> blocks;
+            const usize block_count = detail::sha256::pad(buffer_.begin(), buffer_size_,
+                                                          message_size_, blocks);
+            detail::sha256::compress(state_, blocks.begin(), block_count);
+            detail::sha256::digest(state_, digest.begin());
+        }
+
+        void update_(cstrview string) noexcept
+        {
+            message_size_ += string.size();
+
+            if (buffer_size_ > 0)
+            {
+                const usize size = math::min(block_size - buffer_size_, string.size());
+                mem::raw::copy(string.data(), not_null{buffer_.begin() + buffer_size_},
+                               byte_size{size}, assume::no_overlap);
+                buffer_size_ += size;
+                string.drop_front_n(size);
+
+                if (buffer_size_ < block_size)
+                {
+                    return;
+                }
+
+                detail::sha256::compress(state_, buffer_.begin(), 1);
+                buffer_size_ = 0;
+            }
+
+            const usize block_count = string.size() / block_size;
+            if (block_count > 0)
+            {
+                detail::sha256::compress(state_, string.begin(), block_count);
+                string.drop_front_n(block_count * block_size);
+            }
+
+            mem::raw::copy(string.data(), buffer_.writable(), string.byte_size(),
+                           assume::no_overlap);
+            buffer_size_ = string.size();
+        }
+    };
+}
@@ -5,7 +5,11 @@
 
 #pragma once
 
-#if defined(SNN_BEARSSL_HASH)
+#include "snn-core/core.hh"
+
+#if defined(SNN_BEARSSL_HASH) && SNN_SHA_ENABLED
+    #include "snn-core/crypto/hash/impl/sha256.native.hh"
+#elif defined(SNN_BEARSSL_HASH)
     #include "snn-core/crypto/hash/impl/sha256.bearssl.hh"
 #else
     #include "snn-core/crypto/hash/impl/sha256.openssl.hh"
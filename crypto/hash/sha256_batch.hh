@@ -0,0 +1,139 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # SHA-256 of many independent messages
+
+// Hash many (typically small) messages at once. With AVX2 the messages are hashed 8 at a time,
+// one message per 32-bit lane (multi-buffer), otherwise one at a time (with SHA-NI if enabled).
+// Works best when the messages in each group of 8 have about the same size.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/array_view.hh"
+#include "snn-core/crypto/hash/detail/sha256.hh"
+#include "snn-core/crypto/hash/detail/simd.hh"
+#include "snn-core/math/common.hh"
+
+namespace snn::crypto::hash
+{
+    namespace detail::sha256
+    {
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+#if SNN_AVX2_ENABLED
+        // Hash 1-8 messages in parallel, unused lanes hash an empty message.
+        inline void hash_x8(const cstrview* const messages, const usize count,
+                            array<char, output_size>* const digests) noexcept
+        {
+            snn_should(count > 0 && count <= 8);
+
+            struct lane_info final
+            {
+                const char* data;
+                usize full_count;
+                usize total_count;
+            };
+
+            array<array<char, block_size * 2>, 8> tails;
+            array<lane_info, 8> lanes;
+            usize max_count = 0;
+            for (usize lane = 0; lane < 8; ++lane)
+            {
+                const cstrview message = lane < count ? messages[lane] : cstrview{};
+                const usize full_count = message.size() / block_size;
+                const usize tail_size  = message.size() - (full_count * block_size);
+                const usize tail_count =
+                    pad(message.begin() + (full_count * block_size), tail_size, message.size(),
+                        tails.at(lane, bounds::mask));
+
+                lanes.at(lane, bounds::mask) =
+                    lane_info{message.begin(), full_count, full_count + tail_count};
+                max_count = math::max(max_count, full_count + tail_count);
+            }
+
+            detail::simd::vec256_array<8> state;
+            for (usize i = 0; i < 8; ++i)
+            {
+                state.at(i, bounds::mask) =
+                    _mm256_set1_epi32(static_cast<int>(initial_state.at(i, bounds::mask)));
+            }
+
+            array<const char*, 8> blocks;
+            for (usize b = 0; b < max_count; ++b)
+            {
+                for (usize lane = 0; lane < 8; ++lane)
+                {
+                    const lane_info& info = lanes.at(lane, bounds::mask);
+                    const char* block     = tails.at(lane, bounds::mask).begin();
+                    if (b < info.full_count)
+                    {
+                        block = info.data + (b * block_size);
+                    }
+                    else if (b < info.total_count)
+                    {
+                        block += (b - info.full_count) * block_size;
+                    }
+                    // Else: the lane is done, hash anything (the result is discarded).
+                    blocks.at(lane, bounds::mask) = block;
+                }
+
+                compress_x8(state, blocks);
+
+                // Extract the state of lanes that finished with this block.
+                detail::simd::vec256_array<8> lane_states;
+                bool transposed = false;
+                for (usize lane = 0; lane < count; ++lane)
+                {
+                    if (lanes.at(lane, bounds::mask).total_count == (b + 1))
+                    {
+                        if (!transposed)
+                        {
+                            lane_states = state;
+                            avx::transpose(lane_states);
+                            transposed = true;
+                        }
+
+                        array<u32, 8> lane_state;
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_state.begin()),
+                                            lane_states.at(lane, bounds::mask));
+                        detail::sha256::digest(lane_state, digests[lane].begin());
+                    }
+                }
+            }
+        }
+#endif
+
+        SNN_DIAGNOSTIC_POP
+    }
+
+    // ## Functions
+
+    // ### sha256_batch
+
+    // Write the SHA-256 digest of `messages[i]` to `digests[i]`. The counts must be equal.
+
+    inline void sha256_batch(const array_view<const cstrview> messages,
+                             array_view<array<char, detail::sha256::output_size>> digests)
+    {
+        snn_assert(messages.count() == digests.count());
+
+        usize i = 0;
+
+#if SNN_AVX2_ENABLED
+        while ((messages.count() - i) >= 2)
+        {
+            const usize count = math::min(messages.count() - i, usize{8});
+            detail::sha256::hash_x8(messages.begin() + i, count, digests.begin() + i);
+            i += count;
+        }
+#endif
+
+        for (; i < messages.count(); ++i)
+        {
+            detail::sha256::hash_one(messages.at(i, assume::within_bounds),
+                                     digests.at(i, assume::within_bounds));
+        }
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/crypto/hash/sha256_batch.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/hex/encode.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            const array<cstrview, 3> messages{"", "abc", "abcdbcdecdefdefgefghfghighijhijkijkljkl"
+                                                         "mklmnlmnomnopnopq"};
+            array<array<char, 32>, 3> digests;
+
+            crypto::hash::sha256_batch(messages.view(), digests.view());
+
+            snn_require(hex::encode(digests.at(0).value().view()) ==
+                        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+            snn_require(hex::encode(digests.at(1).value().view()) ==
+                        "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+            snn_require(hex::encode(digests.at(2).value().view()) ==
+                        "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+            return true;
+        }
+
+        constexpr bool test_constexpr()
+        {
+            array<char, 32> digest;
+            crypto::hash::detail::sha256::hash_one("abc", digest);
+            snn_require(digest.view() == "\xba\x78\x16\xbf\x8f\x01\xcf\xea\x41\x41\x40\xde\x5d"
+                                         "\xae\x22\x23\xb0\x03\x61\xa3\x96\x17\x7a\x9c\xb4\x10"
+                                         "\xff\x61\xf2\x00\x15\xad");
+            return true;
+        }
+
+        bool test_sizes()
+        {
+            // Messages of different sizes (0-299 bytes) in uneven groups.
+            const str data{init::fill, 300, 'x'};
+
+            for (usize message_count = 0; message_count < 20; ++message_count)
+            {
+                vec<cstrview> messages;
+                for (usize i = 0; i < message_count; ++i)
+                {
+                    const usize size = (i * 37 + message_count * 11) % 300;
+                    messages.append(data.view(0, size));
+                }
+
+                vec<array<char, 32>> digests;
+                for (usize i = 0; i < message_count; ++i)
+                {
+                    digests.append(array<char, 32>{});
+                }
+
+                crypto::hash::sha256_batch(messages.view(), digests.view());
+
+                for (usize i = 0; i < message_count; ++i)
+                {
+                    array<char, 32> expected;
+                    crypto::hash::detail::sha256::hash_one(messages.at(i).value(), expected);
+                    snn_require(digests.at(i).value() == expected);
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_static_require(app::test_constexpr());
+        snn_require(app::test_sizes());
+    }
+}
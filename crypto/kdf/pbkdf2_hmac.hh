@@ -17,6 +17,38 @@
 
 namespace snn::crypto::kdf
 {
+    namespace detail::pbkdf2
+    {
+        [[nodiscard]] constexpr error validate(const cstrview password, const cstrview salt,
+                                               const usize iteration_count) noexcept
+        {
+            // Arbitrary max password size.
+            if (password.size() > 4096)
+            {
+                return error::invalid_password_size;
+            }
+
+            // A 64-bit salt (8 bytes) is the absolute minimum to be considered unique.
+            // Arbitrary max salt size.
+            if (salt.size() < 8 || salt.size() > 32)
+            {
+                return error::invalid_salt_size;
+            }
+
+            // For the highest iteration count, `constant::limit<u32>::max` should be more than
+            // enough. On Intel Xeon CPU E5-1650 v2 @ 3.50GHz with SHA-256:
+            // 0.43 seconds/1 000 000 iterations, 4 294 967 295 iterations (u32 max) takes ~30
+            // minutes.
+
+            if (iteration_count < 1'000 || iteration_count > constant::limit<u32>::max)
+            {
+                return error::invalid_iteration_count;
+            }
+
+            return error::no_error;
+        }
+    }
+
     // ## Functions
 
     // ### pbkdf2_hmac
@@ -36,26 +68,10 @@ namespace snn::crypto::kdf
                                           const transient<cstrview> salt,
                                           const usize iteration_count)
     {
-        // Arbitrary max password size.
-        if (password.get().size() > 4096)
-        {
-            return error::invalid_password_size;
-        }
-
-        // A 64-bit salt (8 bytes) is the absolute minimum to be considered unique.
-        // Arbitrary max salt size.
-        if (salt.get().size() < 8 || salt.get().size() > 32)
-        {
-            return error::invalid_salt_size;
-        }
-
-        // For the highest iteration count, `constant::limit<u32>::max` should be more than enough.
-        // On Intel Xeon CPU E5-1650 v2 @ 3.50GHz with SHA-256:
-        // 0.43 seconds/1 000 000 iterations, 4 294 967 295 iterations (u32 max) takes ~30 minutes.
-
-        if (iteration_count < 1'000 || iteration_count > constant::limit<u32>::max)
+        const error e = detail::pbkdf2::validate(password.get(), salt.get(), iteration_count);
+        if (e != error::no_error)
         {
-            return error::invalid_iteration_count;
+            return e;
         }
 
         array<char, Hash::output_size> digest_one;
@@ -0,0 +1,548 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # PBKDF2-HMAC-SHA256
+
+// Same result as `pbkdf2_hmac<crypto::hash::sha256>`, but faster:
+// * The inner and outer HMAC states (after the ipad/opad block) are computed once, each
+//   iteration is then exactly two SHA-256 compressions (with SHA-NI if enabled).
+// * Derived keys longer than 32 bytes are supported, the blocks are derived in parallel (8 at a
+//   time with AVX2 and optionally on multiple threads).
+// * Many passwords can be derived or verified at once, 8 at a time with AVX2 (multi-buffer).
+
+// Parameter requirements are the same as for `pbkdf2_hmac`.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/array_view.hh"
+#include "snn-core/result.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/crypto/error.hh"
+#include "snn-core/crypto/hash/detail/sha256.hh"
+#include "snn-core/crypto/hash/detail/simd.hh"
+#include "snn-core/crypto/kdf/pbkdf2_hmac.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/raw/constant_time/is_equal.hh"
+#include <exception> // current_exception, exception_ptr, rethrow_exception
+#include <thread>    // thread
+
+namespace snn::crypto::kdf
+{
+    namespace detail::pbkdf2_hmac_sha256
+    {
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        namespace sha256 = crypto::hash::detail::sha256;
+        namespace simd   = crypto::hash::detail::simd;
+
+        inline constexpr usize output_size = sha256::output_size;
+
+        // The SHA-256 state after the ipad and opad blocks.
+        struct hmac_state final
+        {
+            array<u32, 8> inner;
+            array<u32, 8> outer;
+        };
+
+        [[nodiscard]] constexpr hmac_state precompute(const cstrview password) noexcept
+        {
+            array<char, sha256::block_size> key;
+            key.fill('\0');
+            if (password.size() <= key.size())
+            {
+                key.fill_front(password);
+            }
+            else
+            {
+                array<char, output_size> digest;
+                sha256::hash_one(password, digest);
+                key.fill_front(digest.view());
+            }
+
+            hmac_state st{sha256::initial_state, sha256::initial_state};
+            array<char, sha256::block_size> padding;
+
+            for (usize i = 0; i < padding.count(); ++i)
+            {
+                padding.at(i, bounds::mask) = static_cast<char>(key.at(i, bounds::mask) ^ 0x36);
+            }
+            sha256::compress(st.inner, padding.begin(), 1);
+
+            for (usize i = 0; i < padding.count(); ++i)
+            {
+                padding.at(i, bounds::mask) = static_cast<char>(key.at(i, bounds::mask) ^ 0x5c);
+            }
+            sha256::compress(st.outer, padding.begin(), 1);
+
+            return st;
+        }
+
+        // A block (as words) with a 32-byte message (words 0-7, set before each compression)
+        // that follows the ipad/opad block: 0x80, zeros and the total size in bits (64 + 32
+        // bytes).
+        [[nodiscard]] constexpr array<u32, 16> digest_words() noexcept
+        {
+            array<u32, 16> w;
+            w.fill(0u);
+            w.at(8, bounds::mask)  = 0x80000000;
+            w.at(15, bounds::mask) = (sha256::block_size + output_size) * 8;
+            return w;
+        }
+
+        // HMAC of a 32-byte message (a digest) given the inner state after the ipad block.
+        constexpr void set_message(array<u32, 16>& w, const array<u32, 8>& digest) noexcept
+        {
+            for (usize i = 0; i < 8; ++i)
+            {
+                w.at(i, bounds::mask) = digest.at(i, bounds::mask);
+            }
+        }
+
+        // U1 = HMAC(password, salt || INT_32_BE(block_index))
+        [[nodiscard]] constexpr array<u32, 8> first_iteration(const hmac_state& st,
+                                                              const cstrview salt,
+                                                              const u32 block_index) noexcept
+        {
+            snn_should(salt.size() <= 32);
+
+            array<char, sha256::block_size> message;
+            message.fill_front(salt);
+            sha256::store_be(block_index, message.begin() + salt.size());
+            const usize message_size = salt.size() + 4;
+
+            array<char, sha256::block_size * 2> blocks;
+            array<u32, 8> inner = st.inner;
+            sha256::compress(inner, blocks.begin(),
+                             sha256::pad(message.begin(), message_size,
+                                         sha256::block_size + message_size, blocks));
+
+            array<u32, 16> w = digest_words();
+            set_message(w, inner);
+            array<u32, 8> u = st.outer;
+            sha256::compress_words(u, w);
+            return u;
+        }
+
+        // A block to derive.
+        struct lane final
+        {
+            const hmac_state* st;
+            cstrview salt;
+            u32 block_index;
+            char* out;
+        };
+
+#if SNN_SHA_ENABLED
+        // Derive `Count` independent blocks, interleaved to hide the latency of the SHA
+        // instructions (each iteration depends on the previous).
+        template <usize Count>
+        void derive_blocks_shani(const lane* const lanes, const usize iteration_count) noexcept
+        {
+            namespace shani = sha256::shani;
+
+            array<shani::state, Count> inner;
+            array<shani::state, Count> outer;
+            array<shani::state, Count> u;
+            for (usize j = 0; j < Count; ++j)
+            {
+                const lane& l                      = lanes[j];
+                inner.at(j, assume::within_bounds) = shani::load(l.st->inner);
+                outer.at(j, assume::within_bounds) = shani::load(l.st->outer);
+                u.at(j, assume::within_bounds) =
+                    shani::load(first_iteration(*l.st, l.salt, l.block_index));
+            }
+            array<shani::state, Count> t = u;
+
+            // Message words 8-15 (see `digest_words()`).
+            const __m128i padding0 = _mm_set_epi32(0, 0, 0, static_cast<int>(0x80000000));
+            const __m128i padding1 =
+                _mm_set_epi32(static_cast<int>((sha256::block_size + output_size) * 8), 0, 0, 0);
+
+            for (usize i = 2; i <= iteration_count; ++i)
+            {
+                for (usize j = 0; j < Count; ++j)
+                {
+                    const simd::vec128_array<2> m =
+                        shani::words(u.at(j, assume::within_bounds));
+                    u.at(j, assume::within_bounds) = shani::compress(
+                        inner.at(j, assume::within_bounds),
+                        simd::vec128_array<4>{m.at(0, bounds::mask), m.at(1, bounds::mask),
+                                              padding0, padding1});
+                }
+                for (usize j = 0; j < Count; ++j)
+                {
+                    const simd::vec128_array<2> m =
+                        shani::words(u.at(j, assume::within_bounds));
+                    u.at(j, assume::within_bounds) = shani::compress(
+                        outer.at(j, assume::within_bounds),
+                        simd::vec128_array<4>{m.at(0, bounds::mask), m.at(1, bounds::mask),
+                                              padding0, padding1});
+                }
+                for (usize j = 0; j < Count; ++j)
+                {
+                    shani::state& tj = t.at(j, assume::within_bounds);
+                    tj.abef = _mm_xor_si128(tj.abef, u.at(j, assume::within_bounds).abef);
+                    tj.cdgh = _mm_xor_si128(tj.cdgh, u.at(j, assume::within_bounds).cdgh);
+                }
+            }
+
+            for (usize j = 0; j < Count; ++j)
+            {
+                array<u32, 8> words;
+                shani::store(t.at(j, assume::within_bounds), words);
+                sha256::digest(words, lanes[j].out);
+            }
+        }
+#endif
+
+        // T = U1 ^ U2 ^ ... ^ Uc
+        constexpr void derive_block(const hmac_state& st, const cstrview salt,
+                                    const u32 block_index, const usize iteration_count,
+                                    char* const out) noexcept
+        {
+            array<u32, 8> u = first_iteration(st, salt, block_index);
+            array<u32, 8> t = u;
+
+            array<u32, 16> w = digest_words();
+            for (usize i = 2; i <= iteration_count; ++i)
+            {
+                set_message(w, u);
+                array<u32, 8> inner = st.inner;
+                sha256::compress_words(inner, w);
+
+                set_message(w, inner);
+                u = st.outer;
+                sha256::compress_words(u, w);
+
+                for (usize j = 0; j < 8; ++j)
+                {
+                    t.at(j, bounds::mask) ^= u.at(j, bounds::mask);
+                }
+            }
+
+            sha256::digest(t, out);
+        }
+
+#if SNN_AVX2_ENABLED
+        [[nodiscard]] inline simd::vec256_array<8> transposed(
+            const array<array<u32, 8>, 8>& rows)
+        {
+            simd::vec256_array<8> m;
+            for (usize i = 0; i < 8; ++i)
+            {
+                m.at(i, bounds::mask) = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(rows.at(i, bounds::mask).begin()));
+            }
+            sha256::avx::transpose(m);
+            return m;
+        }
+
+        // Derive 1-8 independent blocks, one per 32-bit lane (all with the same iteration
+        // count). The message words are kept transposed between iterations, so each iteration
+        // is two 8-lane compressions without any loads or stores.
+        inline void derive_blocks_x8(const lane* const lanes, const usize count,
+                                     const usize iteration_count) noexcept
+        {
+            snn_should(count > 0 && count <= 8);
+
+            array<array<u32, 8>, 8> inner_rows;
+            array<array<u32, 8>, 8> outer_rows;
+            array<array<u32, 8>, 8> u_rows;
+            for (usize i = 0; i < 8; ++i)
+            {
+                // Unused lanes repeat the first lane (the result is discarded).
+                const lane& l                  = lanes[i < count ? i : 0];
+                inner_rows.at(i, bounds::mask) = l.st->inner;
+                outer_rows.at(i, bounds::mask) = l.st->outer;
+                u_rows.at(i, bounds::mask)     = first_iteration(*l.st, l.salt, l.block_index);
+            }
+
+            const simd::vec256_array<8> inner = transposed(inner_rows);
+            const simd::vec256_array<8> outer = transposed(outer_rows);
+            simd::vec256_array<8> u           = transposed(u_rows);
+            simd::vec256_array<8> t           = u;
+
+            simd::vec256_array<64> w;
+            w.at(8, bounds::mask) = _mm256_set1_epi32(static_cast<int>(0x80000000));
+            for (usize i = 9; i < 15; ++i)
+            {
+                w.at(i, bounds::mask) = _mm256_setzero_si256();
+            }
+            w.at(15, bounds::mask) =
+                _mm256_set1_epi32(static_cast<int>((sha256::block_size + output_size) * 8));
+
+            for (usize i = 2; i <= iteration_count; ++i)
+            {
+                simd::vec256_array<8> s = inner;
+                for (usize j = 0; j < 8; ++j)
+                {
+                    w.at(j, bounds::mask) = u.at(j, bounds::mask);
+                }
+                sha256::compress_x8_words(s, w);
+
+                u = outer;
+                for (usize j = 0; j < 8; ++j)
+                {
+                    w.at(j, bounds::mask) = s.at(j, bounds::mask);
+                }
+                sha256::compress_x8_words(u, w);
+
+                for (usize j = 0; j < 8; ++j)
+                {
+                    t.at(j, bounds::mask) =
+                        _mm256_xor_si256(t.at(j, bounds::mask), u.at(j, bounds::mask));
+                }
+            }
+
+            sha256::avx::transpose(t);
+            for (usize i = 0; i < count; ++i)
+            {
+                array<u32, 8> row;
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(row.begin()), t.at(i, bounds::mask));
+                sha256::digest(row, lanes[i].out);
+            }
+        }
+#endif
+
+        // Derive any number of blocks: 4 at a time interleaved with SHA-NI, 8 at a time with
+        // AVX2, otherwise one at a time.
+        inline void derive_lanes(const lane* lanes, usize count,
+                                 const usize iteration_count) noexcept
+        {
+#if SNN_SHA_ENABLED
+            for (; count >= 4; count -= 4, lanes += 4)
+            {
+                derive_blocks_shani<4>(lanes, iteration_count);
+            }
+            if (count == 3)
+            {
+                derive_blocks_shani<3>(lanes, iteration_count);
+            }
+            else if (count == 2)
+            {
+                derive_blocks_shani<2>(lanes, iteration_count);
+            }
+            else if (count == 1)
+            {
+                derive_blocks_shani<1>(lanes, iteration_count);
+            }
+#else
+    #if SNN_AVX2_ENABLED
+            while (count >= 2)
+            {
+                const usize n = math::min(count, usize{8});
+                derive_blocks_x8(lanes, n, iteration_count);
+                lanes += n;
+                count -= n;
+            }
+    #endif
+            for (; count > 0; --count, ++lanes)
+            {
+                derive_block(*lanes->st, lanes->salt, lanes->block_index, iteration_count,
+                             lanes->out);
+            }
+#endif
+        }
+
+        // Split `[0, count)` into `thread_count` ranges and call `f(first, last)` for each range,
+        // on its own thread (the last range on the calling thread).
+        template <typename F>
+        void split_between_threads(const usize first, const usize last, const usize thread_count,
+                                   F& f)
+        {
+            const usize count = last - first;
+            if (thread_count <= 1 || count <= 1)
+            {
+                f(first, last);
+                return;
+            }
+
+            const usize left_threads = thread_count / 2;
+            // Keep groups of 8 together.
+            usize mid = first + (count * left_threads / thread_count);
+            mid       = math::min(first + (((mid - first) + 7) / 8 * 8), last);
+
+            // The thread is always joined, an exception from either side is rethrown after that.
+            std::exception_ptr left_error;
+            std::thread thread{[first, mid, left_threads, &f, &left_error] {
+                try
+                {
+                    split_between_threads(first, mid, left_threads, f);
+                }
+                catch (...)
+                {
+                    left_error = std::current_exception();
+                }
+            }};
+
+            try
+            {
+                split_between_threads(mid, last, thread_count - left_threads, f);
+            }
+            catch (...)
+            {
+                thread.join();
+                throw;
+            }
+            thread.join();
+
+            if (left_error)
+            {
+                std::rethrow_exception(left_error);
+            }
+        }
+
+        SNN_DIAGNOSTIC_POP
+    }
+
+    // ## Functions
+
+    // ### pbkdf2_hmac_sha256
+
+    // Derive a key of any size, longer keys (multiple 32-byte blocks) can be derived on
+    // `thread_count` threads.
+
+    template <any_strcore Str = str, usize DerivedKeySize = 32>
+        requires(DerivedKeySize > 0)
+    [[nodiscard]] result<Str> pbkdf2_hmac_sha256(const transient<cstrview> password,
+                                                 const transient<cstrview> salt,
+                                                 const usize iteration_count,
+                                                 const usize thread_count = 1)
+    {
+        namespace impl = detail::pbkdf2_hmac_sha256;
+
+        const error e = detail::pbkdf2::validate(password.get(), salt.get(), iteration_count);
+        if (e != error::no_error)
+        {
+            return e;
+        }
+
+        constexpr usize block_count = (DerivedKeySize + impl::output_size - 1) / impl::output_size;
+
+        const impl::hmac_state st = impl::precompute(password.get());
+        const cstrview s          = salt.get();
+
+        array<char, block_count * impl::output_size> key;
+
+        auto derive = [&st, s, iteration_count, &key](usize first, const usize last) {
+            constexpr usize max_lanes = 8;
+            array<impl::lane, max_lanes> lanes;
+            while (first < last)
+            {
+                const usize count = math::min(last - first, max_lanes);
+                for (usize j = 0; j < count; ++j)
+                {
+                    const usize i = first + j;
+                    lanes.at(j, bounds::mask) =
+                        impl::lane{&st, s, static_cast<u32>(i + 1),
+                                   key.view(i * impl::output_size).begin()};
+                }
+                impl::derive_lanes(lanes.begin(), count, iteration_count);
+                first += count;
+            }
+        };
+
+        impl::split_between_threads(0, block_count, thread_count, derive);
+
+        return Str{key.view(0, DerivedKeySize)};
+    }
+
+    // ### pbkdf2_hmac_sha256_batch
+
+    // Derive a 32-byte key for each password/salt pair, all with the same iteration count. The
+    // counts must be equal. Nothing is derived if any parameter is invalid.
+
+    [[nodiscard]] inline result<void> pbkdf2_hmac_sha256_batch(
+        const array_view<const cstrview> passwords, const array_view<const cstrview> salts,
+        const usize iteration_count, array_view<array<char, 32>> keys,
+        const usize thread_count = 1)
+    {
+        namespace impl = detail::pbkdf2_hmac_sha256;
+
+        snn_assert(passwords.count() == salts.count() && passwords.count() == keys.count());
+
+        for (usize i = 0; i < passwords.count(); ++i)
+        {
+            const error e =
+                detail::pbkdf2::validate(passwords.at(i, assume::within_bounds),
+                                         salts.at(i, assume::within_bounds), iteration_count);
+            if (e != error::no_error)
+            {
+                return e;
+            }
+        }
+
+        auto derive = [passwords, salts, iteration_count, &keys](usize first, const usize last) {
+            constexpr usize max_lanes = 8;
+            array<impl::hmac_state, max_lanes> states;
+            array<impl::lane, max_lanes> lanes;
+            while (first < last)
+            {
+                const usize count = math::min(last - first, max_lanes);
+                for (usize j = 0; j < count; ++j)
+                {
+                    const usize i = first + j;
+                    states.at(j, bounds::mask) =
+                        impl::precompute(passwords.at(i, assume::within_bounds));
+                    lanes.at(j, bounds::mask) =
+                        impl::lane{&states.at(j, bounds::mask), salts.at(i, assume::within_bounds),
+                                   1, keys.at(i, assume::within_bounds).begin()};
+                }
+                impl::derive_lanes(lanes.begin(), count, iteration_count);
+                first += count;
+            }
+        };
+
+        impl::split_between_threads(0, passwords.count(), thread_count, derive);
+
+        return {};
+    }
+
+    // ### pbkdf2_hmac_sha256_verify_batch
+
+    // Derive a key for each password/salt pair and compare it (in constant time) to the expected
+    // key (1-32 bytes), `is_match[i]` is set to the result. The counts must be equal.
+
+    [[nodiscard]] inline result<void> pbkdf2_hmac_sha256_verify_batch(
+        const array_view<const cstrview> passwords, const array_view<const cstrview> salts,
+        const usize iteration_count, const array_view<const cstrview> expected_keys,
+        array_view<bool> is_match, const usize thread_count = 1)
+    {
+        snn_assert(passwords.count() == expected_keys.count() &&
+                   passwords.count() == is_match.count());
+
+        const usize count = passwords.count();
+        vec<array<char, 32>> keys{init::reserve, count};
+        for (usize i = 0; i < count; ++i)
+        {
+            keys.append(array<char, 32>{});
+        }
+
+        const auto res =
+            pbkdf2_hmac_sha256_batch(passwords, salts, iteration_count, keys.view(), thread_count);
+        if (!res)
+        {
+            return res.error_code();
+        }
+
+        for (usize i = 0; i < count; ++i)
+        {
+            const cstrview expected = expected_keys.at(i, assume::within_bounds);
+            const auto& key         = keys.at(i, assume::within_bounds);
+            bool& match             = is_match.at(i, assume::within_bounds);
+            if (expected.is_empty() || expected.size() > key.count())
+            {
+                match = false;
+            }
+            else
+            {
+                match = mem::raw::constant_time::is_equal(expected.data(), key.data(),
+                                                          expected.byte_size());
+            }
+        }
+
+        return {};
+    }
+}
@@ -0,0 +1,149 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/crypto/kdf/pbkdf2_hmac_sha256.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/hex/encode.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            constexpr cstrview passphrase   = "tipped vaporizer demanding crabgrass";
+            constexpr cstrview salt         = "EZHMU7vL2JraXhor";
+            constexpr usize iteration_count = 1'000'000;
+            const str key =
+                crypto::kdf::pbkdf2_hmac_sha256(passphrase, salt, iteration_count).value();
+            snn_require(hex::encode(key) ==
+                        "d9c3aa491290ea1e2cabb0210d16044db4d16546c199c53dbb0cff1ea80ca1de");
+
+            return true;
+        }
+
+        bool example_batch()
+        {
+            // Verify many logins at once (8 at a time with AVX2).
+            const array<cstrview, 3> passwords{"123456", "wrong", "x"};
+            const array<cstrview, 3> salts{"abcdefghijklmnop", "abcdefghijklmnop", "aaaaaaaa"};
+            const array<cstrview, 3> expected_keys{
+                "\x41\xa8\xb2\x11\x3c\x0a\xd7\x2a\xcb\x9d\x9d\xc0\x1a\x44\x3b\xdf\xb8\x39\xda\x76"
+                "\x8e\xa2\x79\x05\x5d\x10\xef\x6b\xd9\x3e\xb6\xe6",
+                "\x41\xa8\xb2\x11\x3c\x0a\xd7\x2a\xcb\x9d\x9d\xc0\x1a\x44\x3b\xdf\xb8\x39\xda\x76"
+                "\x8e\xa2\x79\x05\x5d\x10\xef\x6b\xd9\x3e\xb6\xe6",
+                "\x1c\xa3\x6f\xd5\x43\x44\x8f\x9c\x66\x0d\x38\x69\x57\xdd\x91\x50",
+            };
+
+            array<bool, 3> is_match;
+            crypto::kdf::pbkdf2_hmac_sha256_verify_batch(passwords.view(), salts.view(), 1'000,
+                                                         expected_keys.view(), is_match.view())
+                .or_throw();
+            snn_require(is_match.at(0).value());
+            snn_require(!is_match.at(1).value());
+            snn_require(!is_match.at(2).value()); // Iteration count is 4 000.
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::example_batch());
+
+        using crypto::kdf::pbkdf2_hmac_sha256;
+
+        str key;
+
+        // Same as `pbkdf2_hmac<sha256>` (PHP used for verification).
+
+        key = pbkdf2_hmac_sha256("123456", "abcdefghijklmnop", 1'000).value();
+        snn_require(hex::encode(key) ==
+                    "41a8b2113c0ad72acb9d9dc01a443bdfb839da768ea279055d10ef6bd93eb6e6");
+
+        key = pbkdf2_hmac_sha256(str{init::fill, 30, 'a'}, "abcdefghijklmnop", 1'000).value();
+        snn_require(hex::encode(key) ==
+                    "3c9be1c1d1355dea9441a5bf2d4964259b0293c765df605c9187ad06690591ef");
+
+        key = pbkdf2_hmac_sha256(str{init::fill, 200, 'a'}, "abcdefghijklmnop", 1'000).value();
+        snn_require(hex::encode(key) ==
+                    "1747615168b6c926e9bcb671593834e03b2305115879db4c74bbf79a8000c414");
+
+        key = pbkdf2_hmac_sha256<str, 16>("x", "aaaaaaaa", 4'000).value();
+        snn_require(hex::encode(key) == "1ca36fd543448f9c660d386957dd9150");
+
+        // Longer keys (multiple blocks), Python hashlib used for verification.
+
+        for (const auto thread_count : init_list<usize>{1, 2, 3})
+        {
+            key = pbkdf2_hmac_sha256<str, 64>("passwd", "saltSALT", 1'000, thread_count).value();
+            snn_require(hex::encode(key) ==
+                        "38feb9ffc333d8d4b4056c8b7be4b5acbfb8ad8fc01b83bf640f132c72facfc9"
+                        "9432325355d287789a1b2c6dee34febd385743f16cc35e603980948de1a96d03");
+
+            const str key64 = key;
+            key = pbkdf2_hmac_sha256<str, 300>("passwd", "saltSALT", 1'000, thread_count).value();
+            snn_require(key.size() == 300);
+            snn_require(key.view(0, 64) == key64);
+            snn_require(hex::encode(key.view(268)) ==
+                        "6c2be155fd7903c5acb006d9b646f30d5034030ddb6437f8ac44dc70aaef36b2");
+        }
+
+        // Batch, same result as one at a time.
+        {
+            const str long_password{init::fill, 100, 'p'};
+            const array<cstrview, 11> passwords{
+                "",  "a",    "ab",   "abc", "abcd", "123456", "x", "password",
+                "pw", "pass", long_password,
+            };
+            const array<cstrview, 11> salts{
+                "saltsalt",   "abcdefghijklmnop", "12345678", "aaaaaaaa",
+                "bbbbbbbbb",  "abcdefghijklmnop", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+                "zzzzzzzz",   "yyyyyyyy",         "xxxxxxxxxx",
+                "saltsaltsalt",
+            };
+
+            for (const auto thread_count : init_list<usize>{1, 2, 5})
+            {
+                array<array<char, 32>, 11> keys;
+                crypto::kdf::pbkdf2_hmac_sha256_batch(passwords.view(), salts.view(), 1'000,
+                                                      keys.view(), thread_count)
+                    .or_throw();
+
+                for (usize i = 0; i < passwords.count(); ++i)
+                {
+                    key = pbkdf2_hmac_sha256(passwords.at(i).value(), salts.at(i).value(), 1'000)
+                              .value();
+                    snn_require(keys.at(i).value().view() == key);
+                }
+            }
+
+            // Invalid salt.
+            const array<cstrview, 2> invalid_salts{"saltsalt", "short"};
+            array<array<char, 32>, 2> keys;
+            snn_require_throws_code(
+                crypto::kdf::pbkdf2_hmac_sha256_batch(passwords.view(0, 2), invalid_salts.view(),
+                                                      1'000, keys.view())
+                    .or_throw(),
+                make_error_code(crypto::error::invalid_salt_size));
+        }
+
+        // Iteration count is out of range.
+        snn_require_throws_code(pbkdf2_hmac_sha256("abc", "aaaaaaaa", 999).value(),
+                                make_error_code(crypto::error::invalid_iteration_count));
+
+        // Password size is invalid.
+        snn_require_throws_code(
+            pbkdf2_hmac_sha256(str{init::fill, 4097, 'a'}, "aaaaaaaa", 1'000).value(),
+            make_error_code(crypto::error::invalid_password_size));
+
+        // Salt size is invalid.
+        snn_require_throws_code(pbkdf2_hmac_sha256("abc", "aaaaaaa", 1'000).value(),
+                                make_error_code(crypto::error::invalid_salt_size));
+    }
+}
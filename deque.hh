@@ -0,0 +1,916 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Double-ended queue (ring buffer) with optional small-capacity
+
+// * Amortized O(1) append/prepend and drop/pop at both ends.
+// * Optional small-capacity (on stack).
+// * Trivially-relocatable optimization when growing.
+// * The elements are stored in (at most) two contiguous segments, see `views()`.
+
+#pragma once
+
+#include "snn-core/array_view.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/optional.hh"
+#include "snn-core/detail/vec/common.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/mem/construct.hh"
+#include "snn-core/mem/copy_construct.hh"
+#include "snn-core/mem/destruct.hh"
+#include "snn-core/mem/destruct_n.hh"
+#include "snn-core/mem/relocate.hh"
+#include "snn-core/mem/raw/optimal_size.hh"
+#include "snn-core/pair/common.hh"
+#include "snn-core/range/random_access.hh"
+
+namespace snn
+{
+    namespace detail::deque
+    {
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        template <typename T, usize SmallCapacity>
+        struct small_storage final
+        {
+            alignas(T) byte data[sizeof(T) * SmallCapacity];
+
+            small_storage() noexcept
+            {
+                // Uninitialized.
+            }
+
+            T* get() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(&data[0]));
+            }
+        };
+
+        template <typename T>
+        struct small_storage<T, 0> final
+        {
+            constexpr T* get() noexcept
+            {
+                return nullptr;
+            }
+        };
+
+        // Random access iterator (logical index into the ring buffer).
+
+        template <typename T>
+        class iterator final
+        {
+          public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = std::remove_const_t<T>;
+            using difference_type   = isize;
+            using pointer           = T*;
+            using reference         = T&;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr explicit iterator(T* const data, const usize capacity, const usize head,
+                                        const usize index) noexcept
+                : data_{data},
+                  capacity_{capacity},
+                  head_{head},
+                  index_{index}
+            {
+            }
+
+            // Non-const to const.
+            template <typename U>
+                requires(std::is_same_v<const U, T> && !std::is_same_v<U, T>)
+            constexpr iterator(const iterator<U>& other) noexcept
+                : data_{other.data_},
+                  capacity_{other.capacity_},
+                  head_{other.head_},
+                  index_{other.index_}
+            {
+            }
+
+            constexpr T& operator*() const noexcept
+            {
+                snn_should(index_ < capacity_);
+                usize pos = head_ + index_;
+                if (pos >= capacity_)
+                {
+                    pos -= capacity_;
+                }
+                return data_[pos];
+            }
+
+            constexpr T* operator->() const noexcept
+            {
+                return &**this;
+            }
+
+            constexpr iterator& operator++() noexcept
+            {
+                ++index_;
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept
+            {
+                iterator tmp{*this};
+                ++index_;
+                return tmp;
+            }
+
+            constexpr iterator& operator--() noexcept
+            {
+                --index_;
+                return *this;
+            }
+
+            constexpr iterator operator--(int) noexcept
+            {
+                iterator tmp{*this};
+                --index_;
+                return tmp;
+            }
+
+            constexpr iterator& operator+=(const isize n) noexcept
+            {
+                index_ += static_cast<usize>(n);
+                return *this;
+            }
+
+            constexpr iterator& operator-=(const isize n) noexcept
+            {
+                index_ -= static_cast<usize>(n);
+                return *this;
+            }
+
+            constexpr T& operator[](const isize n) const noexcept
+            {
+                return *(*this + n);
+            }
+
+            constexpr iterator operator+(const isize n) const noexcept
+            {
+                return iterator{data_, capacity_, head_, index_ + static_cast<usize>(n)};
+            }
+
+            friend constexpr iterator operator+(const isize n, const iterator& it) noexcept
+            {
+                return it + n;
+            }
+
+            constexpr iterator operator-(const isize n) const noexcept
+            {
+                return iterator{data_, capacity_, head_, index_ - static_cast<usize>(n)};
+            }
+
+            constexpr isize operator-(const iterator& other) const noexcept
+            {
+                return static_cast<isize>(index_ - other.index_);
+            }
+
+            constexpr bool operator==(const iterator& other) const noexcept
+            {
+                return index_ == other.index_;
+            }
+
+            constexpr auto operator<=>(const iterator& other) const noexcept
+            {
+                return index_ <=> other.index_;
+            }
+
+          private:
+            template <typename>
+            friend class iterator;
+
+            T* data_{nullptr};
+            usize capacity_{0};
+            usize head_{0};
+            usize index_{0};
+        };
+
+        SNN_DIAGNOSTIC_POP
+    }
+
+    // ## Classes
+
+    // ### deque
+
+    template <typename T, usize SmallCapacity = 0, typename Alloc = mem::allocator<T>>
+        requires(std::is_move_constructible_v<T> && std::is_same_v<std::remove_cvref_t<T>, T>)
+    class deque final
+    {
+      public:
+        // #### Types
+
+        using value_type     = T;
+        using allocator_type = Alloc;
+
+        using iterator       = detail::deque::iterator<T>;
+        using const_iterator = detail::deque::iterator<const T>;
+
+        using reference       = T&;
+        using const_reference = const T&;
+
+        using trivially_relocatable_type =
+            std::conditional_t<SmallCapacity == 0, trivially_relocatable_if_t<deque, Alloc>, void>;
+
+        // #### Default constructor
+
+        constexpr deque() noexcept
+            : data_{small_.get()},
+              capacity_{SmallCapacity}
+        {
+        }
+
+        // #### Explicit constructors
+
+        constexpr explicit deque(const Alloc& alloc) noexcept
+            : data_{small_.get()},
+              capacity_{SmallCapacity},
+              alloc_{alloc}
+        {
+        }
+
+        constexpr explicit deque(init::reserve_t, const usize capacity)
+            : deque{}
+        {
+            reserve(capacity);
+        }
+
+        constexpr explicit deque(init::reserve_t, const usize capacity, const Alloc& alloc)
+            : deque{alloc}
+        {
+            reserve(capacity);
+        }
+
+        // #### Converting constructors
+
+        constexpr deque(initializer_list<T> values)
+            : deque{}
+        {
+            if (values.size() > 0)
+            {
+                reserve(values.size());
+                mem::copy_construct(not_null{values.begin()}, not_null{values.end()},
+                                    not_null{data_}, assume::no_overlap);
+                count_ = values.size();
+            }
+        }
+
+        // #### Copy/move-assignment/constructor
+
+        // A copy uses a copy of the allocator, copy assignment keeps the current allocator, move
+        // exchanges allocators along with the memory.
+
+        constexpr deque(const deque& other)
+            : deque{other.alloc_}
+        {
+            append_copy_(other);
+        }
+
+        constexpr deque& operator=(const deque& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                append_copy_(other);
+            }
+            return *this;
+        }
+
+        constexpr deque(deque&& other) noexcept
+            : deque{other.alloc_}
+        {
+            take_(other);
+        }
+
+        constexpr deque& operator=(deque&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release_();
+                alloc_ = other.alloc_;
+                take_(other);
+            }
+            return *this;
+        }
+
+        // #### Destructor
+
+        constexpr ~deque()
+        {
+            release_();
+        }
+
+        // #### Explicit conversion operators
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return !is_empty();
+        }
+
+        // #### Allocator
+
+        [[nodiscard]] constexpr const Alloc& allocator() const noexcept
+        {
+            return alloc_;
+        }
+
+        // #### Iterators
+
+        [[nodiscard]] constexpr iterator begin() noexcept
+        {
+            return iterator{data_, capacity_, head_, 0};
+        }
+
+        [[nodiscard]] constexpr iterator end() noexcept
+        {
+            return iterator{data_, capacity_, head_, count_};
+        }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return const_iterator{data_, capacity_, head_, 0};
+        }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return const_iterator{data_, capacity_, head_, count_};
+        }
+
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] constexpr const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        // #### Single element access
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        template <value_type_or<reference> R = reference>
+        [[nodiscard]] constexpr optional<R> at(const usize pos)
+            noexcept(std::is_nothrow_copy_constructible_v<R>)
+        {
+            if (pos < count_)
+            {
+                return data_[physical_(pos)];
+            }
+            return nullopt;
+        }
+
+        template <value_type_or<const_reference> R = const_reference>
+        [[nodiscard]] constexpr optional<R> at(const usize pos) const
+            noexcept(std::is_nothrow_copy_constructible_v<R>)
+        {
+            if (pos < count_)
+            {
+                return data_[physical_(pos)];
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] constexpr reference at(const usize pos, assume::within_bounds_t) noexcept
+        {
+            snn_assert(pos < count_);
+            return data_[physical_(pos)];
+        }
+
+        [[nodiscard]] constexpr const_reference at(const usize pos,
+                                                   assume::within_bounds_t) const noexcept
+        {
+            snn_assert(pos < count_);
+            return data_[physical_(pos)];
+        }
+
+        template <value_type_or<reference> R = reference>
+        [[nodiscard]] constexpr optional<R> back() noexcept(std::is_nothrow_copy_constructible_v<R>)
+        {
+            if (count_ > 0)
+            {
+                return data_[physical_(count_ - 1)];
+            }
+            return nullopt;
+        }
+
+        template <value_type_or<const_reference> R = const_reference>
+        [[nodiscard]] constexpr optional<R> back() const
+            noexcept(std::is_nothrow_copy_constructible_v<R>)
+        {
+            if (count_ > 0)
+            {
+                return data_[physical_(count_ - 1)];
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] constexpr reference back(assume::not_empty_t) noexcept
+        {
+            snn_assert(count_ > 0);
+            return data_[physical_(count_ - 1)];
+        }
+
+        [[nodiscard]] constexpr const_reference back(assume::not_empty_t) const noexcept
+        {
+            snn_assert(count_ > 0);
+            return data_[physical_(count_ - 1)];
+        }
+
+        template <value_type_or<reference> R = reference>
+        [[nodiscard]] constexpr optional<R> front()
+            noexcept(std::is_nothrow_copy_constructible_v<R>)
+        {
+            if (count_ > 0)
+            {
+                return data_[head_];
+            }
+            return nullopt;
+        }
+
+        template <value_type_or<const_reference> R = const_reference>
+        [[nodiscard]] constexpr optional<R> front() const
+            noexcept(std::is_nothrow_copy_constructible_v<R>)
+        {
+            if (count_ > 0)
+            {
+                return data_[head_];
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] constexpr reference front(assume::not_empty_t) noexcept
+        {
+            snn_assert(count_ > 0);
+            return data_[head_];
+        }
+
+        [[nodiscard]] constexpr const_reference front(assume::not_empty_t) const noexcept
+        {
+            snn_assert(count_ > 0);
+            return data_[head_];
+        }
+
+        // #### Append/prepend
+
+        constexpr void append(T value)
+        {
+            append_inplace(std::move(value));
+        }
+
+        template <typename... Args>
+        constexpr void append_inplace(Args&&... args)
+        {
+            if (count_ < capacity_) [[likely]]
+            {
+                mem::construct(not_null{data_ + physical_(count_)}, std::forward<Args>(args)...);
+                ++count_;
+            }
+            else
+            {
+                // Arguments could come from within self, use slow grow path.
+                grow_inplace_<false>(std::forward<Args>(args)...);
+            }
+        }
+
+        constexpr void prepend(T value)
+        {
+            prepend_inplace(std::move(value));
+        }
+
+        template <typename... Args>
+        constexpr void prepend_inplace(Args&&... args)
+        {
+            if (count_ < capacity_) [[likely]]
+            {
+                const usize head = (head_ > 0 ? head_ : capacity_) - 1;
+                mem::construct(not_null{data_ + head}, std::forward<Args>(args)...);
+                head_ = head;
+                ++count_;
+            }
+            else
+            {
+                // Arguments could come from within self, use slow grow path.
+                grow_inplace_<true>(std::forward<Args>(args)...);
+            }
+        }
+
+        // #### Drop/pop
+
+        constexpr void drop_back(assume::not_empty_t) noexcept
+        {
+            snn_assert(count_ > 0);
+            --count_;
+            mem::destruct(not_null{data_ + physical_(count_)});
+            reset_head_if_empty_();
+        }
+
+        constexpr void drop_front(assume::not_empty_t) noexcept
+        {
+            snn_assert(count_ > 0);
+            mem::destruct(not_null{data_ + head_});
+            advance_head_(1);
+        }
+
+        constexpr void drop_back_n(usize count) noexcept
+        {
+            count = math::min(count, count_);
+            for (; count > 0; --count)
+            {
+                drop_back(assume::not_empty);
+            }
+        }
+
+        constexpr void drop_front_n(const usize count) noexcept
+        {
+            const usize drop_count = math::min(count, count_);
+            if (drop_count > 0)
+            {
+                const usize first_count = math::min(drop_count, capacity_ - head_);
+                mem::destruct_n(data_ + head_, first_count);
+                mem::destruct_n(data_, drop_count - first_count);
+                advance_head_(drop_count);
+            }
+        }
+
+        [[nodiscard]] constexpr T pop_back(assume::not_empty_t)
+            noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            snn_assert(count_ > 0);
+            T value{std::move(data_[physical_(count_ - 1)])};
+            drop_back(assume::not_empty);
+            return value;
+        }
+
+        [[nodiscard]] constexpr T pop_front(assume::not_empty_t)
+            noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            snn_assert(count_ > 0);
+            T value{std::move(data_[head_])};
+            drop_front(assume::not_empty);
+            return value;
+        }
+
+        [[nodiscard]] constexpr optional<T> pop_back()
+            noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            if (count_ > 0)
+            {
+                return pop_back(assume::not_empty);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] constexpr optional<T> pop_front()
+            noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            if (count_ > 0)
+            {
+                return pop_front(assume::not_empty);
+            }
+            return nullopt;
+        }
+
+        SNN_DIAGNOSTIC_POP
+
+        // #### Count
+
+        [[nodiscard]] constexpr usize count() const noexcept
+        {
+            return count_;
+        }
+
+        [[nodiscard]] constexpr bool is_empty() const noexcept
+        {
+            return count_ == 0;
+        }
+
+        // #### Capacity
+
+        [[nodiscard]] constexpr usize capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] static constexpr usize default_capacity() noexcept
+        {
+            return SmallCapacity;
+        }
+
+        constexpr void reserve(const usize capacity)
+        {
+            if (capacity > capacity_)
+            {
+                grow_(capacity);
+            }
+        }
+
+        constexpr void reserve_append(const usize append_count)
+        {
+            reserve(math::add_with_saturation(count_, append_count));
+        }
+
+        // #### Range
+
+        [[nodiscard]] constexpr auto range() noexcept
+        {
+            return range::random_access{init::from, begin(), end()};
+        }
+
+        [[nodiscard]] constexpr auto range() const noexcept
+        {
+            return range::random_access{init::from, begin(), end()};
+        }
+
+        // #### Views
+
+        // The elements in order, as two contiguous segments (the second is empty unless the
+        // elements wrap around the end of the buffer).
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        [[nodiscard]] constexpr pair::first_second<array_view<T>, array_view<T>> views() noexcept
+        {
+            const usize first_count = math::min(count_, capacity_ - head_);
+            return {array_view<T>{data_ + head_, first_count},
+                    array_view<T>{data_, count_ - first_count}};
+        }
+
+        [[nodiscard]] constexpr pair::first_second<array_view<const T>, array_view<const T>> views()
+            const noexcept
+        {
+            const usize first_count = math::min(count_, capacity_ - head_);
+            return {array_view<const T>{data_ + head_, first_count},
+                    array_view<const T>{data_, count_ - first_count}};
+        }
+
+        // Rearrange the elements (if needed) so they are stored in a single contiguous segment.
+        // This can allocate (a wrapped small-capacity buffer is moved to the heap).
+        constexpr array_view<T> make_contiguous()
+        {
+            if (head_ + count_ > capacity_)
+            {
+                T* const buf = alloc_.allocate(not_zero{capacity_}).value();
+                relocate_to_(buf);
+                deallocate_();
+                data_ = buf;
+                head_ = 0;
+            }
+            return array_view<T>{data_ + head_, count_};
+        }
+
+        SNN_DIAGNOSTIC_POP
+
+        // #### Modifiers
+
+        constexpr void clear() noexcept
+        {
+            drop_front_n(count_);
+        }
+
+        // #### Swap
+
+        constexpr void swap(deque& other) noexcept
+        {
+            if constexpr (SmallCapacity == 0)
+            {
+                // This works even if this == &other.
+                std::swap(data_, other.data_);
+                std::swap(capacity_, other.capacity_);
+                std::swap(head_, other.head_);
+                std::swap(count_, other.count_);
+                std::swap(alloc_, other.alloc_);
+            }
+            else if (this != &other)
+            {
+                deque tmp{std::move(other)};
+                other = std::move(*this);
+                *this = std::move(tmp);
+            }
+        }
+
+        // #### Comparison
+
+        constexpr bool operator==(const deque& other) const noexcept
+        {
+            if (count_ != other.count_)
+            {
+                return false;
+            }
+            for (usize i = 0; i < count_; ++i)
+            {
+                if (!(at(i, assume::within_bounds) == other.at(i, assume::within_bounds)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+      private:
+        [[no_unique_address]] detail::deque::small_storage<T, SmallCapacity> small_;
+        T* data_;
+        usize capacity_;
+        usize head_{0};
+        usize count_{0};
+        [[no_unique_address]] Alloc alloc_;
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        constexpr bool is_small_() noexcept
+        {
+            return data_ == small_.get();
+        }
+
+        constexpr usize physical_(const usize pos) const noexcept
+        {
+            snn_should(pos < capacity_);
+            const usize p = head_ + pos;
+            return p < capacity_ ? p : p - capacity_;
+        }
+
+        constexpr void advance_head_(const usize n) noexcept
+        {
+            snn_should(n <= count_);
+            head_ = physical_(n == capacity_ ? 0 : n);
+            count_ -= n;
+            reset_head_if_empty_();
+        }
+
+        constexpr void reset_head_if_empty_() noexcept
+        {
+            // Keeps the elements contiguous for as long as possible.
+            if (count_ == 0)
+            {
+                head_ = 0;
+            }
+        }
+
+        static constexpr usize check_capacity_(const usize capacity)
+        {
+            if (capacity <= detail::vec::max_capacity<T>)
+            {
+                return capacity;
+            }
+            throw_or_abort(generic::error::capacity_would_exceed_max_capacity);
+        }
+
+        constexpr not_zero<usize> new_capacity_(const usize min_capacity) const
+        {
+            // ~1.5x, always greater than the current count.
+            const usize recommended = count_ + ((count_ + 2) / 2);
+            const usize capacity    = check_capacity_(math::max(min_capacity, recommended));
+            const auto size = mem::raw::optimal_size(not_zero{capacity * sizeof(T)});
+            return not_zero{size.get() / sizeof(T)};
+        }
+
+        // Relocate all elements (in order) to `buf`, the count doesn't change.
+        constexpr void relocate_to_(T* const buf) noexcept
+        {
+            if (count_ > 0)
+            {
+                const usize first_count = math::min(count_, capacity_ - head_);
+                mem::relocate(not_null{data_ + head_}, not_null{data_ + head_ + first_count},
+                              not_null{buf});
+                if (first_count < count_)
+                {
+                    mem::relocate(not_null{data_}, not_null{data_ + (count_ - first_count)},
+                                  not_null{buf + first_count});
+                }
+            }
+        }
+
+        constexpr void deallocate_() noexcept
+        {
+            if (!is_small_())
+            {
+                alloc_.deallocate(data_, capacity_);
+            }
+        }
+
+        constexpr void grow_(const usize min_capacity)
+        {
+            const auto cap = new_capacity_(min_capacity);
+
+            if (!is_small_() && head_ == 0)
+            {
+                // Contiguous from the start of the buffer, `realloc` (or `mremap`) can grow in
+                // place for trivially relocatable types.
+                data_ = alloc_.reallocate(data_, capacity_, cap, count_).value();
+            }
+            else
+            {
+                T* const buf = alloc_.allocate(cap).value();
+                relocate_to_(buf);
+                deallocate_();
+                data_ = buf;
+                head_ = 0;
+            }
+
+            capacity_ = cap.get();
+        }
+
+        template <bool Prepend, typename... Args>
+        constexpr void grow_inplace_(Args&&... args)
+        {
+            snn_should(count_ == capacity_);
+
+            const auto cap = new_capacity_(count_ + 1);
+
+            // Always allocate a new buffer.
+            T* const buf = alloc_.allocate(cap).value();
+
+            try
+            {
+                mem::construct(not_null{buf + (Prepend ? 0 : count_)},
+                               std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                alloc_.deallocate(buf, cap.get());
+                throw;
+            }
+
+            relocate_to_(Prepend ? buf + 1 : buf);
+            deallocate_();
+
+            data_     = buf;
+            head_     = 0;
+            capacity_ = cap.get();
+            ++count_;
+        }
+
+        constexpr void append_copy_(const deque& other)
+        {
+            if (other.count_ > 0)
+            {
+                reserve_append(other.count_);
+                const auto [first, second] = other.views();
+                for (const T& value : first)
+                {
+                    append_inplace(value);
+                }
+                for (const T& value : second)
+                {
+                    append_inplace(value);
+                }
+            }
+        }
+
+        // This must be empty with no allocated memory.
+        constexpr void take_(deque& other) noexcept
+        {
+            snn_should(is_small_() && count_ == 0);
+
+            if (other.is_small_())
+            {
+                other.relocate_to_(data_);
+                count_ = other.count_;
+            }
+            else
+            {
+                data_     = other.data_;
+                capacity_ = other.capacity_;
+                head_     = other.head_;
+                count_    = other.count_;
+
+                other.data_     = other.small_.get();
+                other.capacity_ = SmallCapacity;
+            }
+
+            other.head_  = 0;
+            other.count_ = 0;
+        }
+
+        constexpr void release_() noexcept
+        {
+            clear();
+            deallocate_();
+            data_     = small_.get();
+            capacity_ = SmallCapacity;
+            head_     = 0;
+        }
+
+        SNN_DIAGNOSTIC_POP
+    };
+
+    // ## Functions
+
+    // ### swap
+
+    template <typename T, usize SmallCapacity, typename Alloc>
+    constexpr void swap(deque<T, SmallCapacity, Alloc>& a,
+                        deque<T, SmallCapacity, Alloc>& b) noexcept
+    {
+        a.swap(b);
+    }
+}
@@ -0,0 +1,291 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/deque.hh"
+
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+#include "snn-core/mem/pool_resource.hh"
+#include "snn-core/mem/resource_allocator.hh"
+#include <algorithm> // is_sorted, sort
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            deque<int> q;
+            snn_require(q.is_empty());
+            snn_require(!q.front());
+
+            q.append(2);
+            q.append(3);
+            q.prepend(1);
+            snn_require(q.count() == 3);
+            snn_require(q.front().value() == 1);
+            snn_require(q.back().value() == 3);
+            snn_require(q.at(1).value() == 2);
+            snn_require(!q.at(3));
+
+            snn_require(q.pop_front().value() == 1);
+            snn_require(q.pop_back(assume::not_empty) == 3);
+            snn_require(q.count() == 1);
+
+            q.drop_front(assume::not_empty);
+            snn_require(q.is_empty());
+            snn_require(!q.pop_back());
+
+            return true;
+        }
+
+        constexpr bool test_wraparound()
+        {
+            deque<int> q{init::reserve, 4};
+            const usize capacity = q.capacity();
+            snn_require(capacity >= 4);
+
+            // Fill and rotate, the capacity doesn't change.
+            for (int i = 0; i < 100; ++i)
+            {
+                q.append(i);
+                if (q.count() == capacity)
+                {
+                    q.drop_front(assume::not_empty);
+                }
+            }
+            snn_require(q.count() == capacity - 1);
+            snn_require(q.capacity() == capacity);
+            snn_require(q.back().value() == 99);
+            snn_require(q.front().value() == static_cast<int>(100 - (capacity - 1)));
+
+            // Two segments in order.
+            q.prepend(-1);
+            const auto [first, second] = q.views();
+            snn_require(first.count() + second.count() == q.count());
+            snn_require(first.front().value() == -1);
+
+            // Iterators.
+            int expected = -1;
+            for (const int i : q)
+            {
+                snn_require(i == expected);
+                expected = (expected == -1) ? static_cast<int>(100 - (capacity - 1)) : expected + 1;
+            }
+            snn_require(q.range().count() == q.count());
+            snn_require(q.end() - q.begin() == static_cast<isize>(q.count()));
+            snn_require(q.at(q.count() - 1, assume::within_bounds) == 99);
+
+            // Grow while wrapped (elements stay in order).
+            const usize count = q.count();
+            q.append(100);
+            q.prepend(-2);
+            snn_require(q.capacity() > capacity);
+            snn_require(q.count() == count + 2);
+            snn_require(q.front().value() == -2);
+            snn_require(q.at(1).value() == -1);
+            snn_require(q.back().value() == 100);
+
+            // Make contiguous.
+            q.drop_front_n(2);
+            const array_view<int> v = q.make_contiguous();
+            snn_require(v.count() == q.count());
+            snn_require(v.front().value() == static_cast<int>(100 - (capacity - 1)));
+            snn_require(v.back().value() == 100);
+            snn_require(q.views().second.is_empty());
+
+            q.drop_back_n(2);
+            snn_require(q.back().value() == 98);
+            q.drop_front_n(1000);
+            snn_require(q.is_empty());
+
+            return true;
+        }
+
+        bool test_str()
+        {
+            deque<str> q;
+            for (usize i = 0; i < 100; ++i)
+            {
+                q.append("A longer string that goes on the heap.");
+                q.prepend_inplace("Short");
+            }
+            snn_require(q.count() == 200);
+            snn_require(q.front().value() == "Short");
+            snn_require(q.back().value() == "A longer string that goes on the heap.");
+
+            // Append an element from self (while growing).
+            while (q.count() < q.capacity())
+            {
+                q.append("abc");
+            }
+            q.append(q.front(assume::not_empty));
+            snn_require(q.back().value() == "Short");
+            while (q.count() < q.capacity())
+            {
+                q.prepend("abc");
+            }
+            q.prepend_inplace(q.back(assume::not_empty));
+            snn_require(q.front().value() == "Short");
+
+            // Copy/move.
+            deque<str> copy{q};
+            snn_require(copy == q);
+            deque<str> moved{std::move(copy)};
+            snn_require(moved == q);
+            snn_require(copy.is_empty());
+            copy = moved;
+            snn_require(copy == q);
+            copy.append("x");
+            snn_require(copy != q);
+
+            // Pop (move out).
+            const str s = q.pop_back(assume::not_empty);
+            snn_require(s == "Short");
+            q.clear();
+            snn_require(q.is_empty());
+
+            return true;
+        }
+
+        bool test_small_capacity()
+        {
+            deque<str, 4> q;
+            snn_require(q.capacity() == 4);
+            snn_require(q.default_capacity() == 4);
+
+            q.append("Two");
+            q.append("Three");
+            q.prepend("One");
+            q.drop_front(assume::not_empty);
+            q.drop_front(assume::not_empty);
+            q.append("Four");
+            q.append("Five");
+            q.append("Six");
+            snn_require(q.capacity() == 4);
+            snn_require(q.count() == 4);
+            snn_require(!q.views().second.is_empty()); // Wrapped.
+
+            // Move (relocated to the small buffer of the new deque).
+            deque<str, 4> moved{std::move(q)};
+            snn_require(q.is_empty());
+            snn_require(moved.count() == 4);
+            snn_require(moved.views().second.is_empty());
+            snn_require(moved.front().value() == "Three");
+            snn_require(moved.back().value() == "Six");
+
+            // Swap.
+            q.append("abc");
+            swap(q, moved);
+            snn_require(q.count() == 4);
+            snn_require(moved.count() == 1);
+
+            // Grow (to the heap).
+            q.prepend("Two");
+            snn_require(q.capacity() > 4);
+            snn_require(q.count() == 5);
+            snn_require(q.front().value() == "Two");
+            snn_require(q.back().value() == "Six");
+
+            deque<str, 4> moved_heap{std::move(q)};
+            snn_require(moved_heap.count() == 5);
+            snn_require(q.is_empty());
+            snn_require(q.capacity() == 4);
+
+            // Make contiguous (wrapped small buffer).
+            deque<int, 3> w{1, 2, 3};
+            w.drop_front(assume::not_empty);
+            w.append(4);
+            const auto v = w.make_contiguous();
+            snn_require(v.count() == 3);
+            snn_require(v.at(0).value() == 2 && v.at(2).value() == 4);
+
+            return true;
+        }
+
+        bool test_allocator()
+        {
+            static_assert(is_trivially_relocatable_v<deque<str>>);
+            static_assert(!is_trivially_relocatable_v<deque<str, 2>>);
+
+            mem::pool_resource<> pool;
+
+            using allocator = mem::resource_allocator<str, mem::pool_resource<>>;
+
+            deque<str, 0, allocator> q{allocator{pool}};
+            for (usize i = 0; i < 50; ++i)
+            {
+                q.append("A longer string that goes on the heap.");
+                q.prepend("Short");
+            }
+            snn_require(q.count() == 100);
+            snn_require(pool.chunk_count() > 0);
+
+            deque<str, 0, allocator> copy{q};
+            snn_require(copy == q);
+            snn_require(&copy.allocator().get_resource() == &pool);
+
+            return true;
+        }
+
+        constexpr bool test_iterator()
+        {
+            static_assert(std::random_access_iterator<deque<int>::iterator>);
+            static_assert(std::random_access_iterator<deque<int>::const_iterator>);
+
+            // Wrapped around the end of the buffer.
+            deque<int> q{init::reserve, 8};
+            for (int i = 0; i < 6; ++i)
+            {
+                q.append(i);
+            }
+            for (int i = 0; i < 5; ++i)
+            {
+                q.drop_front(assume::not_empty);
+            }
+            for (int i : {3, 9, 1, 7, 4})
+            {
+                q.append(i);
+            }
+            snn_require(q.count() == 6);
+
+            auto it = q.begin();
+            snn_require(*it++ == 5);
+            snn_require(*it == 3);
+            snn_require(*it-- == 3);
+            snn_require(*it == 5);
+
+            it += 4;
+            snn_require(*it == 7);
+            it -= 2;
+            snn_require(*it == 9);
+            snn_require(it[3] == 4);
+            snn_require(it[-1] == 3);
+            snn_require(*(2 + it) == 7);
+            snn_require(q.end() - it == 4);
+
+            std::sort(q.begin(), q.end());
+            snn_require(q.front().value() == 1);
+            snn_require(q.back().value() == 9);
+            snn_require(std::is_sorted(q.cbegin(), q.cend()));
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_require(app::example());
+        snn_static_require(app::test_wraparound());
+        snn_require(app::test_wraparound());
+        snn_static_require(app::test_iterator());
+        snn_require(app::test_iterator());
+        snn_require(app::test_str());
+        snn_require(app::test_small_capacity());
+        snn_require(app::test_allocator());
+    }
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # SIMD kernels for bitsets (SSE2/AVX2)
+
+// The kernels operate on arrays of 64-bit words. Only full chunks are processed, all kernels
+// return the number of words processed and the caller continues with the scalar code from there.
+// The kernels return 0 if no supported instruction set is enabled at compile time.
+
+#pragma once
+
+#include "snn-core/core.hh"
+#if SNN_SSE2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::detail::bitset::simd
+{
+    // ## Enums
+
+    // ### operation
+
+    enum class operation : u8
+    {
+        and_op,
+        or_op,
+        xor_op,
+        and_not_op, // `a & ~b`
+    };
+
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+    // ## Functions
+
+    // ### apply
+
+    // `dst[i] = dst[i] <op> src[i]`
+
+    template <operation Op>
+    inline usize apply(u64* const dst, const u64* const src, const usize count) noexcept
+    {
+        usize i = 0;
+
+#if SNN_AVX2_ENABLED
+        for (; (i + 4) <= count; i += 4)
+        {
+            auto* const d   = reinterpret_cast<__m256i*>(dst + i);
+            const __m256i a = _mm256_loadu_si256(d);
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            if constexpr (Op == operation::and_op)
+            {
+                _mm256_storeu_si256(d, _mm256_and_si256(a, b));
+            }
+            else if constexpr (Op == operation::or_op)
+            {
+                _mm256_storeu_si256(d, _mm256_or_si256(a, b));
+            }
+            else if constexpr (Op == operation::xor_op)
+            {
+                _mm256_storeu_si256(d, _mm256_xor_si256(a, b));
+            }
+            else
+            {
+                _mm256_storeu_si256(d, _mm256_andnot_si256(b, a));
+            }
+        }
+#elif SNN_SSE2_ENABLED
+        for (; (i + 2) <= count; i += 2)
+        {
+            auto* const d   = reinterpret_cast<__m128i*>(dst + i);
+            const __m128i a = _mm_loadu_si128(d);
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            if constexpr (Op == operation::and_op)
+            {
+                _mm_storeu_si128(d, _mm_and_si128(a, b));
+            }
+            else if constexpr (Op == operation::or_op)
+            {
+                _mm_storeu_si128(d, _mm_or_si128(a, b));
+            }
+            else if constexpr (Op == operation::xor_op)
+            {
+                _mm_storeu_si128(d, _mm_xor_si128(a, b));
+            }
+            else
+            {
+                _mm_storeu_si128(d, _mm_andnot_si128(b, a));
+            }
+        }
+#else
+        ignore_if_unused(dst);
+        ignore_if_unused(src);
+        ignore_if_unused(count);
+#endif
+
+        return i;
+    }
+
+    // ### count_and
+
+    // Adds the number of bits set in `a[i] & b[i]` to `total`.
+
+    // "Faster Population Counts Using AVX2 Instructions" by Wojciech Muła, Nathan Kurz and Daniel
+    // Lemire (https://arxiv.org/abs/1611.07612): A nibble lookup table (`vpshufb`) counts 32 bytes
+    // at a time, `vpsadbw` sums the byte counts into 64-bit lanes. Without AVX2 the scalar code
+    // (`popcnt`) is as fast as an SSE version.
+
+    inline usize count_and(const u64* const a, const u64* const b, const usize count,
+                           usize& total) noexcept
+    {
+        usize i = 0;
+
+#if SNN_AVX2_ENABLED
+        if (count >= 8)
+        {
+            // Bits set per nibble (repeated for both 128-bit lanes).
+            const __m256i lookup =
+                _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, //
+                                 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i low_mask = _mm256_set1_epi8(0x0f);
+            __m256i acc            = _mm256_setzero_si256();
+
+            for (; (i + 4) <= count; i += 4)
+            {
+                const __m256i v =
+                    _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+                const __m256i lo  = _mm256_and_si256(v, low_mask);
+                const __m256i hi  = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+                const __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                                                    _mm256_shuffle_epi8(lookup, hi));
+                acc = _mm256_add_epi64(acc, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+            }
+
+            total += static_cast<usize>(_mm256_extract_epi64(acc, 0)) +
+                     static_cast<usize>(_mm256_extract_epi64(acc, 1)) +
+                     static_cast<usize>(_mm256_extract_epi64(acc, 2)) +
+                     static_cast<usize>(_mm256_extract_epi64(acc, 3));
+        }
+#else
+        ignore_if_unused(a);
+        ignore_if_unused(b);
+        ignore_if_unused(count);
+        ignore_if_unused(total);
+#endif
+
+        return i;
+    }
+
+    SNN_DIAGNOSTIC_POP
+}
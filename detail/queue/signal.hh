@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Queue signal (blocking wait for "not empty"/"not full")
+
+// A futex word that is bumped by `notify()`, but only if a thread is waiting. Without waiters a
+// notification is a fence and a relaxed load (no read-modify-write, no system call).
+
+// A waiter registers itself, reads the word and checks its condition before blocking. The
+// notifier publishes its change and then checks for waiters. The sequentially consistent fences
+// on both sides guarantee that either the notifier sees the waiter or the waiter sees the change
+// (in which case it doesn't block or the futex wait returns immediately). A waiter that reads
+// the bumped word also sees the change (release/acquire).
+
+#pragma once
+
+#include "snn-core/thread/futex.hh"
+#include "snn-core/time/duration.hh"
+#include "snn-core/time/steady/duration_since_boot.hh"
+#include <atomic> // atomic, atomic_thread_fence, memory_order
+
+namespace snn::detail::queue
+{
+    // ## Constants
+
+    // ### cache_line_size
+
+    inline constexpr usize cache_line_size = 64;
+
+    // ## Classes
+
+    // ### signal
+
+    class signal final
+    {
+      public:
+        constexpr signal() noexcept = default;
+
+        // Non-copyable
+        signal(const signal&)            = delete;
+        signal& operator=(const signal&) = delete;
+
+        // Non-movable
+        signal(signal&&)            = delete;
+        signal& operator=(signal&&) = delete;
+
+        void notify() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed) != 0) [[unlikely]]
+            {
+                word_.fetch_add(1, std::memory_order_release);
+                snn::thread::futex::wake_all(word_);
+            }
+        }
+
+        // Blocks until notified (or spuriously) unless `is_ready()` returns `true`.
+        template <typename IsReady>
+        void wait(IsReady is_ready) noexcept
+        {
+            const u32 expected = register_();
+            if (!is_ready())
+            {
+                snn::thread::futex::wait(word_, expected);
+            }
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // Returns `false` if `timeout` expired.
+        template <typename IsReady>
+        bool wait(IsReady is_ready, const time::duration timeout) noexcept
+        {
+            bool not_expired   = true;
+            const u32 expected = register_();
+            if (!is_ready())
+            {
+                not_expired = snn::thread::futex::wait(word_, expected, timeout);
+            }
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
+            return not_expired;
+        }
+
+      private:
+        std::atomic<u32> word_{0};
+        std::atomic<u32> waiters_{0};
+
+        u32 register_() noexcept
+        {
+            waiters_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return word_.load(std::memory_order_acquire);
+        }
+    };
+
+    // ## Functions
+
+    // ### retry
+
+    // Calls `try_op()` until it returns `true`, waiting on `sig` in between.
+
+    template <typename TryOp, typename IsReady>
+    void retry(signal& sig, TryOp try_op, IsReady is_ready)
+    {
+        while (!try_op())
+        {
+            sig.wait(is_ready);
+        }
+    }
+
+    // Returns `false` if `timeout` expired before `try_op()` returned `true`.
+    template <typename TryOp, typename IsReady>
+    bool retry(signal& sig, TryOp try_op, IsReady is_ready, const time::duration timeout)
+    {
+        if (try_op())
+        {
+            return true;
+        }
+
+        const time::duration deadline = time::steady::duration_since_boot() + timeout;
+        while (true)
+        {
+            const time::duration now = time::steady::duration_since_boot();
+            if (now >= deadline)
+            {
+                return false;
+            }
+
+            sig.wait(is_ready, deadline - now);
+
+            if (try_op())
+            {
+                return true;
+            }
+        }
+    }
+}
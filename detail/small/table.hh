@@ -0,0 +1,410 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "snn-core/vec.hh"
+#include "snn-core/math/common.hh"
+#include <bit>     // bit_ceil, countr_zero
+#include <memory>  // construct_at, destroy_at
+#include <tuple>   // forward_as_tuple
+#include <utility> // pair, piecewise_construct
+
+namespace snn::detail::small
+{
+    // Table used by `set::small` and `map::small`, with the container interface that
+    // `set::facade` and `map::facade` use.
+
+    // All elements are stored densely in a `vec<value_type, N>` (inline up to `N` elements). While
+    // there is no index, lookups are a linear scan over the elements. The index, an open
+    // addressing hash table (linear probing) of element positions, is built when the count
+    // exceeds `N` and is kept until `clear()`. Removing an element moves the last element into its
+    // place, so the order of the elements is unspecified.
+
+    template <typename Key, typename Mapped, usize N, typename Hash, typename KeyEqual>
+    class table final
+    {
+      public:
+        static_assert(N > 0);
+
+        static constexpr bool is_set = std::is_void_v<Mapped>;
+
+        // #### Types
+
+        using key_type    = Key;
+        using mapped_type = Mapped;
+        using value_type  = std::conditional_t<is_set, Key, std::pair<Key, Mapped>>;
+
+        // Keys must not be modified through an iterator.
+        using iterator       = std::conditional_t<is_set, const value_type*, value_type*>;
+        using const_iterator = const value_type*;
+
+        // #### Default constructor
+
+        table() = default;
+
+        // #### Copy and move
+
+        table(const table&)            = default;
+        table& operator=(const table&) = default;
+
+        table(table&&) noexcept = default;
+
+        table& operator=(table&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        // #### Converting constructors
+
+        table(init_list<value_type> values)
+        {
+            reserve(values.size());
+            for (const value_type& v : values)
+            {
+                if (find_pos_(key_of_(v)) == constant::npos)
+                {
+                    insert_new_(v);
+                }
+            }
+        }
+
+        // #### Iterators
+
+        [[nodiscard]] iterator begin() noexcept
+        {
+            return elements_.begin();
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return elements_.begin();
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return elements_.cbegin();
+        }
+
+        [[nodiscard]] iterator end() noexcept
+        {
+            return elements_.end();
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return elements_.end();
+        }
+
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return elements_.cend();
+        }
+
+        // #### Count
+
+        [[nodiscard]] usize size() const noexcept
+        {
+            return elements_.count();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return elements_.is_empty();
+        }
+
+        // #### Capacity
+
+        void reserve(const usize capacity)
+        {
+            if (capacity > N)
+            {
+                reserve_index_(capacity);
+            }
+            elements_.reserve(capacity);
+        }
+
+        // #### Insert
+
+        template <typename... Args>
+            requires is_set
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            Key key{std::forward<Args>(args)...};
+            const usize pos = find_pos_(key);
+            if (pos != constant::npos)
+            {
+                return {begin() + pos, false};
+            }
+            return {insert_new_(std::move(key)), true};
+        }
+
+        template <typename K, typename... Args>
+            requires(!is_set)
+        std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+        {
+            const usize pos = find_pos_(key);
+            if (pos != constant::npos)
+            {
+                return {begin() + pos, false};
+            }
+            return {insert_new_(std::piecewise_construct,
+                                std::forward_as_tuple(std::forward<K>(key)),
+                                std::forward_as_tuple(std::forward<Args>(args)...)),
+                    true};
+        }
+
+        template <typename K, typename V>
+            requires(!is_set)
+        std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+        {
+            const usize pos = find_pos_(key);
+            if (pos != constant::npos)
+            {
+                iterator it = begin() + pos;
+                it->second  = std::forward<V>(value);
+                return {it, false};
+            }
+            return {insert_new_(std::piecewise_construct,
+                                std::forward_as_tuple(std::forward<K>(key)),
+                                std::forward_as_tuple(std::forward<V>(value))),
+                    true};
+        }
+
+        // #### Lookup
+
+        template <typename K>
+        [[nodiscard]] iterator find(const K& key)
+        {
+            const usize pos = find_pos_(key);
+            return pos != constant::npos ? begin() + pos : end();
+        }
+
+        template <typename K>
+        [[nodiscard]] const_iterator find(const K& key) const
+        {
+            const usize pos = find_pos_(key);
+            return pos != constant::npos ? begin() + pos : end();
+        }
+
+        // #### Modifiers
+
+        void clear() noexcept
+        {
+            elements_.clear();
+            slots_.clear();
+        }
+
+        // Returns an iterator to the element that replaced the erased element (or `end()`).
+        // Can throw if `Hash` throws (the index is updated by rehashing keys).
+        iterator erase(const const_iterator it)
+        {
+            const auto pos = to_usize(it - cbegin());
+            snn_should(pos < elements_.count());
+
+            const usize last = elements_.count() - 1;
+            if (has_index_())
+            {
+                unlink_(slot_of_(pos));
+                if (pos != last)
+                {
+                    slots_.at(slot_of_(last), assume::within_bounds) = pos + 1;
+                }
+            }
+
+            if (pos != last)
+            {
+                elements_.at(pos, assume::within_bounds) =
+                    std::move(elements_.at(last, assume::within_bounds));
+            }
+            elements_.drop_back(assume::not_empty);
+
+            return begin() + pos;
+        }
+
+        void swap(table& other) noexcept
+        {
+            if (this != &other)
+            {
+                // A `vec` with small capacity can't be swapped or move assigned, but it can be
+                // move constructed.
+                elements_type tmp{std::move(elements_)};
+                std::destroy_at(&elements_);
+                std::construct_at(&elements_, std::move(other.elements_));
+                std::destroy_at(&other.elements_);
+                std::construct_at(&other.elements_, std::move(tmp));
+
+                slots_.swap(other.slots_);
+                std::swap(shift_, other.shift_);
+            }
+        }
+
+      private:
+        using elements_type = snn::vec<value_type, N>;
+
+        elements_type elements_;
+        snn::vec<usize> slots_; // 0 = empty, otherwise element position + 1.
+        int shift_{0};
+
+        [[nodiscard]] static const Key& key_of_(const value_type& v) noexcept
+        {
+            if constexpr (is_set)
+            {
+                return v;
+            }
+            else
+            {
+                return v.first;
+            }
+        }
+
+        template <typename K>
+        [[nodiscard]] static usize hash_(const K& key)
+        {
+            if constexpr (std::is_invocable_v<const Hash&, const K&>)
+            {
+                return static_cast<usize>(Hash{}(key));
+            }
+            else
+            {
+                return static_cast<usize>(Hash{}(Key{key}));
+            }
+        }
+
+        [[nodiscard]] bool has_index_() const noexcept
+        {
+            return !slots_.is_empty();
+        }
+
+        [[nodiscard]] usize mask_() const noexcept
+        {
+            return slots_.count() - 1;
+        }
+
+        // Fibonacci hashing, spreads weak hashes (e.g. `std::hash<int>`) over the high bits.
+        [[nodiscard]] usize bucket_(const usize hash) const noexcept
+        {
+            return static_cast<usize>((u64{hash} * 0x9e37'79b9'7f4a'7c15) >> shift_);
+        }
+
+        template <typename K>
+        [[nodiscard]] usize find_pos_(const K& key) const
+        {
+            if (!has_index_())
+            {
+                // Linear scan.
+                const usize count = elements_.count();
+                for (usize pos = 0; pos < count; ++pos)
+                {
+                    if (KeyEqual{}(key_of_(elements_.at(pos, assume::within_bounds)), key))
+                    {
+                        return pos;
+                    }
+                }
+                return constant::npos;
+            }
+
+            const usize mask = mask_();
+            usize i          = bucket_(hash_(key));
+            while (true)
+            {
+                const usize slot = slots_.at(i, assume::within_bounds);
+                if (slot == 0)
+                {
+                    return constant::npos;
+                }
+                if (KeyEqual{}(key_of_(elements_.at(slot - 1, assume::within_bounds)), key))
+                {
+                    return slot - 1;
+                }
+                i = (i + 1) & mask;
+            }
+        }
+
+        template <typename... Args>
+        iterator insert_new_(Args&&... args)
+        {
+            const usize pos = elements_.count();
+            if (pos >= N)
+            {
+                reserve_index_(pos + 1);
+            }
+            elements_.append_inplace(std::forward<Args>(args)...);
+            if (has_index_())
+            {
+                link_(pos);
+            }
+            return begin() + pos;
+        }
+
+        // Keep the load factor at or below 1/2.
+        void reserve_index_(const usize count)
+        {
+            const usize capacity = std::bit_ceil(math::max(count * 2, N * 2));
+            if (capacity > slots_.count())
+            {
+                snn::vec<usize> slots{init::reserve, capacity};
+                for (usize i = 0; i < capacity; ++i)
+                {
+                    slots.append(0);
+                }
+                slots_.swap(slots);
+                shift_ = 64 - std::countr_zero(capacity);
+
+                for (usize pos = 0; pos < elements_.count(); ++pos)
+                {
+                    link_(pos);
+                }
+            }
+        }
+
+        void link_(const usize pos)
+        {
+            const usize mask = mask_();
+            usize i          = bucket_(hash_(key_of_(elements_.at(pos, assume::within_bounds))));
+            while (slots_.at(i, assume::within_bounds) != 0)
+            {
+                i = (i + 1) & mask;
+            }
+            slots_.at(i, assume::within_bounds) = pos + 1;
+        }
+
+        [[nodiscard]] usize slot_of_(const usize pos) const
+        {
+            const usize mask = mask_();
+            usize i          = bucket_(hash_(key_of_(elements_.at(pos, assume::within_bounds))));
+            while (slots_.at(i, assume::within_bounds) != pos + 1)
+            {
+                i = (i + 1) & mask;
+            }
+            return i;
+        }
+
+        // Backward shift deletion, no tombstones.
+        void unlink_(usize i)
+        {
+            const usize mask = mask_();
+            usize j          = i;
+            while (true)
+            {
+                j                = (j + 1) & mask;
+                const usize slot = slots_.at(j, assume::within_bounds);
+                if (slot == 0)
+                {
+                    break;
+                }
+
+                // Move the slot back if its home bucket isn't cyclically in `(i, j]`.
+                const usize home =
+                    bucket_(hash_(key_of_(elements_.at(slot - 1, assume::within_bounds))));
+                if (((j - home) & mask) >= ((j - i) & mask))
+                {
+                    slots_.at(i, assume::within_bounds) = slot;
+                    i                                   = j;
+                }
+            }
+            slots_.at(i, assume::within_bounds) = 0;
+        }
+    };
+}
@@ -7,6 +7,7 @@
 #include "snn-core/array_view.hh"
 #include "snn-core/generic/error.hh"
 #include "snn-core/math/common.hh"
+#include "snn-core/mem/arena_allocator.hh"
 #include "snn-core/mem/trivial_allocator.hh"
 #include "snn-core/mem/raw/copy.hh"
 #include "snn-core/mem/raw/fill.hh"
@@ -115,17 +116,18 @@ namespace snn::detail::strcore
         }
     };
 
-    class buf final : public shared
+    template <typename Allocator>
+    class basic_buf final : public shared
     {
       public:
-        using trivially_relocatable_type = buf;
+        using trivially_relocatable_type = basic_buf;
 
-        constexpr explicit buf() noexcept
+        constexpr explicit basic_buf() noexcept
         {
             init_();
         }
 
-        constexpr explicit buf(init::reserve_t, const usize capacity)
+        constexpr explicit basic_buf(init::reserve_t, const usize capacity)
         {
             if (capacity)
             {
@@ -137,7 +139,7 @@ namespace snn::detail::strcore
             }
         }
 
-        constexpr explicit buf(init::size_for_overwrite_t, const usize size)
+        constexpr explicit basic_buf(init::size_for_overwrite_t, const usize size)
         {
             if (size)
             {
@@ -149,7 +151,7 @@ namespace snn::detail::strcore
             }
         }
 
-        constexpr explicit buf(const not_null<const char*> data, const usize size)
+        constexpr explicit basic_buf(const not_null<const char*> data, const usize size)
         {
             if (size)
             {
@@ -163,7 +165,7 @@ namespace snn::detail::strcore
         }
 
         template <character Char, usize Count>
-        constexpr explicit buf(const snn::array_view<Char, Count> s)
+        constexpr explicit basic_buf(const snn::array_view<Char, Count> s)
         {
             if constexpr (Count == constant::dynamic_count)
             {
@@ -188,7 +190,7 @@ namespace snn::detail::strcore
             }
         }
 
-        constexpr explicit buf(init::fill_t, const usize count, const char c)
+        constexpr explicit basic_buf(init::fill_t, const usize count, const char c)
         {
             if (count)
             {
@@ -201,7 +203,7 @@ namespace snn::detail::strcore
             }
         }
 
-        constexpr explicit buf(init::from_t, const char* const first, const char* const last)
+        constexpr explicit basic_buf(init::from_t, const char* const first, const char* const last)
         {
             snn_should(first == last || (first != nullptr && last != nullptr && first < last));
             if (first != last)
@@ -218,27 +220,27 @@ namespace snn::detail::strcore
         }
 
         // Non-copyable
-        buf(const buf&)            = delete;
-        buf& operator=(const buf&) = delete;
+        basic_buf(const basic_buf&)            = delete;
+        basic_buf& operator=(const basic_buf&) = delete;
 
         // Move constructor.
-        constexpr buf(buf&& other) noexcept
+        constexpr basic_buf(basic_buf&& other) noexcept
             : buf_{other.buf_},
               size_{other.size_},
-              cap_{other.cap_}
+              cap_{other.cap_},
+              alloc_{other.alloc_}
         {
             other.init_();
         }
 
         // Move assignment operator.
-        buf& operator=(buf&&) = delete;
+        basic_buf& operator=(basic_buf&&) = delete;
 
-        constexpr ~buf()
+        constexpr ~basic_buf()
         {
             if (cap_)
             {
-                mem::trivial_allocator<char> alloc;
-                alloc.deallocate(buf_, cap_);
+                alloc_.deallocate(buf_, cap_);
             }
         }
 
@@ -422,9 +424,9 @@ namespace snn::detail::strcore
         {
             if (cap_)
             {
-                mem::trivial_allocator<char> alloc;
-                alloc.deallocate(buf_, cap_);
+                alloc_.deallocate(buf_, cap_);
             }
+            alloc_ = Allocator{}; // Nothing is allocated, an arena allocator can bind again.
             init_();
         }
 
@@ -454,8 +456,7 @@ namespace snn::detail::strcore
                 const auto cap = mem::raw::optimal_size(not_zero{size_});
                 if (cap.get() < cap_)
                 {
-                    mem::trivial_allocator<char> alloc;
-                    auto opt = alloc.reallocate(buf_, cap_, cap, size_);
+                    auto opt = alloc_.reallocate(buf_, cap_, cap, size_);
                     if (opt)
                     {
                         buf_ = opt.value(assume::has_value);
@@ -474,12 +475,13 @@ namespace snn::detail::strcore
             return size_;
         }
 
-        constexpr void swap(buf& other) noexcept
+        constexpr void swap(basic_buf& other) noexcept
         {
             // This works even if this == &other.
             std::swap(buf_, other.buf_);
             std::swap(size_, other.size_);
             std::swap(cap_, other.cap_);
+            std::swap(alloc_, other.alloc_);
         }
 
         constexpr void truncate(const usize size) noexcept
@@ -504,6 +506,8 @@ namespace snn::detail::strcore
         char* buf_;
         usize size_;
         usize cap_;
+        // Stateless or an `arena_allocator` bound to the arena the buffer allocates from.
+        [[no_unique_address]] Allocator alloc_;
 
         constexpr void init_() noexcept
         {
@@ -522,8 +526,7 @@ namespace snn::detail::strcore
         {
             snn_should(size <= capacity.get());
             const auto cap = mem::raw::optimal_size(not_zero{check_capacity_(capacity.get())});
-            mem::trivial_allocator<char> alloc;
-            buf_  = alloc.allocate(cap).value();
+            buf_  = alloc_.allocate(cap).value();
             size_ = size;
             cap_  = cap.get();
         }
@@ -533,14 +536,13 @@ namespace snn::detail::strcore
             snn_should(size_ <= cap_ && cap_ < capacity.get());
             const usize min_cap = math::max(capacity.get(), recommend_capacity_(size_));
             const auto cap      = mem::raw::optimal_size(not_zero{check_capacity_(min_cap)});
-            mem::trivial_allocator<char> alloc;
             if (cap_)
             {
-                buf_ = alloc.reallocate(buf_, cap_, cap, size_).value();
+                buf_ = alloc_.reallocate(buf_, cap_, cap, size_).value();
             }
             else
             {
-                buf_ = alloc.allocate(cap).value();
+                buf_ = alloc_.allocate(cap).value();
             }
             cap_ = cap.get();
         }
@@ -552,10 +554,22 @@ namespace snn::detail::strcore
             const usize min_cap  = math::max(new_size, recommend_capacity_(size_));
             const auto cap       = mem::raw::optimal_size(not_zero{check_capacity_(min_cap)});
 
-            mem::trivial_allocator<char> alloc;
+            if constexpr (requires { requires Allocator::reallocate_keeps_old_memory; })
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    // The old buffer stays valid even if moved, so it's safe to reallocate (which
+                    // can grow in place).
+                    grow_(not_zero{new_size});
+                    mem::raw::copy(append_data, not_null{buf_ + size_},
+                                   byte_size{append_size.get()}, assume::no_overlap);
+                    size_ = new_size;
+                    return;
+                }
+            }
 
             // Always allocate a new buffer.
-            char* const buffer = alloc.allocate(cap).value();
+            char* const buffer = alloc_.allocate(cap).value();
 
             // Copy contents from old buffer (if any).
             mem::raw::copy(not_null<const char*>{buf_}, not_null{buffer}, byte_size{size_},
@@ -568,7 +582,7 @@ namespace snn::detail::strcore
             // Free old buffer.
             if (cap_)
             {
-                alloc.deallocate(buf_, cap_);
+                alloc_.deallocate(buf_, cap_);
             }
 
             buf_  = buffer;
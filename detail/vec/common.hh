@@ -19,7 +19,7 @@ namespace snn::detail::vec
 
     // vec buffer with small capacity, can currently not be `constexpr`.
 
-    template <typename T, usize SmallCapacity>
+    template <typename T, usize SmallCapacity, typename Alloc>
     class buffer final
     {
       public:
@@ -33,6 +33,15 @@ namespace snn::detail::vec
             snn_should(is_small_());
         }
 
+        explicit buffer(const Alloc& alloc) noexcept
+            : data_{small_ptr_()},
+              count_{0},
+              capacity_{SmallCapacity},
+              alloc_{alloc}
+        {
+            snn_should(is_small_());
+        }
+
         // Non-copyable
         buffer(const buffer&)            = delete;
         buffer& operator=(const buffer&) = delete;
@@ -41,7 +50,8 @@ namespace snn::detail::vec
         buffer(buffer&& other) noexcept
             : data_{other.data_},
               count_{other.count_},
-              capacity_{other.capacity_}
+              capacity_{other.capacity_},
+              alloc_{other.alloc_}
         {
             if (other.is_small_())
             {
@@ -73,11 +83,15 @@ namespace snn::detail::vec
             if (!is_small_())
             {
                 snn_should(data_ != nullptr);
-                mem::allocator<T> alloc;
-                alloc.deallocate(data_, capacity_);
+                alloc_.deallocate(data_, capacity_);
             }
         }
 
+        const Alloc& allocator() const noexcept
+        {
+            return alloc_;
+        }
+
         T* begin() noexcept
         {
             return data_;
@@ -127,11 +141,9 @@ namespace snn::detail::vec
             const auto size = mem::raw::optimal_size(not_zero{capacity.get() * sizeof(T)});
             const auto cap  = not_zero{size.get() / sizeof(T)};
 
-            mem::allocator<T> alloc;
-
             if (is_small_())
             {
-                T* buf = alloc.allocate(cap).value();
+                T* buf = alloc_.allocate(cap).value();
 
                 if (count_ > 0)
                 {
@@ -143,7 +155,7 @@ namespace snn::detail::vec
             else
             {
                 snn_should(data_ != nullptr);
-                data_ = alloc.reallocate(data_, capacity_, cap, count_).value();
+                data_ = alloc_.reallocate(data_, capacity_, cap, count_).value();
             }
 
             // count_ doesn't change.
@@ -159,10 +171,8 @@ namespace snn::detail::vec
             const auto size = mem::raw::optimal_size(not_zero{capacity.get() * sizeof(T)});
             const auto cap  = not_zero{size.get() / sizeof(T)};
 
-            mem::allocator<T> alloc;
-
             // Always allocate a new buffer.
-            T* buf = alloc.allocate(cap).value();
+            T* buf = alloc_.allocate(cap).value();
 
             try
             {
@@ -170,7 +180,7 @@ namespace snn::detail::vec
             }
             catch (...)
             {
-                alloc.deallocate(buf, cap.get());
+                alloc_.deallocate(buf, cap.get());
                 throw;
             }
 
@@ -182,7 +192,7 @@ namespace snn::detail::vec
             if (!is_small_())
             {
                 snn_should(data_ != nullptr);
-                alloc.deallocate(data_, capacity_);
+                alloc_.deallocate(data_, capacity_);
             }
 
             data_ = buf;
@@ -209,6 +219,7 @@ namespace snn::detail::vec
         T* data_;
         usize count_;
         usize capacity_;
+        [[no_unique_address]] Alloc alloc_;
 
         bool is_small_() const noexcept
         {
@@ -228,11 +239,12 @@ namespace snn::detail::vec
 
     // vec buffer without small capacity, can be `constexpr`.
 
-    template <typename T>
-    class buffer<T, 0> final
+    template <typename T, typename Alloc>
+    class buffer<T, 0, Alloc> final
     {
       public:
-        using trivially_relocatable_type = buffer; // Always relocatable.
+        // Relocatable if the allocator is (e.g. a pointer to a resource).
+        using trivially_relocatable_type = trivially_relocatable_if_t<buffer, Alloc>;
 
         constexpr buffer() noexcept
             : data_{nullptr},
@@ -241,6 +253,14 @@ namespace snn::detail::vec
         {
         }
 
+        constexpr explicit buffer(const Alloc& alloc) noexcept
+            : data_{nullptr},
+              count_{0},
+              capacity_{0},
+              alloc_{alloc}
+        {
+        }
+
         // Non-copyable
         buffer(const buffer&)            = delete;
         buffer& operator=(const buffer&) = delete;
@@ -249,7 +269,8 @@ namespace snn::detail::vec
         constexpr buffer(buffer&& other) noexcept
             : data_{std::exchange(other.data_, nullptr)},
               count_{std::exchange(other.count_, 0)},
-              capacity_{std::exchange(other.capacity_, 0)}
+              capacity_{std::exchange(other.capacity_, 0)},
+              alloc_{other.alloc_}
         {
         }
 
@@ -260,8 +281,12 @@ namespace snn::detail::vec
         {
             clear();
 
-            mem::allocator<T> alloc;
-            alloc.deallocate(data_, capacity_); // Does nothing if nullptr.
+            alloc_.deallocate(data_, capacity_); // Does nothing if nullptr.
+        }
+
+        constexpr const Alloc& allocator() const noexcept
+        {
+            return alloc_;
         }
 
         constexpr T* begin() noexcept
@@ -313,9 +338,8 @@ namespace snn::detail::vec
             const auto size = mem::raw::optimal_size(not_zero{capacity.get() * sizeof(T)});
             const auto cap  = not_zero{size.get() / sizeof(T)};
 
-            mem::allocator<T> alloc;
             // data_ can be nullptr here, if so reallocate() behaves as allocate().
-            data_ = alloc.reallocate(data_, capacity_, cap, count_).value();
+            data_ = alloc_.reallocate(data_, capacity_, cap, count_).value();
 
             // count_ doesn't change.
             capacity_ = cap.get();
@@ -331,10 +355,8 @@ namespace snn::detail::vec
             const auto size = mem::raw::optimal_size(not_zero{capacity.get() * sizeof(T)});
             const auto cap  = not_zero{size.get() / sizeof(T)};
 
-            mem::allocator<T> alloc;
-
             // Always allocate a new buffer.
-            T* buf = alloc.allocate(cap).value();
+            T* buf = alloc_.allocate(cap).value();
 
             try
             {
@@ -342,7 +364,7 @@ namespace snn::detail::vec
             }
             catch (...)
             {
-                alloc.deallocate(buf, cap.get());
+                alloc_.deallocate(buf, cap.get());
                 throw;
             }
 
@@ -351,7 +373,7 @@ namespace snn::detail::vec
                 mem::relocate(not_null{begin()}, not_null{end()}, not_null{buf});
             }
 
-            alloc.deallocate(data_, capacity_); // Does nothing if nullptr.
+            alloc_.deallocate(data_, capacity_); // Does nothing if nullptr.
 
             data_ = buf;
             ++count_;
@@ -376,12 +398,14 @@ namespace snn::detail::vec
             std::swap(data_, other.data_);
             std::swap(count_, other.count_);
             std::swap(capacity_, other.capacity_);
+            std::swap(alloc_, other.alloc_); // Memory follows its allocator.
         }
 
       private:
         T* data_;
         usize count_;
         usize capacity_;
+        [[no_unique_address]] Alloc alloc_;
     };
 
     SNN_DIAGNOSTIC_POP
@@ -0,0 +1,1267 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Streaming decoder (any scheme to UTF-8)
+
+// Decodes any `encoding::scheme` to UTF-8 as specified by the WHATWG Encoding Standard
+// (https://encoding.spec.whatwg.org/#decoders). Input can be decoded in chunks of any size (e.g.
+// from `stream::buffered_reader`), a sequence that is split between chunks is completed by the next
+// call. Call `finish()` after the last chunk.
+
+// Invalid sequences are replaced with U+FFFD (the replacement character). A byte order mark (BOM)
+// is not stripped, it is decoded like any other character.
+
+// ASCII runs are appended as is, 16 or 32 bytes at a time with SSE2/SSSE3/AVX2.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/strcore.hh"
+#include "snn-core/chr/detail/simd.hh"
+#include "snn-core/encoding/scheme.hh"
+#include "snn-core/encoding/detail/index/big5.hh"
+#include "snn-core/encoding/detail/index/euc_kr.hh"
+#include "snn-core/encoding/detail/index/gb18030.hh"
+#include "snn-core/encoding/detail/index/gb18030_ranges.hh"
+#include "snn-core/encoding/detail/index/jis0208.hh"
+#include "snn-core/encoding/detail/index/jis0212.hh"
+#include "snn-core/encoding/detail/index/single_byte.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/range/contiguous.hh"
+#include "snn-core/unicode/core.hh"
+#include "snn-core/utf8/encode.hh"
+
+namespace snn::encoding
+{
+    namespace detail::decoder
+    {
+        template <u8 Exclude1 = 0x80, u8 Exclude2 = 0x80, u8 Exclude3 = 0x80>
+        constexpr array<bool, 256> make_ascii_lookup() noexcept
+        {
+            array<bool, 256> table{};
+            for (usize i = 0; i < 0x80; ++i)
+            {
+                table.at(i, assume::within_bounds) = (i != Exclude1 && i != Exclude2 &&
+                                                      i != Exclude3);
+            }
+            return table;
+        }
+
+        inline constexpr array<bool, 256> ascii_lookup = make_ascii_lookup();
+
+        // ISO-2022-JP (ASCII state): SO (0x0E), SI (0x0F) and ESC (0x1B) are not pass-through.
+        inline constexpr array<bool, 256> iso2022jp_ascii_lookup =
+            make_ascii_lookup<0x0e, 0x0f, 0x1b>();
+
+        inline constexpr chr::detail::simd::lookup ascii_passthrough{ascii_lookup};
+        inline constexpr chr::detail::simd::lookup iso2022jp_ascii_passthrough{
+            iso2022jp_ascii_lookup};
+
+        // Code point by pointer, 0 if the pointer has no code point.
+        template <usize N>
+        [[nodiscard]] constexpr u32 index_code_point(const array<u16, N>& index,
+                                                     const usize first_pointer,
+                                                     const usize pointer) noexcept
+        {
+            if (pointer >= first_pointer)
+            {
+                return index.at(pointer - first_pointer).value_or(0);
+            }
+            return 0;
+        }
+
+        [[nodiscard]] constexpr u32 big5_code_point(const usize pointer) noexcept
+        {
+            const u32 cp = index_code_point(index::big5, index::big5_first_pointer, pointer);
+            if (cp != 0)
+            {
+                const usize i = pointer - index::big5_first_pointer;
+                const u64 bits = index::big5_plane2.at(i / 64, assume::within_bounds);
+                if (bits & (u64{1} << (i % 64)))
+                {
+                    return cp + 0x20000;
+                }
+            }
+            return cp;
+        }
+
+        // Four-byte sequences (https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point).
+        [[nodiscard]] constexpr u32 gb18030_ranges_code_point(const u32 pointer) noexcept
+        {
+            if ((pointer > 39419 && pointer < 189000) || pointer > 1237575)
+            {
+                return 0;
+            }
+
+            if (pointer >= 189000)
+            {
+                return 0x10000 + pointer - 189000;
+            }
+
+            if (pointer == 7457)
+            {
+                return 0xe7c7;
+            }
+
+            // Binary search for the last range with a pointer that is less than or equal to
+            // `pointer` (the first range starts at pointer 0).
+            usize first = 0;
+            usize last  = index::gb18030_ranges.count();
+            while ((last - first) > 1)
+            {
+                const usize mid = first + ((last - first) / 2);
+                if (index::gb18030_ranges.at(mid, assume::within_bounds).at(0, bounds::mask) <=
+                    pointer)
+                {
+                    first = mid;
+                }
+                else
+                {
+                    last = mid;
+                }
+            }
+
+            const auto& range = index::gb18030_ranges.at(first, assume::within_bounds);
+            return range.at(1, bounds::mask) + (pointer - range.at(0, bounds::mask));
+        }
+
+        [[nodiscard]] constexpr bool is_ascii(const u8 b) noexcept
+        {
+            return b < 0x80;
+        }
+
+        [[nodiscard]] constexpr bool is_in_range(const u8 b, const u8 first,
+                                                 const u8 last) noexcept
+        {
+            return b >= first && b <= last;
+        }
+    }
+
+    // ## Classes
+
+    // ### decoder
+
+    class decoder final
+    {
+      public:
+        // #### Explicit constructors
+
+        // Throws if the scheme is `scheme::unknown`.
+
+        constexpr explicit decoder(const encoding::scheme s)
+            : scheme_{s}
+        {
+            switch (s)
+            {
+                case scheme::unknown:
+                    throw_or_abort(generic::error::invalid_value);
+
+                case scheme::big5:
+                    kind_ = kind::big5;
+                    break;
+                case scheme::euc_jp:
+                    kind_ = kind::euc_jp;
+                    break;
+                case scheme::euc_kr:
+                    kind_ = kind::euc_kr;
+                    break;
+                case scheme::gb18030:
+                case scheme::gbk:
+                    kind_ = kind::gb18030;
+                    break;
+                case scheme::iso2022jp:
+                    kind_ = kind::iso2022jp;
+                    break;
+                case scheme::replacement:
+                    kind_ = kind::replacement;
+                    break;
+                case scheme::shift_jis:
+                    kind_ = kind::shift_jis;
+                    break;
+                case scheme::utf16be:
+                    kind_ = kind::utf16be;
+                    break;
+                case scheme::utf16le:
+                    kind_ = kind::utf16le;
+                    break;
+                case scheme::utf8:
+                    kind_ = kind::utf8;
+                    break;
+                case scheme::x_user_defined:
+                    kind_ = kind::x_user_defined;
+                    break;
+
+                default:
+                    kind_  = kind::single_byte;
+                    table_ = single_byte_table_(s);
+                    snn_assert(table_ != nullptr);
+                    break;
+            }
+        }
+
+        // #### Decode
+
+        // Decode a chunk and append the result to `append_to`. A sequence that is incomplete at
+        // the end of the chunk is kept until the next call.
+
+        template <typename Buf>
+        constexpr void decode(const transient<cstrview> chunk, strcore<Buf>& append_to)
+        {
+            decode_(chunk.get(), append_to);
+        }
+
+        // #### Finish
+
+        // Finish the stream (end-of-queue), an incomplete sequence is replaced with U+FFFD. The
+        // decoder is then reset and can be used for another stream.
+
+        template <typename Buf>
+        constexpr void finish(strcore<Buf>& append_to)
+        {
+            while (true)
+            {
+                while (restore_count_ > 0)
+                {
+                    handle_(pop_restored_(), append_to);
+                }
+
+                if (end_of_queue_(append_to))
+                {
+                    break;
+                }
+            }
+
+            reset_();
+        }
+
+        // #### Status
+
+        // Returns `true` if any invalid sequence has been replaced with U+FFFD.
+
+        [[nodiscard]] constexpr bool has_errors() const noexcept
+        {
+            return has_errors_;
+        }
+
+        [[nodiscard]] constexpr encoding::scheme scheme() const noexcept
+        {
+            return scheme_;
+        }
+
+      private:
+        enum class kind : u8
+        {
+            single_byte,
+            big5,
+            euc_jp,
+            euc_kr,
+            gb18030,
+            iso2022jp,
+            replacement,
+            shift_jis,
+            utf16be,
+            utf16le,
+            utf8,
+            x_user_defined,
+        };
+
+        // ISO-2022-JP decoder states.
+        enum class iso2022jp_state : u8
+        {
+            ascii,
+            roman,
+            katakana,
+            lead_byte,
+            trail_byte,
+            escape_start,
+            escape,
+        };
+
+        encoding::scheme scheme_;
+        kind kind_{kind::single_byte};
+        const array<u16, 128>* table_{nullptr};
+
+        // Bytes to process before the next input byte ("restore to ioQueue"), last first.
+        array<u8, 3> restored_{};
+        usize restore_count_{0};
+
+        // UTF-8
+        u32 code_point_{0};
+        u8 bytes_seen_{0};
+        u8 bytes_needed_{0};
+        u8 lower_boundary_{0x80};
+        u8 upper_boundary_{0xbf};
+
+        // Big5, EUC-JP, EUC-KR, Shift_JIS, ISO-2022-JP and UTF-16 (lead byte), gb18030 (first).
+        u8 lead_{0};
+        bool has_lead_{false};
+
+        // gb18030
+        u8 second_{0};
+        u8 third_{0};
+
+        // EUC-JP
+        bool jis0212_{false};
+
+        // ISO-2022-JP
+        iso2022jp_state state_{iso2022jp_state::ascii};
+        iso2022jp_state output_state_{iso2022jp_state::ascii};
+        bool output_{false};
+
+        // UTF-16
+        u16 lead_surrogate_{0};
+
+        // Replacement
+        bool is_finished_{false};
+
+        bool has_errors_{false};
+
+        static constexpr const array<u16, 128>* single_byte_table_(
+            const encoding::scheme s) noexcept
+        {
+            switch (s)
+            {
+                case scheme::ibm866:
+                    return &detail::index::ibm866;
+                // ISO-8859-1 is decoded as windows-1252 (like all WHATWG labels for it).
+                case scheme::iso8859_1:
+                    return &detail::index::windows1252;
+                case scheme::iso8859_10:
+                    return &detail::index::iso8859_10;
+                case scheme::iso8859_13:
+                    return &detail::index::iso8859_13;
+                case scheme::iso8859_14:
+                    return &detail::index::iso8859_14;
+                case scheme::iso8859_15:
+                    return &detail::index::iso8859_15;
+                case scheme::iso8859_16:
+                    return &detail::index::iso8859_16;
+                case scheme::iso8859_2:
+                    return &detail::index::iso8859_2;
+                case scheme::iso8859_3:
+                    return &detail::index::iso8859_3;
+                case scheme::iso8859_4:
+                    return &detail::index::iso8859_4;
+                case scheme::iso8859_5:
+                    return &detail::index::iso8859_5;
+                case scheme::iso8859_6:
+                    return &detail::index::iso8859_6;
+                case scheme::iso8859_7:
+                    return &detail::index::iso8859_7;
+                case scheme::iso8859_8:
+                case scheme::iso8859_8i:
+                    return &detail::index::iso8859_8;
+                case scheme::koi8r:
+                    return &detail::index::koi8r;
+                case scheme::koi8u:
+                    return &detail::index::koi8u;
+                case scheme::macintosh:
+                    return &detail::index::macintosh;
+                case scheme::windows1250:
+                    return &detail::index::windows1250;
+                case scheme::windows1251:
+                    return &detail::index::windows1251;
+                case scheme::windows1252:
+                    return &detail::index::windows1252;
+                case scheme::windows1253:
+                    return &detail::index::windows1253;
+                case scheme::windows1254:
+                    return &detail::index::windows1254;
+                case scheme::windows1255:
+                    return &detail::index::windows1255;
+                case scheme::windows1256:
+                    return &detail::index::windows1256;
+                case scheme::windows1257:
+                    return &detail::index::windows1257;
+                case scheme::windows1258:
+                    return &detail::index::windows1258;
+                case scheme::windows874:
+                    return &detail::index::windows874;
+                case scheme::x_mac_cyrillic:
+                    return &detail::index::x_mac_cyrillic;
+                default:
+                    return nullptr;
+            }
+        }
+
+        template <typename Buf>
+        constexpr void decode_(const cstrview s, strcore<Buf>& append_to)
+        {
+            auto rng = s.range();
+            while (true)
+            {
+                if (restore_count_ > 0)
+                {
+                    handle_(pop_restored_(), append_to);
+                    continue;
+                }
+
+                if (!rng)
+                {
+                    break;
+                }
+
+                const u8 b = to_byte(rng.front(assume::not_empty));
+
+                // ASCII fast path.
+                if (detail::decoder::is_ascii(b))
+                {
+                    const chr::detail::simd::lookup* const passthrough = ascii_passthrough_();
+                    if (passthrough != nullptr)
+                    {
+                        const cstrview ascii = passthrough->pop_front_while(rng);
+                        if (ascii)
+                        {
+                            append_to.append(ascii);
+                            output_ = false; // ISO-2022-JP
+                            continue;
+                        }
+                    }
+                }
+
+                rng.drop_front(assume::not_empty);
+                handle_(b, append_to);
+            }
+        }
+
+        // The pass-through lookup for the current state, if ASCII bytes can be appended as is.
+        [[nodiscard]] constexpr const chr::detail::simd::lookup* ascii_passthrough_()
+            const noexcept
+        {
+            switch (kind_)
+            {
+                case kind::single_byte:
+                case kind::x_user_defined:
+                    return &detail::decoder::ascii_passthrough;
+                case kind::utf8:
+                    return bytes_needed_ == 0 ? &detail::decoder::ascii_passthrough : nullptr;
+                case kind::big5:
+                case kind::euc_jp:
+                case kind::euc_kr:
+                case kind::gb18030:
+                case kind::shift_jis:
+                    return has_lead_ ? nullptr : &detail::decoder::ascii_passthrough;
+                case kind::iso2022jp:
+                    return state_ == iso2022jp_state::ascii
+                               ? &detail::decoder::iso2022jp_ascii_passthrough
+                               : nullptr;
+                case kind::replacement:
+                case kind::utf16be:
+                case kind::utf16le:
+                    return nullptr;
+            }
+            return nullptr;
+        }
+
+        constexpr void restore_(const u8 b) noexcept
+        {
+            snn_should(restore_count_ < restored_.count());
+            restored_.at(restore_count_, assume::within_bounds) = b;
+            ++restore_count_;
+        }
+
+        // Restore multiple bytes (in order).
+        constexpr void restore_(const u8 b1, const u8 b2) noexcept
+        {
+            restore_(b2);
+            restore_(b1);
+        }
+
+        constexpr void restore_(const u8 b1, const u8 b2, const u8 b3) noexcept
+        {
+            restore_(b3);
+            restore_(b2);
+            restore_(b1);
+        }
+
+        [[nodiscard]] constexpr u8 pop_restored_() noexcept
+        {
+            snn_should(restore_count_ > 0);
+            --restore_count_;
+            return restored_.at(restore_count_, assume::within_bounds);
+        }
+
+        template <typename Buf>
+        static constexpr void emit_(const u32 cp, strcore<Buf>& append_to)
+        {
+            utf8::encode(cp, append_to, assume::is_valid);
+        }
+
+        template <typename Buf>
+        constexpr void error_(strcore<Buf>& append_to)
+        {
+            has_errors_ = true;
+            utf8::encode(unicode::codepoint::replacement, append_to, assume::is_valid);
+        }
+
+        constexpr void reset_() noexcept
+        {
+            const bool has_errors = has_errors_;
+            *this                 = decoder{scheme_};
+            has_errors_           = has_errors;
+        }
+
+        // Handle a single byte.
+        template <typename Buf>
+        constexpr void handle_(const u8 b, strcore<Buf>& append_to)
+        {
+            switch (kind_)
+            {
+                case kind::single_byte:
+                    return handle_single_byte_(b, append_to);
+                case kind::big5:
+                    return handle_big5_(b, append_to);
+                case kind::euc_jp:
+                    return handle_euc_jp_(b, append_to);
+                case kind::euc_kr:
+                    return handle_euc_kr_(b, append_to);
+                case kind::gb18030:
+                    return handle_gb18030_(b, append_to);
+                case kind::iso2022jp:
+                    return handle_iso2022jp_(b, append_to);
+                case kind::replacement:
+                    if (!is_finished_)
+                    {
+                        is_finished_ = true;
+                        error_(append_to);
+                    }
+                    return;
+                case kind::shift_jis:
+                    return handle_shift_jis_(b, append_to);
+                case kind::utf16be:
+                    return handle_utf16_<true>(b, append_to);
+                case kind::utf16le:
+                    return handle_utf16_<false>(b, append_to);
+                case kind::utf8:
+                    return handle_utf8_(b, append_to);
+                case kind::x_user_defined:
+                    if (detail::decoder::is_ascii(b))
+                    {
+                        return emit_(b, append_to);
+                    }
+                    return emit_(0xf780 + b - 0x80, append_to);
+            }
+        }
+
+        // Handle end-of-queue, returns `true` when finished (or `false` if bytes were restored or
+        // the state was changed and end-of-queue must be handled again).
+        template <typename Buf>
+        constexpr bool end_of_queue_(strcore<Buf>& append_to)
+        {
+            switch (kind_)
+            {
+                case kind::utf8:
+                    if (bytes_needed_ != 0)
+                    {
+                        bytes_needed_ = 0;
+                        error_(append_to);
+                    }
+                    return true;
+
+                case kind::iso2022jp:
+                    switch (state_)
+                    {
+                        case iso2022jp_state::trail_byte:
+                            state_ = iso2022jp_state::lead_byte;
+                            error_(append_to);
+                            return false;
+                        case iso2022jp_state::escape_start:
+                            output_ = false;
+                            state_  = output_state_;
+                            error_(append_to);
+                            return false;
+                        case iso2022jp_state::escape:
+                            restore_(lead_);
+                            lead_   = 0;
+                            output_ = false;
+                            state_  = output_state_;
+                            error_(append_to);
+                            return false;
+                        default:
+                            return true;
+                    }
+
+                case kind::gb18030:
+                    if (has_lead_ || second_ != 0 || third_ != 0)
+                    {
+                        has_lead_ = false;
+                        lead_     = 0;
+                        second_   = 0;
+                        third_    = 0;
+                        error_(append_to);
+                    }
+                    return true;
+
+                case kind::big5:
+                case kind::euc_jp:
+                case kind::euc_kr:
+                case kind::shift_jis:
+                case kind::utf16be:
+                case kind::utf16le:
+                    if (has_lead_ || lead_surrogate_ != 0)
+                    {
+                        has_lead_       = false;
+                        lead_           = 0;
+                        lead_surrogate_ = 0;
+                        error_(append_to);
+                    }
+                    return true;
+
+                case kind::single_byte:
+                case kind::replacement:
+                case kind::x_user_defined:
+                    return true;
+            }
+            return true;
+        }
+
+        template <typename Buf>
+        constexpr void handle_single_byte_(const u8 b, strcore<Buf>& append_to)
+        {
+            if (detail::decoder::is_ascii(b))
+            {
+                return emit_(b, append_to);
+            }
+
+            const u32 cp = table_->at(b - 0x80u, bounds::mask);
+            if (cp != 0)
+            {
+                return emit_(cp, append_to);
+            }
+            error_(append_to);
+        }
+
+        // https://encoding.spec.whatwg.org/#utf-8-decoder
+        template <typename Buf>
+        constexpr void handle_utf8_(const u8 b, strcore<Buf>& append_to)
+        {
+            using detail::decoder::is_in_range;
+
+            if (bytes_needed_ == 0)
+            {
+                if (detail::decoder::is_ascii(b))
+                {
+                    return emit_(b, append_to);
+                }
+
+                if (is_in_range(b, 0xc2, 0xdf))
+                {
+                    bytes_needed_ = 1;
+                    code_point_   = b & 0x1fu;
+                }
+                else if (is_in_range(b, 0xe0, 0xef))
+                {
+                    if (b == 0xe0)
+                    {
+                        lower_boundary_ = 0xa0;
+                    }
+                    else if (b == 0xed)
+                    {
+                        upper_boundary_ = 0x9f;
+                    }
+                    bytes_needed_ = 2;
+                    code_point_   = b & 0xfu;
+                }
+                else if (is_in_range(b, 0xf0, 0xf4))
+                {
+                    if (b == 0xf0)
+                    {
+                        lower_boundary_ = 0x90;
+                    }
+                    else if (b == 0xf4)
+                    {
+                        upper_boundary_ = 0x8f;
+                    }
+                    bytes_needed_ = 3;
+                    code_point_   = b & 0x7u;
+                }
+                else
+                {
+                    error_(append_to);
+                }
+                return;
+            }
+
+            if (!is_in_range(b, lower_boundary_, upper_boundary_))
+            {
+                code_point_     = 0;
+                bytes_needed_   = 0;
+                bytes_seen_     = 0;
+                lower_boundary_ = 0x80;
+                upper_boundary_ = 0xbf;
+                restore_(b);
+                return error_(append_to);
+            }
+
+            lower_boundary_ = 0x80;
+            upper_boundary_ = 0xbf;
+            code_point_     = (code_point_ << 6u) | (b & 0x3fu);
+            ++bytes_seen_;
+
+            if (bytes_seen_ == bytes_needed_)
+            {
+                const u32 cp  = code_point_;
+                code_point_   = 0;
+                bytes_needed_ = 0;
+                bytes_seen_   = 0;
+                emit_(cp, append_to);
+            }
+        }
+
+        // https://encoding.spec.whatwg.org/#shared-utf-16-decoder
+        template <bool BigEndian, typename Buf>
+        constexpr void handle_utf16_(const u8 b, strcore<Buf>& append_to)
+        {
+            if (!has_lead_)
+            {
+                has_lead_ = true;
+                lead_     = b;
+                return;
+            }
+
+            const auto code_unit = BigEndian ? static_cast<u16>((lead_ << 8u) | b)
+                                             : static_cast<u16>((b << 8u) | lead_);
+            has_lead_            = false;
+            lead_                = 0;
+
+            if (lead_surrogate_ != 0)
+            {
+                const u16 lead_surrogate = lead_surrogate_;
+                lead_surrogate_          = 0;
+
+                if (code_unit >= 0xdc00 && code_unit <= 0xdfff)
+                {
+                    return emit_(0x10000 + ((lead_surrogate - 0xd800u) << 10u) +
+                                     (code_unit - 0xdc00u),
+                                 append_to);
+                }
+
+                const auto byte1 = static_cast<u8>(code_unit >> 8u);
+                const auto byte2 = static_cast<u8>(code_unit & 0xffu);
+                if (BigEndian)
+                {
+                    restore_(byte1, byte2);
+                }
+                else
+                {
+                    restore_(byte2, byte1);
+                }
+                return error_(append_to);
+            }
+
+            if (code_unit >= 0xd800 && code_unit <= 0xdbff)
+            {
+                lead_surrogate_ = code_unit;
+                return;
+            }
+
+            if (code_unit >= 0xdc00 && code_unit <= 0xdfff)
+            {
+                return error_(append_to);
+            }
+
+            emit_(code_unit, append_to);
+        }
+
+        // https://encoding.spec.whatwg.org/#gb18030-decoder
+        // `lead_` is "gb18030 first".
+        template <typename Buf>
+        constexpr void handle_gb18030_(const u8 b, strcore<Buf>& append_to)
+        {
+            using detail::decoder::is_in_range;
+
+            if (third_ != 0)
+            {
+                if (!is_in_range(b, 0x30, 0x39))
+                {
+                    restore_(second_, third_, b);
+                    has_lead_ = false;
+                    lead_     = 0;
+                    second_   = 0;
+                    third_    = 0;
+                    return error_(append_to);
+                }
+
+                const u32 pointer = ((((lead_ - 0x81u) * 10u + (second_ - 0x30u)) * 126u +
+                                      (third_ - 0x81u)) *
+                                         10u) +
+                                    (b - 0x30u);
+                has_lead_    = false;
+                lead_        = 0;
+                second_      = 0;
+                third_       = 0;
+                const u32 cp = detail::decoder::gb18030_ranges_code_point(pointer);
+                if (cp == 0)
+                {
+                    return error_(append_to);
+                }
+                return emit_(cp, append_to);
+            }
+
+            if (second_ != 0)
+            {
+                if (is_in_range(b, 0x81, 0xfe))
+                {
+                    third_ = b;
+                    return;
+                }
+
+                restore_(second_, b);
+                has_lead_ = false;
+                lead_     = 0;
+                second_   = 0;
+                return error_(append_to);
+            }
+
+            if (has_lead_)
+            {
+                if (is_in_range(b, 0x30, 0x39))
+                {
+                    second_ = b;
+                    return;
+                }
+
+                const u8 lead = lead_;
+                has_lead_     = false;
+                lead_         = 0;
+
+                u32 cp = 0;
+                if (is_in_range(b, 0x40, 0x7e) || is_in_range(b, 0x80, 0xfe))
+                {
+                    const u32 offset  = b < 0x7f ? 0x40 : 0x41;
+                    const u32 pointer = (lead - 0x81u) * 190u + (b - offset);
+                    cp = detail::decoder::index_code_point(
+                        detail::index::gb18030, detail::index::gb18030_first_pointer, pointer);
+                }
+
+                if (cp != 0)
+                {
+                    return emit_(cp, append_to);
+                }
+
+                if (detail::decoder::is_ascii(b))
+                {
+                    restore_(b);
+                }
+                return error_(append_to);
+            }
+
+            if (detail::decoder::is_ascii(b))
+            {
+                return emit_(b, append_to);
+            }
+
+            if (b == 0x80)
+            {
+                return emit_(0x20ac, append_to);
+            }
+
+            if (is_in_range(b, 0x81, 0xfe))
+            {
+                has_lead_ = true;
+                lead_     = b;
+                return;
+            }
+
+            error_(append_to);
+        }
+
+        // https://encoding.spec.whatwg.org/#big5-decoder
+        template <typename Buf>
+        constexpr void handle_big5_(const u8 b, strcore<Buf>& append_to)
+        {
+            using detail::decoder::is_in_range;
+
+            if (has_lead_)
+            {
+                const u8 lead = lead_;
+                has_lead_     = false;
+                lead_         = 0;
+
+                u32 cp = 0;
+                if (is_in_range(b, 0x40, 0x7e) || is_in_range(b, 0xa1, 0xfe))
+                {
+                    const u32 offset  = b < 0x7f ? 0x40 : 0x62;
+                    const u32 pointer = (lead - 0x81u) * 157u + (b - offset);
+
+                    // Pointers that map to two code points.
+                    switch (pointer)
+                    {
+                        case 1133:
+                            emit_(0x00ca, append_to);
+                            return emit_(0x0304, append_to);
+                        case 1135:
+                            emit_(0x00ca, append_to);
+                            return emit_(0x030c, append_to);
+                        case 1164:
+                            emit_(0x00ea, append_to);
+                            return emit_(0x0304, append_to);
+                        case 1166:
+                            emit_(0x00ea, append_to);
+                            return emit_(0x030c, append_to);
+                        default:
+                            break;
+                    }
+
+                    cp = detail::decoder::big5_code_point(pointer);
+                }
+
+                if (cp != 0)
+                {
+                    return emit_(cp, append_to);
+                }
+
+                if (detail::decoder::is_ascii(b))
+                {
+                    restore_(b);
+                }
+                return error_(append_to);
+            }
+
+            if (detail::decoder::is_ascii(b))
+            {
+                return emit_(b, append_to);
+            }
+
+            if (is_in_range(b, 0x81, 0xfe))
+            {
+                has_lead_ = true;
+                lead_     = b;
+                return;
+            }
+
+            error_(append_to);
+        }
+
+        // https://encoding.spec.whatwg.org/#euc-jp-decoder
+        template <typename Buf>
+        constexpr void handle_euc_jp_(const u8 b, strcore<Buf>& append_to)
+        {
+            using detail::decoder::is_in_range;
+
+            if (has_lead_ && lead_ == 0x8e && is_in_range(b, 0xa1, 0xdf))
+            {
+                has_lead_ = false;
+                lead_     = 0;
+                return emit_(0xff61 - 0xa1 + b, append_to);
+            }
+
+            if (has_lead_ && lead_ == 0x8f && is_in_range(b, 0xa1, 0xfe))
+            {
+                jis0212_ = true;
+                lead_    = b;
+                return;
+            }
+
+            if (has_lead_)
+            {
+                const u8 lead = lead_;
+                has_lead_     = false;
+                lead_         = 0;
+
+                u32 cp = 0;
+                if (is_in_range(lead, 0xa1, 0xfe) && is_in_range(b, 0xa1, 0xfe))
+                {
+                    const u32 pointer = (lead - 0xa1u) * 94u + (b - 0xa1u);
+                    if (jis0212_)
+                    {
+                        cp = detail::decoder::index_code_point(
+                            detail::index::jis0212, detail::index::jis0212_first_pointer,
+                            pointer);
+                    }
+                    else
+                    {
+                        cp = detail::decoder::index_code_point(
+                            detail::index::jis0208, detail::index::jis0208_first_pointer,
+                            pointer);
+                    }
+                }
+                jis0212_ = false;
+
+                if (cp != 0)
+                {
+                    return emit_(cp, append_to);
+                }
+
+                if (detail::decoder::is_ascii(b))
+                {
+                    restore_(b);
+                }
+                return error_(append_to);
+            }
+
+            if (detail::decoder::is_ascii(b))
+            {
+                return emit_(b, append_to);
+            }
+
+            if (b == 0x8e || b == 0x8f || is_in_range(b, 0xa1, 0xfe))
+            {
+                has_lead_ = true;
+                lead_     = b;
+                return;
+            }
+
+            error_(append_to);
+        }
+
+        // https://encoding.spec.whatwg.org/#euc-kr-decoder
+        template <typename Buf>
+        constexpr void handle_euc_kr_(const u8 b, strcore<Buf>& append_to)
+        {
+            using detail::decoder::is_in_range;
+
+            if (has_lead_)
+            {
+                const u8 lead = lead_;
+                has_lead_     = false;
+                lead_         = 0;
+
+                u32 cp = 0;
+                if (is_in_range(b, 0x41, 0xfe))
+                {
+                    const u32 pointer = (lead - 0x81u) * 190u + (b - 0x41u);
+                    cp = detail::decoder::index_code_point(
+                        detail::index::euc_kr, detail::index::euc_kr_first_pointer, pointer);
+                }
+
+                if (cp != 0)
+                {
+                    return emit_(cp, append_to);
+                }
+
+                if (detail::decoder::is_ascii(b))
+                {
+                    restore_(b);
+                }
+                return error_(append_to);
+            }
+
+            if (detail::decoder::is_ascii(b))
+            {
+                return emit_(b, append_to);
+            }
+
+            if (is_in_range(b, 0x81, 0xfe))
+            {
+                has_lead_ = true;
+                lead_     = b;
+                return;
+            }
+
+            error_(append_to);
+        }
+
+        // https://encoding.spec.whatwg.org/#shift_jis-decoder
+        template <typename Buf>
+        constexpr void handle_shift_jis_(const u8 b, strcore<Buf>& append_to)
+        {
+            using detail::decoder::is_in_range;
+
+            if (has_lead_)
+            {
+                const u8 lead = lead_;
+                has_lead_     = false;
+                lead_         = 0;
+
+                u32 cp = 0;
+                if (is_in_range(b, 0x40, 0x7e) || is_in_range(b, 0x80, 0xfc))
+                {
+                    const u32 offset      = b < 0x7f ? 0x40 : 0x41;
+                    const u32 lead_offset = lead < 0xa0 ? 0x81 : 0xc1;
+                    const u32 pointer     = (lead - lead_offset) * 188u + (b - offset);
+
+                    // End-user-defined characters (EUDC).
+                    if (pointer >= 8836 && pointer <= 10715)
+                    {
+                        return emit_(0xe000 - 8836 + pointer, append_to);
+                    }
+
+                    cp = detail::decoder::index_code_point(
+                        detail::index::jis0208, detail::index::jis0208_first_pointer, pointer);
+                }
+
+                if (cp != 0)
+                {
+                    return emit_(cp, append_to);
+                }
+
+                if (detail::decoder::is_ascii(b))
+                {
+                    restore_(b);
+                }
+                return error_(append_to);
+            }
+
+            if (detail::decoder::is_ascii(b) || b == 0x80)
+            {
+                return emit_(b, append_to);
+            }
+
+            if (is_in_range(b, 0xa1, 0xdf))
+            {
+                return emit_(0xff61 - 0xa1 + b, append_to);
+            }
+
+            if (is_in_range(b, 0x81, 0x9f) || is_in_range(b, 0xe0, 0xfc))
+            {
+                has_lead_ = true;
+                lead_     = b;
+                return;
+            }
+
+            error_(append_to);
+        }
+
+        // https://encoding.spec.whatwg.org/#iso-2022-jp-decoder
+        template <typename Buf>
+        constexpr void handle_iso2022jp_(const u8 b, strcore<Buf>& append_to)
+        {
+            using detail::decoder::is_in_range;
+
+            switch (state_)
+            {
+                case iso2022jp_state::ascii:
+                    if (b == 0x1b)
+                    {
+                        state_ = iso2022jp_state::escape_start;
+                        return;
+                    }
+                    output_ = false;
+                    if (b <= 0x7f && b != 0x0e && b != 0x0f)
+                    {
+                        return emit_(b, append_to);
+                    }
+                    return error_(append_to);
+
+                case iso2022jp_state::roman:
+                    if (b == 0x1b)
+                    {
+                        state_ = iso2022jp_state::escape_start;
+                        return;
+                    }
+                    output_ = false;
+                    if (b == 0x5c)
+                    {
+                        return emit_(0x00a5, append_to);
+                    }
+                    if (b == 0x7e)
+                    {
+                        return emit_(0x203e, append_to);
+                    }
+                    if (b <= 0x7f && b != 0x0e && b != 0x0f)
+                    {
+                        return emit_(b, append_to);
+                    }
+                    return error_(append_to);
+
+                case iso2022jp_state::katakana:
+                    if (b == 0x1b)
+                    {
+                        state_ = iso2022jp_state::escape_start;
+                        return;
+                    }
+                    output_ = false;
+                    if (is_in_range(b, 0x21, 0x5f))
+                    {
+                        return emit_(0xff61 - 0x21 + b, append_to);
+                    }
+                    return error_(append_to);
+
+                case iso2022jp_state::lead_byte:
+                    if (b == 0x1b)
+                    {
+                        state_ = iso2022jp_state::escape_start;
+                        return;
+                    }
+                    output_ = false;
+                    if (is_in_range(b, 0x21, 0x7e))
+                    {
+                        lead_  = b;
+                        state_ = iso2022jp_state::trail_byte;
+                        return;
+                    }
+                    return error_(append_to);
+
+                case iso2022jp_state::trail_byte:
+                    if (b == 0x1b)
+                    {
+                        state_ = iso2022jp_state::escape_start;
+                        return error_(append_to);
+                    }
+                    state_ = iso2022jp_state::lead_byte;
+                    if (is_in_range(b, 0x21, 0x7e))
+                    {
+                        const u32 pointer = (lead_ - 0x21u) * 94u + (b - 0x21u);
+                        const u32 cp      = detail::decoder::index_code_point(
+                            detail::index::jis0208, detail::index::jis0208_first_pointer, pointer);
+                        if (cp != 0)
+                        {
+                            return emit_(cp, append_to);
+                        }
+                    }
+                    return error_(append_to);
+
+                case iso2022jp_state::escape_start:
+                    if (b == 0x24 || b == 0x28)
+                    {
+                        lead_  = b;
+                        state_ = iso2022jp_state::escape;
+                        return;
+                    }
+                    restore_(b);
+                    output_ = false;
+                    state_  = output_state_;
+                    return error_(append_to);
+
+                case iso2022jp_state::escape:
+                {
+                    const u8 lead = lead_;
+                    lead_         = 0;
+
+                    bool is_valid = true;
+                    auto state    = iso2022jp_state::ascii;
+                    if (lead == 0x28 && b == 0x42)
+                    {
+                        state = iso2022jp_state::ascii;
+                    }
+                    else if (lead == 0x28 && b == 0x4a)
+                    {
+                        state = iso2022jp_state::roman;
+                    }
+                    else if (lead == 0x28 && b == 0x49)
+                    {
+                        state = iso2022jp_state::katakana;
+                    }
+                    else if (lead == 0x24 && (b == 0x40 || b == 0x42))
+                    {
+                        state = iso2022jp_state::lead_byte;
+                    }
+                    else
+                    {
+                        is_valid = false;
+                    }
+
+                    if (is_valid)
+                    {
+                        state_        = state;
+                        output_state_ = state;
+                        const bool output = output_;
+                        output_           = true;
+                        if (output)
+                        {
+                            error_(append_to);
+                        }
+                        return;
+                    }
+
+                    restore_(lead, b);
+                    output_ = false;
+                    state_  = output_state_;
+                    return error_(append_to);
+                }
+            }
+        }
+    };
+}
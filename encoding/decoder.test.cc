@@ -0,0 +1,314 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/encoding/decoder.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/encoding/schemes.hh"
+#include "snn-core/stream/buffered_reader.hh"
+#include "snn-core/string/repeat.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            encoding::decoder d{encoding::scheme::windows1252};
+
+            str s;
+            d.decode("Caf\xE9 ", s);
+            d.decode("\x80", s);
+            d.finish(s);
+            snn_require(s == "Café €");
+            snn_require(!d.has_errors());
+
+            return true;
+        }
+
+        template <typename String = str>
+        constexpr String decode(const encoding::scheme scheme, const cstrview input,
+                                const usize chunk_size = constant::npos)
+        {
+            encoding::decoder d{scheme};
+            String s;
+            cstrview rest = input;
+            while (rest)
+            {
+                d.decode(rest.view(0, chunk_size), s);
+                rest.drop_front_n(chunk_size);
+            }
+            d.finish(s);
+            return s;
+        }
+
+        // Decode in one chunk and in chunks of every small size, the result must be the same.
+        constexpr bool is_decoded(const encoding::scheme scheme, const cstrview input,
+                                  const cstrview expected)
+        {
+            if (decode(scheme, input) != expected)
+            {
+                return false;
+            }
+
+            for (usize chunk_size = 1; chunk_size <= 7; ++chunk_size)
+            {
+                if (decode(scheme, input, chunk_size) != expected)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        class mock_reader final
+        {
+          public:
+            constexpr explicit mock_reader(const cstrview contents,
+                                           const usize max_chunk_size) noexcept
+                : contents_{contents},
+                  max_chunk_size_{max_chunk_size}
+            {
+            }
+
+            [[nodiscard]] constexpr result<usize> read_some(strview buffer) noexcept
+            {
+                const usize size = math::min(buffer.size(), max_chunk_size_, contents_.size());
+                buffer.view(0, size).fill(contents_.view(0, size));
+                contents_.drop_front_n(size);
+                return size;
+            }
+
+          private:
+            cstrview contents_;
+            usize max_chunk_size_;
+        };
+
+        constexpr bool test_decoder()
+        {
+            // Unknown
+            snn_require_throws_code(encoding::decoder{encoding::scheme::unknown},
+                                    generic::error::invalid_value);
+
+            // Every scheme decodes ASCII as is (except replacement, UTF-16 and ISO-2022-JP
+            // control characters).
+            for (const auto scheme : encoding::schemes)
+            {
+                if (scheme == encoding::scheme::unknown ||
+                    scheme == encoding::scheme::replacement ||
+                    scheme == encoding::scheme::utf16be || scheme == encoding::scheme::utf16le)
+                {
+                    continue;
+                }
+
+                encoding::decoder d{scheme};
+                snn_require(d.scheme() == scheme);
+                snn_require(is_decoded(scheme, "", ""));
+                snn_require(is_decoded(scheme, "abc", "abc"));
+                snn_require(is_decoded(scheme, "Hello\tWorld\n", "Hello\tWorld\n"));
+            }
+
+            // Single-byte
+            snn_require(is_decoded(encoding::scheme::windows1252, "\x80\x81\x9F\xFF", "€\u0081Ÿÿ"));
+            snn_require(is_decoded(encoding::scheme::iso8859_1, "\x80", "€"));
+            snn_require(is_decoded(encoding::scheme::windows1253, "\xE1\xAA", "α�"));
+            snn_require(is_decoded(encoding::scheme::windows1251, "\xCF\xF0\xE8\xE2\xE5\xF2",
+                                   "Привет"));
+            snn_require(is_decoded(encoding::scheme::koi8r, "\xF0\xD2\xC9\xD7\xC5\xD4", "Привет"));
+            snn_require(is_decoded(encoding::scheme::ibm866, "\x8F\xE0\xA8\xA2\xA5\xE2",
+                                   "Привет"));
+            snn_require(is_decoded(encoding::scheme::iso8859_5, "\xBF\xE0\xD8\xD2\xD5\xE2",
+                                   "Привет"));
+            snn_require(is_decoded(encoding::scheme::iso8859_7, "\xE1\xE2\xE3", "αβγ"));
+            snn_require(is_decoded(encoding::scheme::iso8859_8, "\xE0", "א"));
+            snn_require(is_decoded(encoding::scheme::iso8859_8i, "\xE0", "א"));
+            snn_require(is_decoded(encoding::scheme::iso8859_15, "\xA4", "€"));
+            snn_require(is_decoded(encoding::scheme::macintosh, "\x80\xDB", "Ä€"));
+            snn_require(is_decoded(encoding::scheme::windows874, "\xA1", "ก"));
+
+            // x-user-defined
+            snn_require(is_decoded(encoding::scheme::x_user_defined, "a\x80\xFF", "a\uF780\uF7FF"));
+
+            // Replacement
+            snn_require(is_decoded(encoding::scheme::replacement, "", ""));
+            snn_require(is_decoded(encoding::scheme::replacement, "abc", "�"));
+
+            // UTF-8
+            snn_require(is_decoded(encoding::scheme::utf8, "åäö €𝄞", "åäö €𝄞"));
+            snn_require(is_decoded(encoding::scheme::utf8, "\xEF\xBB\xBF", "﻿")); // BOM
+            snn_require(is_decoded(encoding::scheme::utf8, "a\xF1\x80\x80", "a�"));
+            snn_require(is_decoded(encoding::scheme::utf8, "\xE0\x80", "��"));
+            snn_require(is_decoded(encoding::scheme::utf8, "\xED\xA0\x80", "���"));
+            snn_require(is_decoded(encoding::scheme::utf8, "\xC3\xC3\xA5", "�å"));
+            snn_require(is_decoded(encoding::scheme::utf8, "\xF4\x90\x80\x80",
+                                   "����"));
+            snn_require(is_decoded(encoding::scheme::utf8, "\xFFz", "�z"));
+
+            // UTF-16
+            snn_require(is_decoded(encoding::scheme::utf16le, cstrview{"h\0i\0", 4}, "hi"));
+            snn_require(is_decoded(encoding::scheme::utf16be, cstrview{"\0h\0i", 4}, "hi"));
+            snn_require(is_decoded(encoding::scheme::utf16le, "\x3D\xD8\x00\xDE", "😀"));
+            snn_require(is_decoded(encoding::scheme::utf16be, "\xD8\x3D\xDE\x00", "😀"));
+            snn_require(is_decoded(encoding::scheme::utf16le, "\x00\xDE", "�"));
+            snn_require(is_decoded(encoding::scheme::utf16le, cstrview{"\x3D\xD8x\0", 4},
+                                   "�x"));
+            snn_require(is_decoded(encoding::scheme::utf16be, cstrview{"\xD8\x3D\0x", 4},
+                                   "�x"));
+            snn_require(is_decoded(encoding::scheme::utf16le, "\x3D\xD8", "�"));
+            snn_require(is_decoded(encoding::scheme::utf16le, "x", "�"));
+
+            // gb18030/GBK
+            snn_require(is_decoded(encoding::scheme::gb18030, "\xC4\xE3\xBA\xC3", "你好"));
+            snn_require(is_decoded(encoding::scheme::gbk, "\xC4\xE3\xBA\xC3", "你好"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x80", "€"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x81\x30\x81\x30", "\u0080"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x84\x31\xA4\x39", "￿"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x90\x30\x81\x30", "𐀀"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\xE3\x32\x9A\x35", "\U0010FFFF"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x84\x32\xA4\x39", "�"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x81\x30\x81z", "�0\u4E83"));
+            // GB18030-2022 mappings (not Private Use Area).
+            snn_require(is_decoded(encoding::scheme::gb18030, "\xA6\xD9\xFE\x59", "\uFE10\u9FB4"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\xA8\xBC", "\u1E3F"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x81\x30z", "�0z"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x81z", "\u4E83"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x81\x7F", "�\x7F"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\xFF", "�"));
+            snn_require(is_decoded(encoding::scheme::gb18030, "\x81\x30\x81", "�"));
+
+            // Big5
+            snn_require(is_decoded(encoding::scheme::big5, "\xA4\xA4\xA4\xE5", "中文"));
+            snn_require(is_decoded(encoding::scheme::big5, "\x88\x62\x88\x64", "Ê̄Ê̌"));
+            snn_require(is_decoded(encoding::scheme::big5, "\x87\x45", "\U00027267"));
+            // HKSCS-2008.
+            snn_require(is_decoded(encoding::scheme::big5, "\x87\x7A", "\u3875"));
+            snn_require(is_decoded(encoding::scheme::big5, "\x87\x7B", "\U00021D53"));
+            snn_require(is_decoded(encoding::scheme::big5, "\x87\x7E\x87\xA3", "\u3EEC\u7AFC"));
+            snn_require(is_decoded(encoding::scheme::big5, "\xA1\x45\xA1\xC2", "\u2027\u00AF"));
+            snn_require(is_decoded(encoding::scheme::big5, "\xA4\n", "�\n"));
+            snn_require(is_decoded(encoding::scheme::big5, "\xA4", "�"));
+
+            // EUC-KR
+            snn_require(is_decoded(encoding::scheme::euc_kr, "\xC7\xD1\xB1\xB9", "한국"));
+            snn_require(is_decoded(encoding::scheme::euc_kr, "\xC7\n", "�\n"));
+
+            // Shift_JIS
+            snn_require(is_decoded(encoding::scheme::shift_jis, "\x93\xFA\x96\x7B", "日本"));
+            snn_require(is_decoded(encoding::scheme::shift_jis, "\xB1\x80", "ｱ\u0080"));
+            snn_require(is_decoded(encoding::scheme::shift_jis, "\xF0\x40", "\uE000"));
+            snn_require(is_decoded(encoding::scheme::shift_jis, "\x93\n", "�\n"));
+            snn_require(is_decoded(encoding::scheme::shift_jis, "\xA0", "�"));
+
+            // EUC-JP
+            snn_require(is_decoded(encoding::scheme::euc_jp, "\xC6\xFC\xCB\xDC", "日本"));
+            snn_require(is_decoded(encoding::scheme::euc_jp, "\x8E\xB1", "ｱ"));
+            snn_require(is_decoded(encoding::scheme::euc_jp, "\x8F\xB0\xA1", "丂"));
+            snn_require(is_decoded(encoding::scheme::euc_jp, "\xC6z", "�z"));
+            snn_require(is_decoded(encoding::scheme::euc_jp, "\x8F\xB0", "�"));
+
+            // ISO-2022-JP
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x1B$B\x46\x7C\x4B\x5C\x1B(B!",
+                                   "日本!"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x1B(I\x31", "ｱ"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x1B(J\x5C\x7E", "¥‾"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x1B(B\x1B(Ba", "�a"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x1B(Xa", "�(Xa"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "a\x1B", "a�"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "a\x1B(", "a�("));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x0E", "�"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x1B$B\x46", "�"));
+            snn_require(is_decoded(encoding::scheme::iso2022jp, "\x1B$B\x46\x1B(Ba",
+                                   "�a"));
+
+            // Errors
+            {
+                encoding::decoder d{encoding::scheme::shift_jis};
+                str s;
+                d.decode("abc", s);
+                d.finish(s);
+                snn_require(!d.has_errors());
+                d.decode("\x93", s);
+                snn_require(s == "abc");
+                d.finish(s);
+                snn_require(s == "abc�");
+                snn_require(d.has_errors());
+
+                // The decoder is reset by finish().
+                d.decode("\x93\xFA", s);
+                d.finish(s);
+                snn_require(s == "abc�日");
+            }
+
+            return true;
+        }
+
+        bool test_buffered_reader()
+        {
+            const str input = string::repeat("\x93\xFA\x96\x7B, ", 100);
+            const str expected = string::repeat("日本, ", 100);
+
+            for (const auto max_chunk_size : init_list<usize>{1, 2, 3, 5, 99, 8192})
+            {
+                stream::buffered_reader br{mock_reader{input, max_chunk_size}};
+                encoding::decoder d{encoding::scheme::shift_jis};
+                str s;
+                while (true)
+                {
+                    const cstrview chunk = br.read<cstrview>().value();
+                    if (chunk.is_empty())
+                    {
+                        break;
+                    }
+                    d.decode(chunk, s);
+                }
+                d.finish(s);
+                snn_require(s == expected);
+            }
+
+            return true;
+        }
+
+        bool test_ascii_fast_path()
+        {
+            // A non-ASCII character at every position of long ASCII strings.
+            for (usize size = 0; size < 100; ++size)
+            {
+                for (usize pos = 0; pos <= size; ++pos)
+                {
+                    str input{init::fill, size, 'a'};
+                    str expected = input;
+                    input.insert_at(pos, "\xE9");
+                    expected.insert_at(pos, "é");
+                    snn_require(decode(encoding::scheme::windows1252, input) == expected);
+                    snn_require(decode(encoding::scheme::windows1252, input, 5) == expected);
+
+                    input.replace("\xE9", "\xC4\xE3");
+                    expected.replace("é", "你");
+                    snn_require(decode(encoding::scheme::gb18030, input) == expected);
+                    snn_require(decode(encoding::scheme::gb18030, input, 5) == expected);
+
+                    input.replace("\xC4\xE3", "\x1B(B");
+                    expected.replace("你", "");
+                    snn_require(decode(encoding::scheme::iso2022jp, input) == expected);
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_decoder());
+
+        snn_require(app::example());
+        snn_require(app::test_decoder());
+        snn_require(app::test_buffered_reader());
+        snn_require(app::test_ascii_fast_path());
+    }
+}
@@ -0,0 +1,326 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// Generates `index/*.hh` from the WHATWG index files (index-*.txt) in the current directory.
+// Download here: https://encoding.spec.whatwg.org/#indexes
+
+#include "snn-core/main.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/ascii/trim.hh"
+#include "snn-core/chr/common.hh"
+#include "snn-core/file/read.hh"
+#include "snn-core/file/write.hh"
+#include "snn-core/file/dir/create_recursive.hh"
+#include "snn-core/fmt/print.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/string/split.hh"
+#include "snn-core/string/range/split.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        struct index_entry final
+        {
+            u32 pointer;
+            u32 code_point;
+        };
+
+        constexpr cstrview header_start =
+            "// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.\n"
+            "// SPDX-License-Identifier: BSL-1.0 AND BSD-3-Clause\n"
+            "// Generated from index-*.txt from WHATWG (see LICENSE.md).\n"
+            "// Copyright (c) WHATWG (Apple, Google, Mozilla, Microsoft).\n"
+            "\n"
+            "// This file is generated, DO NOT EDIT MANUALLY.\n"
+            "\n";
+
+        // Name to variable name, e.g. "iso-8859-2" to "iso8859_2" (same as `encoding::scheme`).
+        str variable_name(const cstrview name)
+        {
+            str var;
+            const usize size = name.size();
+            for (usize i = 0; i < size; ++i)
+            {
+                const char c = name.at(i, assume::within_bounds);
+                if (c == '-')
+                {
+                    const char prev = (i > 0) ? name.at(i - 1, assume::within_bounds) : '\0';
+                    const char next = name.at(i + 1).value_or('\0');
+                    // Keep a separator between two numbers, e.g. "8859-2".
+                    if (chr::is_digit(prev) && chr::is_digit(next))
+                    {
+                        var << '_';
+                    }
+                    else if (!chr::is_digit(next) && !chr::is_digit(prev))
+                    {
+                        var << '_';
+                    }
+                }
+                else
+                {
+                    var << chr::to_alpha_lower(c);
+                }
+            }
+            return var;
+        }
+
+        vec<index_entry> read_index(const cstrview name)
+        {
+            str path{"index-"};
+            path << name << ".txt";
+
+            auto data = file::read<str>(path).value_or_default();
+            if (!data)
+            {
+                throw_or_abort(generic::error::invalid_value);
+            }
+
+            vec<index_entry> entries;
+            for (cstrview line : string::range::split{data, '\n'})
+            {
+                ascii::trim_inplace(line);
+                if (line.is_empty() || line.has_front('#'))
+                {
+                    continue;
+                }
+
+                const auto fields = string::split<cstrview>(line, '\t');
+                if (fields.count() < 2)
+                {
+                    throw_or_abort(generic::error::invalid_value);
+                }
+
+                cstrview code_point = fields.at(1).value();
+                if (!code_point.has_front("0x"))
+                {
+                    throw_or_abort(generic::error::invalid_value);
+                }
+                code_point.drop_front_n(string_size("0x"));
+
+                const auto cp =
+                    code_point.to_prefix<u32, math::base::hex>(ascii::leading_zeros::allow);
+                if (cp.count != code_point.size())
+                {
+                    throw_or_abort(generic::error::invalid_value);
+                }
+
+                entries.append(index_entry{fields.at(0).value().to<u32>().value(), cp.value});
+            }
+
+            if (entries.is_empty())
+            {
+                throw_or_abort(generic::error::invalid_value);
+            }
+
+            return entries;
+        }
+
+        void append_u16_array(strbuf& hh, const cstrview var, const vec<index_entry>& entries,
+                              const u32 first_pointer, const u32 last_pointer)
+        {
+            constexpr usize per_line = 10;
+
+            vec<u16> code_points;
+            for (u32 p = first_pointer; p <= last_pointer; ++p)
+            {
+                code_points.append(0);
+            }
+            for (const auto& e : entries)
+            {
+                code_points.at(e.pointer - first_pointer).value() =
+                    static_cast<u16>(e.code_point & 0xffff);
+            }
+
+            hh << "    // clang-format off\n";
+            hh << "    inline constexpr array<u16, " << as_num(code_points.count()) << "> " << var
+               << "{\n";
+            for (usize i = 0; i < code_points.count(); ++i)
+            {
+                hh << (((i % per_line) == 0) ? cstrview{"        0x"} : cstrview{" 0x"});
+                hh.append_integral<math::base::hex>(code_points.at(i, assume::within_bounds), 4);
+                hh << ',';
+                if ((i % per_line) == (per_line - 1) || (i + 1) == code_points.count())
+                {
+                    hh << '\n';
+                }
+            }
+            hh << "    };\n";
+            hh << "    // clang-format on\n";
+        }
+
+        void write_header(const cstrview filename, const cstrview title, const strbuf& body)
+        {
+            strbuf hh{init::reserve, 256 * constant::size::kibibyte<usize>};
+            hh << header_start;
+            hh << "// # " << title << "\n\n";
+            hh << "#pragma once\n\n";
+            hh << "#include \"snn-core/array.hh\"\n\n";
+            hh << "namespace snn::encoding::detail::index\n";
+            hh << "{\n";
+            hh << "    // Generated by: detail/index.gen.cc\n\n";
+            hh << body;
+            hh << "}\n";
+
+            str path{"index/"};
+            path << filename;
+            file::write(path, hh).or_throw();
+        }
+
+        void generate_single_byte()
+        {
+            const array<cstrview, 27> names{
+                "ibm866",      "iso-8859-2",     "iso-8859-3",   "iso-8859-4",
+                "iso-8859-5",  "iso-8859-6",     "iso-8859-7",   "iso-8859-8",
+                "iso-8859-10", "iso-8859-13",    "iso-8859-14",  "iso-8859-15",
+                "iso-8859-16", "koi8-r",         "koi8-u",       "macintosh",
+                "windows-874", "windows-1250",   "windows-1251", "windows-1252",
+                "windows-1253", "windows-1254",  "windows-1255", "windows-1256",
+                "windows-1257", "windows-1258",  "x-mac-cyrillic",
+            };
+
+            strbuf body;
+            body << "    // ## Arrays\n\n";
+            body << "    // Code points for the bytes 0x80-0xFF, 0 if a byte has no code point."
+                    "\n\n";
+            for (const cstrview name : names)
+            {
+                const auto entries = read_index(name);
+                const str var      = variable_name(name);
+                body << "    // ### " << var << "\n\n";
+                append_u16_array(body, var, entries, 0, 127);
+                body << "\n";
+            }
+            body.drop_back_n(string_size("\n"));
+
+            write_header("single_byte.hh", "Single-byte indexes", body);
+        }
+
+        void generate_multi_byte(const cstrview name, const cstrview title)
+        {
+            const auto entries = read_index(name);
+            const str var      = variable_name(name);
+
+            u32 first_pointer = constant::limit<u32>::max;
+            u32 last_pointer  = 0;
+            for (const auto& e : entries)
+            {
+                first_pointer = math::min(first_pointer, e.pointer);
+                last_pointer  = math::max(last_pointer, e.pointer);
+            }
+
+            strbuf body;
+            body << "    // ## Constants\n\n";
+            body << "    // ### " << var << "_first_pointer\n\n";
+            body << "    inline constexpr usize " << var << "_first_pointer = "
+                 << as_num(first_pointer) << ";\n\n";
+
+            body << "    // ## Arrays\n\n";
+            body << "    // ### " << var << "\n\n";
+            body << "    // Code points (the lower 16 bits) by pointer (minus the first pointer),"
+                    "\n";
+            body << "    // 0 if a pointer has no code point.\n\n";
+            append_u16_array(body, var, entries, first_pointer, last_pointer);
+
+            // Code points outside of the Basic Multilingual Plane (Big5 only), all in plane 2.
+            bool has_supplementary = false;
+            for (const auto& e : entries)
+            {
+                if (e.code_point > 0xffff)
+                {
+                    // A lower 16 bits of zero would be read as "no code point".
+                    if ((e.code_point >> 16) != 2 || (e.code_point & 0xffff) == 0)
+                    {
+                        throw_or_abort(generic::error::invalid_value);
+                    }
+                    has_supplementary = true;
+                }
+            }
+
+            if (has_supplementary)
+            {
+                vec<u64> bits;
+                for (u32 i = 0; i <= (last_pointer - first_pointer) / 64; ++i)
+                {
+                    bits.append(0);
+                }
+                for (const auto& e : entries)
+                {
+                    if (e.code_point > 0xffff)
+                    {
+                        const u32 i = e.pointer - first_pointer;
+                        bits.at(i / 64).value() |= (u64{1} << (i % 64));
+                    }
+                }
+
+                body << "\n";
+                body << "    // ### " << var << "_plane2\n\n";
+                body << "    // One bit per pointer (minus the first pointer), set if the code "
+                        "point is in plane 2\n";
+                body << "    // (0x20000 is added to the code point).\n\n";
+                body << "    // clang-format off\n";
+                body << "    inline constexpr array<u64, " << as_num(bits.count()) << "> " << var
+                     << "_plane2{\n";
+                for (usize i = 0; i < bits.count(); ++i)
+                {
+                    body << (((i % 4) == 0) ? cstrview{"        0x"} : cstrview{" 0x"});
+                    body.append_integral<math::base::hex>(bits.at(i, assume::within_bounds), 16);
+                    body << ',';
+                    if ((i % 4) == 3 || (i + 1) == bits.count())
+                    {
+                        body << '\n';
+                    }
+                }
+                body << "    };\n";
+                body << "    // clang-format on\n";
+            }
+
+            str filename = var;
+            filename << ".hh";
+            write_header(filename, title, body);
+        }
+
+        void generate_gb18030_ranges()
+        {
+            const auto entries = read_index("gb18030-ranges");
+
+            strbuf body;
+            body << "    // ## Arrays\n\n";
+            body << "    // ### gb18030_ranges\n\n";
+            body << "    // Sorted pairs of {pointer, code point}, consecutive pointers map to "
+                    "consecutive\n";
+            body << "    // code points.\n\n";
+            body << "    // clang-format off\n";
+            body << "    inline constexpr array<array<u32, 2>, " << as_num(entries.count())
+                 << "> gb18030_ranges{{\n";
+            for (const auto& e : entries)
+            {
+                body << "        {" << as_num(e.pointer) << ", 0x";
+                body.append_integral<math::base::hex>(e.code_point, 4);
+                body << "},\n";
+            }
+            body << "    }};\n";
+            body << "    // clang-format on\n";
+
+            write_header("gb18030_ranges.hh", "GB18030 ranges index", body);
+        }
+    }
+}
+
+namespace snn
+{
+    int main(array_view<const env::argument>)
+    {
+        file::dir::create_recursive("index").or_throw();
+
+        app::generate_single_byte();
+        app::generate_multi_byte("big5", "Big5 index");
+        app::generate_multi_byte("euc-kr", "EUC-KR index");
+        app::generate_multi_byte("gb18030", "GB18030 index");
+        app::generate_multi_byte("jis0208", "JIS X 0208 index");
+        app::generate_multi_byte("jis0212", "JIS X 0212 index");
+        app::generate_gb18030_ranges();
+
+        return constant::exit::success;
+    }
+}
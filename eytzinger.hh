@@ -0,0 +1,225 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Eytzinger layout for static sorted tables
+
+// A sorted range stored in breadth-first (Eytzinger) order: the root first, then both children of
+// the root, then the four grandchildren and so on. Node `k` (one-based) has its children at `2k`
+// and `2k + 1`, so a lookup walks the array front to back and the first levels of the tree share
+// a few cache lines. The descendants four levels down (for small elements) are contiguous, which
+// makes it possible to prefetch them while the current node is compared.
+
+// Lookups are branchless and return a position in the Eytzinger order (use `at(pos)`), not an
+// index in the sorted order. Values that need a payload should store it with the key and use a
+// custom `is_less` that compares the key.
+
+// For small tables or tables that change, use `algo::find_greater_than(...)` and friends on a
+// sorted `vec<T>` instead.
+
+#pragma once
+
+#include "snn-core/optional_index.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/fn/common.hh"
+#include "snn-core/math/common.hh"
+#include <bit> // bit_floor, countr_one, countr_zero
+
+namespace snn
+{
+    // ## Classes
+
+    // ### eytzinger
+
+    template <typename T>
+    class eytzinger final
+    {
+      public:
+        // #### Types
+
+        using value_type      = T;
+        using const_reference = const T&;
+
+        // #### Constructors
+
+        constexpr eytzinger() noexcept = default;
+
+        template <random_access_range RandomAccessRng>
+            requires legacy_iterable<RandomAccessRng>
+        constexpr explicit eytzinger(RandomAccessRng sorted, assume::is_sorted_t)
+        {
+            const usize count = to_usize(sorted.end() - sorted.begin());
+
+            // Sorted index of every node.
+            vec<usize> order{init::reserve, count};
+            for (usize i = 0; i < count; ++i)
+            {
+                order.append(0);
+            }
+            usize next = 0;
+            assign_order_(order, 1, next);
+
+            elements_.reserve(count);
+            for (const usize i : order)
+            {
+                elements_.append(sorted.at(i, assume::within_bounds));
+            }
+        }
+
+        // #### Single element access
+
+        [[nodiscard]] constexpr optional<const T&> at(const usize pos) const noexcept
+        {
+            return elements_.at(pos);
+        }
+
+        [[nodiscard]] constexpr const T& at(const usize pos, assume::within_bounds_t) const noexcept
+        {
+            return elements_.at(pos, assume::within_bounds);
+        }
+
+        // #### Count
+
+        [[nodiscard]] constexpr usize count() const noexcept
+        {
+            return elements_.count();
+        }
+
+        [[nodiscard]] constexpr bool is_empty() const noexcept
+        {
+            return elements_.is_empty();
+        }
+
+        // #### Range
+
+        // All elements in Eytzinger order.
+
+        [[nodiscard]] constexpr auto range() const noexcept
+        {
+            return elements_.range();
+        }
+
+        // #### Find
+
+        // Position of the first element (in sorted order) greater than `value`.
+
+        template <typename V, typename TwoArgPred>
+        [[nodiscard]] constexpr optional_index find_greater_than(const V& value,
+                                                                 TwoArgPred is_less) const
+        {
+            const usize k = descend_([&](const T& e) { return !is_less(value, e); });
+            return node_(k >> (std::countr_one(k) + 1));
+        }
+
+        template <typename V>
+        [[nodiscard]] constexpr optional_index find_greater_than(const V& value) const
+        {
+            return find_greater_than(value, fn::less_than{});
+        }
+
+        // Position of the first element (in sorted order) greater than or equal to `value`.
+
+        template <typename V, typename TwoArgPred>
+        [[nodiscard]] constexpr optional_index find_greater_than_or_equal_to(
+            const V& value, TwoArgPred is_less) const
+        {
+            const usize k = descend_([&](const T& e) { return is_less(e, value); });
+            return node_(k >> (std::countr_one(k) + 1));
+        }
+
+        template <typename V>
+        [[nodiscard]] constexpr optional_index find_greater_than_or_equal_to(const V& value) const
+        {
+            return find_greater_than_or_equal_to(value, fn::less_than{});
+        }
+
+        // Position of the last element (in sorted order) less than `value`.
+
+        template <typename V, typename TwoArgPred>
+        [[nodiscard]] constexpr optional_index find_less_than(const V& value,
+                                                              TwoArgPred is_less) const
+        {
+            const usize k = descend_([&](const T& e) { return is_less(e, value); });
+            return node_(k >> (std::countr_zero(k) + 1));
+        }
+
+        template <typename V>
+        [[nodiscard]] constexpr optional_index find_less_than(const V& value) const
+        {
+            return find_less_than(value, fn::less_than{});
+        }
+
+        // Position of the last element (in sorted order) less than or equal to `value`.
+
+        template <typename V, typename TwoArgPred>
+        [[nodiscard]] constexpr optional_index find_less_than_or_equal_to(
+            const V& value, TwoArgPred is_less) const
+        {
+            const usize k = descend_([&](const T& e) { return !is_less(value, e); });
+            return node_(k >> (std::countr_zero(k) + 1));
+        }
+
+        template <typename V>
+        [[nodiscard]] constexpr optional_index find_less_than_or_equal_to(const V& value) const
+        {
+            return find_less_than_or_equal_to(value, fn::less_than{});
+        }
+
+      private:
+        vec<T> elements_;
+
+        // Prefetch the descendants this many nodes ahead (a power of two), about one cache line.
+        static constexpr usize prefetch_stride_ =
+            std::bit_floor(math::max(64 / sizeof(T), usize{1}));
+
+        // Walk from the root to a leaf, going right when `go_right(node)` is true. The returned
+        // node number encodes the path: one bit per level after the leading one bit.
+        template <typename OneArgPred>
+        [[nodiscard]] constexpr usize descend_(const OneArgPred go_right) const
+        {
+            const usize count = elements_.count();
+            const T* const data = elements_.begin();
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            usize k = 1;
+            while (k <= count)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const usize ahead = k * prefetch_stride_;
+                    if (ahead <= count)
+                    {
+                        __builtin_prefetch(data + (ahead - 1));
+                    }
+                }
+                k = (2 * k) + static_cast<usize>(static_cast<bool>(go_right(data[k - 1])));
+            }
+
+            SNN_DIAGNOSTIC_POP
+
+            return k;
+        }
+
+        [[nodiscard]] static constexpr optional_index node_(const usize k) noexcept
+        {
+            if (k > 0)
+            {
+                return optional_index{k - 1, assume::within_bounds};
+            }
+            return constant::npos;
+        }
+
+        // In-order traversal of the implicit tree.
+        static constexpr void assign_order_(vec<usize>& order, const usize k, usize& next) noexcept
+        {
+            if (k <= order.count())
+            {
+                assign_order_(order, 2 * k, next);
+                order.at(k - 1, assume::within_bounds) = next;
+                ++next;
+                assign_order_(order, (2 * k) + 1, next);
+            }
+        }
+    };
+}
@@ -0,0 +1,175 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/eytzinger.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/algo/find_greater_than.hh"
+#include "snn-core/algo/find_greater_than_or_equal_to.hh"
+#include "snn-core/pair/common.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            const array<int, 7> sorted{2, 3, 5, 7, 11, 13, 17};
+
+            const eytzinger<int> table{sorted.range(), assume::is_sorted};
+            snn_require(table.count() == 7);
+
+            // Breadth-first order.
+            snn_require(table.at(0).value() == 7);
+            snn_require(table.at(1).value() == 3);
+            snn_require(table.at(2).value() == 13);
+            snn_require(table.at(6).value() == 17);
+            snn_require(!table.at(7).has_value());
+
+            // Lookups return a position in the Eytzinger order.
+            const optional_index pos = table.find_greater_than(7);
+            snn_require(pos.has_value());
+            snn_require(table.at(pos.value(), assume::within_bounds) == 11);
+
+            snn_require(table.at(table.find_greater_than_or_equal_to(7).value()).value() == 7);
+            snn_require(table.at(table.find_less_than(7).value()).value() == 5);
+            snn_require(table.at(table.find_less_than_or_equal_to(8).value()).value() == 7);
+
+            snn_require(!table.find_greater_than(17).has_value());
+            snn_require(!table.find_less_than(2).has_value());
+
+            return true;
+        }
+
+        // Compare against a linear search in sorted order.
+        constexpr bool test_eytzinger_count(const usize count)
+        {
+            vec<int> sorted;
+            for (usize i = 0; i < count; ++i)
+            {
+                // Duplicates.
+                sorted.append(static_cast<int>((i / 2) * 4));
+            }
+
+            const eytzinger<int> table{sorted.range(), assume::is_sorted};
+            snn_require(table.count() == count);
+
+            const auto value_at = [&table](const optional_index pos) {
+                return table.at(pos.value(), assume::within_bounds);
+            };
+
+            const int max = static_cast<int>(count * 2) + 2;
+            for (int v = -2; v <= max; ++v)
+            {
+                optional_index gt  = constant::npos;
+                optional_index gte = constant::npos;
+                optional_index lt  = constant::npos;
+                optional_index lte = constant::npos;
+                usize i            = 0;
+                for (; i < count && sorted.at(i, assume::within_bounds) <= v; ++i)
+                {
+                }
+                if (i < count)
+                {
+                    gt = optional_index{i, assume::within_bounds};
+                }
+                for (i = 0; i < count && sorted.at(i, assume::within_bounds) < v; ++i)
+                {
+                }
+                if (i < count)
+                {
+                    gte = optional_index{i, assume::within_bounds};
+                }
+                if (i > 0)
+                {
+                    lt = optional_index{i - 1, assume::within_bounds};
+                }
+                for (i = 0; i < count && sorted.at(i, assume::within_bounds) <= v; ++i)
+                {
+                }
+                if (i > 0)
+                {
+                    lte = optional_index{i - 1, assume::within_bounds};
+                }
+
+                const auto check = [&](const optional_index expected, const optional_index pos) {
+                    if (expected.has_value())
+                    {
+                        return pos.has_value() &&
+                               value_at(pos) == sorted.at(expected.value(), assume::within_bounds);
+                    }
+                    return !pos.has_value();
+                };
+
+                snn_require(check(gt, table.find_greater_than(v)));
+                snn_require(check(gte, table.find_greater_than_or_equal_to(v)));
+                snn_require(check(lt, table.find_less_than(v)));
+                snn_require(check(lte, table.find_less_than_or_equal_to(v)));
+
+                // Same as a binary search on the sorted range.
+                snn_require(check(algo::find_greater_than(sorted.range(), v, assume::is_sorted),
+                                  table.find_greater_than(v)));
+                snn_require(check(
+                    algo::find_greater_than_or_equal_to(sorted.range(), v, assume::is_sorted),
+                    table.find_greater_than_or_equal_to(v)));
+            }
+
+            return true;
+        }
+
+        constexpr bool test_eytzinger()
+        {
+            {
+                const eytzinger<int> table;
+                snn_require(table.is_empty());
+                snn_require(!table.find_greater_than(0).has_value());
+                snn_require(!table.find_less_than_or_equal_to(0).has_value());
+            }
+            {
+                for (usize count = 0; count <= 40; ++count)
+                {
+                    snn_require(test_eytzinger_count(count));
+                }
+            }
+            {
+                // Payload with a custom comparison (lookup by key).
+                using entry = pair::first_second<int, cstrview>;
+                const array<entry, 4> sorted{
+                    entry{10, "ten"},
+                    entry{20, "twenty"},
+                    entry{30, "thirty"},
+                    entry{40, "forty"},
+                };
+
+                const eytzinger<entry> table{sorted.range(), assume::is_sorted};
+                const auto is_less = [](const auto& a, const auto& b) {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(a)>, int>)
+                    {
+                        return a < b.first;
+                    }
+                    else
+                    {
+                        return a.first < b;
+                    }
+                };
+
+                const optional_index pos = table.find_less_than_or_equal_to(35, is_less);
+                snn_require(table.at(pos.value(), assume::within_bounds).second == "thirty");
+                snn_require(!table.find_less_than_or_equal_to(9, is_less).has_value());
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_eytzinger());
+
+        snn_require(app::test_eytzinger_count(1'000));
+    }
+}
@@ -10,8 +10,9 @@
 #include "snn-core/strcore.fwd.hh"
 #include "snn-core/file/error.hh"
 #include "snn-core/system/error.hh"
-#include <cerrno>   // errno, EINTR
-#include <unistd.h> // read, write
+#include <cerrno>    // errno, EINTR
+#include <sys/uio.h> // iovec, writev
+#include <unistd.h>  // read, write
 
 namespace snn::file::io
 {
@@ -93,6 +94,33 @@ namespace snn::file::io
             return error_code{errno, system::error_category};
         }
 
+        // Write up to `first.size() + second.size()` bytes with a single system call (`writev`).
+        // Returns the number of bytes written.
+
+        [[nodiscard]] result<usize> write_some(const int fd, const transient<cstrview> first,
+                                               const transient<cstrview> second) noexcept
+        {
+            const cstrview a = first.get();
+            const cstrview b = second.get();
+
+            // `iovec::iov_base` is non-const but is only read from by `writev`.
+            const ::iovec iov[2] = {
+                {const_cast<char*>(a.data().get()), a.size()},
+                {const_cast<char*>(b.data().get()), b.size()},
+            };
+
+            do
+            {
+                const isize bytes_written = ::writev(fd, iov, 2);
+                if (bytes_written >= 0)
+                {
+                    return to_usize(bytes_written);
+                }
+                snn_should(bytes_written == -1);
+            } while (errno == EINTR);
+            return error_code{errno, system::error_category};
+        }
+
         // #### write_all
 
         // Write until `buffer` is empty or an error occurs.
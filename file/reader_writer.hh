@@ -173,6 +173,18 @@ namespace snn::file
             return io_.write_some(fd_.value_or(-1), buffer);
         }
 
+        // Write up to `first.size() + second.size()` bytes with a single (vectored) write.
+        // Returns the number of bytes written.
+
+        [[nodiscard]] result<usize> write_some(const transient<cstrview> first,
+                                               const transient<cstrview> second) noexcept
+            requires(snn::io::writable<Io> && requires(Io& io) {
+                { io.write_some(int{}, cstrview{}, cstrview{}) } -> same_as<result<usize>>;
+            })
+        {
+            return io_.write_some(fd_.value_or(-1), first, second);
+        }
+
         // Write until `buffer` is empty or an error occurs.
 
         [[nodiscard]] result<void> write_all(const transient<cstrview> buffer) noexcept
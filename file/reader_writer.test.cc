@@ -92,6 +92,37 @@ namespace snn
             snn_require(res.error_code() == make_error_code(EBADF, system::error_category));
         }
 
+        // result<usize> write_some(const transient<cstrview> first,
+        //                          const transient<cstrview> second)
+        {
+            const str tmp_dir  = file::dir::create_temporary("snn-unittest-").value();
+            const str tmp_file = file::path::join(tmp_dir, "foobar");
+
+            file::reader_writer rw;
+
+            // Not open.
+            const auto res = rw.write_some("abc", "def");
+            snn_require(!res);
+            snn_require(res.error_code() == make_error_code(EBADF, system::error_category));
+
+            snn_require(rw.open_for_writing(tmp_file));
+
+            // Both buffers are written with a single call.
+            snn_require(rw.write_some("abc", "defghi").value_or_default() == 9);
+
+            // Empty buffers.
+            snn_require(rw.write_some("", "jkl").value_or_default() == 3);
+            snn_require(rw.write_some("mno", "").value_or_default() == 3);
+            snn_require(rw.write_some("", "").value_or_default() == 0);
+
+            snn_require(rw.close());
+
+            snn_require(file::read(tmp_file).value() == "abcdefghijklmno");
+
+            snn_require(file::remove(tmp_file));
+            snn_require(file::dir::remove(tmp_dir));
+        }
+
         // explicit reader_writer(const null_terminated path, ...)
         {
             const str tmp_dir  = file::dir::create_temporary("snn-unittest-").value();
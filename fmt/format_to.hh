@@ -0,0 +1,28 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Format to a buffered writer
+
+// Formats directly into the buffer of a `stream::buffered_writer` (no temporary string), the
+// buffer is written to the stream when it is full.
+
+#pragma once
+
+#include "snn-core/fmt/format.hh"
+#include "snn-core/stream/buffered_writer.hh"
+
+namespace snn::fmt
+{
+    // ## Functions
+
+    // ### format_to
+
+    template <typename Stream, typename... Args>
+    [[nodiscard]] constexpr result<void> format_to(stream::buffered_writer<Stream>& writer,
+                                                   const transient<cstrview> string,
+                                                   const Args&... args)
+    {
+        fmt::format_append(string, writer.buffer(), assume::no_overlap, args...);
+        return writer.flush_if_full();
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/fmt/format_to.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/file/read.hh"
+#include "snn-core/file/reader_writer.hh"
+#include "snn-core/file/remove.hh"
+#include "snn-core/file/dir/create_temporary.hh"
+#include "snn-core/file/dir/remove.hh"
+#include "snn-core/file/path/join.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            const str tmp_dir  = file::dir::create_temporary("snn-unittest-").value();
+            const str tmp_file = file::path::join(tmp_dir, "export.csv");
+
+            file::reader_writer rw;
+            snn_require(rw.open_for_writing(tmp_file));
+
+            stream::buffered_writer bw{std::move(rw)};
+            for (usize i = 0; i < 1000; ++i)
+            {
+                snn_require(fmt::format_to(bw, "{},{}\n", i, i * 2));
+            }
+            snn_require(bw.flush());
+
+            const str contents = file::read(tmp_file).value();
+            snn_require(contents.count('\n') == 1000);
+            snn_require(contents.has_front("0,0\n1,2\n2,4\n"));
+            snn_require(contents.has_back("998,1996\n999,1998\n"));
+
+            snn_require(file::remove(tmp_file));
+            snn_require(file::dir::remove(tmp_dir));
+
+            return true;
+        }
+
+        class mock_writer final
+        {
+          public:
+            constexpr explicit mock_writer(str& output) noexcept
+                : output_{output}
+            {
+            }
+
+            [[nodiscard]] constexpr result<usize> write_some(const transient<cstrview> data)
+            {
+                output_.append(data.get());
+                return data.get().size();
+            }
+
+            [[nodiscard]] constexpr result<void> write_all(const transient<cstrview> data)
+            {
+                output_.append(data.get());
+                return {};
+            }
+
+          private:
+            str& output_;
+        };
+
+        constexpr bool test_format_to()
+        {
+            str output;
+            {
+                stream::buffered_writer bw{mock_writer{output}, 512};
+                snn_require(fmt::format_to(bw, "{} + {} = {}", 1, 2, 3));
+                snn_require(bw.buffered_size() == 9);
+                snn_require(output.is_empty());
+
+                // Flushed when full.
+                for (usize i = 0; i < 200; ++i)
+                {
+                    snn_require(fmt::format_to(bw, "[{:3}]", i));
+                }
+                snn_require(output.size() >= 512);
+                snn_require(bw.buffered_size() < 512);
+            }
+            snn_require(output.size() == 1009);
+            snn_require(output.view(0, 19) == "1 + 2 = 3[000][001]");
+            snn_require(output.view(1004) == "[199]");
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_static_require(app::test_format_to());
+    }
+}
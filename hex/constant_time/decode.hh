@@ -0,0 +1,106 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Decode string in constant time
+
+// For secrets (e.g. keys). The time taken only depends on the size of the string and not on its
+// contents: there are no table lookups or branches on the characters and an invalid character is
+// only reported after all characters have been decoded. Any decoded data is wiped on error.
+
+#pragma once
+
+#include "snn-core/result.hh"
+#include "snn-core/strcore.hh"
+#include "snn-core/hex/error.hh"
+#include "snn-core/mem/raw/zero.hh"
+
+namespace snn::hex::constant_time
+{
+    namespace detail
+    {
+        // Returns the nibble in the low 4 bits and `0xff` in bits 8-15 if the character is valid.
+        // Same approach as `sodium_hex2bin()` in libsodium.
+        [[nodiscard]] inline u32 decode_nibble(const char c) noexcept
+        {
+            const u32 b          = to_byte(c);
+            const u32 num        = (b ^ 48u) & 0xffu;                      // '0'-'9' to 0-9.
+            const u32 num_mask   = (num - 10u) >> 8u;                      // Non-zero if 0-9.
+            const u32 alpha      = ((b & ~32u) - 55u) & 0xffu;             // 'A'-'F' to 10-15.
+            const u32 alpha_mask = ((alpha - 10u) ^ (alpha - 16u)) >> 8u; // Non-zero if 10-15.
+            const u32 valid      = (num_mask | alpha_mask) & 0xffu;
+            const u32 value      = ((num_mask & num) | (alpha_mask & alpha)) & 0x0fu;
+            return (valid << 8u) | value;
+        }
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        template <typename Buf>
+        [[nodiscard]] __attribute__((noinline)) result<void> decode(const cstrview string,
+                                                                    strcore<Buf>& append_to)
+        {
+            // The size is not secret.
+            if (string.size() % 2 != 0)
+            {
+                return error::invalid_size;
+            }
+
+            const usize size_restore = append_to.size();
+            strview buffer           = append_to.append_for_overwrite(string.size() / 2);
+            char* dest               = buffer.begin();
+
+            // All bits set if all characters are valid.
+            u32 valid = 0xffu;
+
+            const char* cur        = string.begin();
+            const char* const last = string.end();
+            while (cur != last)
+            {
+                const u32 hi = decode_nibble(*(cur++));
+                const u32 lo = decode_nibble(*(cur++));
+                valid &= (hi >> 8u) & (lo >> 8u);
+                *(dest++) = static_cast<char>(((hi & 0x0fu) << 4u) | (lo & 0x0fu));
+            }
+            snn_should(dest == buffer.end());
+
+            if (valid != 0xffu)
+            {
+                mem::raw::zero(buffer);
+                append_to.truncate(size_restore);
+                return error::invalid_character;
+            }
+
+            return {};
+        }
+
+        SNN_DIAGNOSTIC_POP
+    }
+
+    // ## Functions
+
+    // ### decode
+
+    // Decode and return the decoded string.
+
+    template <typename Str = str>
+    [[nodiscard]] result<Str> decode(const cstrview string)
+    {
+        Str append_to;
+        const auto res = detail::decode(string, append_to);
+        if (res)
+        {
+            return append_to;
+        }
+        return res.error_code();
+    }
+
+    // Decode and append the decoded string.
+
+    template <typename Buf>
+    [[nodiscard]] result<void> decode(const cstrview string, strcore<Buf>& append_to,
+                                      assume::no_overlap_t)
+    {
+        snn_should(!string.overlaps(append_to));
+        return detail::decode(string, append_to);
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/hex/constant_time/decode.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/array.hh"
+#include "snn-core/hex/decode.hh"
+#include "snn-core/hex/encode.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            snn_require(hex::constant_time::decode("").value() == "");
+            snn_require(hex::constant_time::decode("666f6F626172").value() == "foobar");
+            snn_require(hex::constant_time::decode("c3a5c3a4c3b6").value() == "åäö");
+
+            snn_require(!hex::constant_time::decode("abc"));  // Invalid size.
+            snn_require(!hex::constant_time::decode("abc.")); // Invalid character.
+
+            return true;
+        }
+
+        bool test_decode()
+        {
+            {
+                // Every pair of characters, same result as `hex::decode(...)`.
+                for (usize a = 0; a < 256; ++a)
+                {
+                    for (usize b = 0; b < 256; ++b)
+                    {
+                        const array<char, 2> pair{static_cast<char>(a), static_cast<char>(b)};
+                        const cstrview s{pair};
+
+                        const auto expected = hex::decode(s);
+                        const auto decoded  = hex::constant_time::decode(s);
+                        snn_require(decoded.has_value() == expected.has_value());
+                        if (decoded)
+                        {
+                            snn_require(decoded.value() == expected.value());
+                        }
+                        else
+                        {
+                            snn_require(decoded.error_code() == hex::error::invalid_character);
+                        }
+                    }
+                }
+            }
+            {
+                strbuf s{"abc"};
+                snn_require(hex::constant_time::decode("00ff7F", s, assume::no_overlap));
+                snn_require(s == "abc\x00\xff\x7f");
+
+                // Invalid character (last), nothing is appended.
+                const auto res = hex::constant_time::decode("0011223x", s, assume::no_overlap);
+                snn_require(!res);
+                snn_require(res.error_code() == hex::error::invalid_character);
+                snn_require(s == "abc\x00\xff\x7f");
+
+                const auto res2 = hex::constant_time::decode("001", s, assume::no_overlap);
+                snn_require(res2.error_code() == hex::error::invalid_size);
+            }
+            {
+                const str data{"\x01\x23\x45\x67\x89\xab\xcd\xef secret key"};
+                const str lower = hex::encode(data);
+                const str upper = hex::encode(data, hex::table::upper);
+                snn_require(hex::constant_time::decode(lower).value() == data);
+                snn_require(hex::constant_time::decode(upper).value() == data);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_decode());
+    }
+}
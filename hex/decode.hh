@@ -9,6 +9,7 @@
 #include "snn-core/strcore.hh"
 #include "snn-core/chr/common.hh"
 #include "snn-core/hex/error.hh"
+#include "snn-core/hex/detail/simd.hh"
 
 namespace snn::hex
 {
@@ -33,6 +34,14 @@ namespace snn::hex
 
             auto cur        = string.cbegin();
             const auto last = string.cend();
+
+            if (!std::is_constant_evaluated())
+            {
+                const usize char_count = simd::decode(cur, string.size(), dest);
+                cur += char_count;
+                dest += char_count / 2;
+            }
+
             while (cur != last)
             {
                 const u8 val1 = chr::decode_hex(*(cur++));
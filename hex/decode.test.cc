@@ -5,6 +5,9 @@
 
 #include "snn-core/unittest.hh"
 #include "snn-core/range/integral.hh"
+#include "snn-core/hex/encode.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -105,6 +108,36 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_decode_simd()
+        {
+            random::wyrand rng{4321};
+            for (usize size = 0; size < 150; ++size)
+            {
+                const str s     = random::string(size, rng);
+                const str lower = hex::encode(s);
+                const str upper = hex::encode(s, hex::table::upper);
+                snn_require(hex::decode(lower).value() == s);
+                snn_require(hex::decode(upper).value() == s);
+
+                // Invalid character at every position.
+                for (usize pos = 0; pos < lower.size(); ++pos)
+                {
+                    for (const char invalid : {'g', 'G', '/', ':', '@', '`', '\xff', '\0'})
+                    {
+                        str invalid_hex = lower;
+                        invalid_hex.at(pos, assume::within_bounds) = invalid;
+
+                        strbuf dest{"abc"};
+                        const auto r = hex::decode(invalid_hex, dest, assume::no_overlap);
+                        snn_require(!r);
+                        snn_require(r.error_code() == hex::error::invalid_character);
+                        snn_require(dest == "abc");
+                    }
+                }
+            }
+            return true;
+        }
     }
 }
 
@@ -114,5 +147,6 @@ namespace snn
     {
         snn_static_require(app::example());
         snn_static_require(app::test_decode());
+        snn_require(app::test_decode_simd());
     }
 }
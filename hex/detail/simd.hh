@@ -0,0 +1,169 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # SIMD encode/decode kernels (SSE2/SSSE3/AVX2)
+
+// Only full chunks are processed, the caller handles the rest with the scalar code. The functions
+// return 0 if no supported instruction set is enabled at compile time.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/hex/table/common.hh"
+#if SNN_SSE2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::hex::detail::simd
+{
+    // ## Functions
+
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+    // ### encode
+
+    // Encode chunks of 16 bytes, returns the number of bytes encoded. Any table can be used with
+    // SSSE3 (table lookup with `pshufb`), with only SSE2 the table must be `table::lower` or
+    // `table::upper`.
+
+    inline usize encode(const char* const src, const usize size, char* const dst,
+                        const array<char, 16>& chars) noexcept
+    {
+        usize pos = 0;
+
+#if SNN_AVX2_ENABLED
+        {
+            const __m256i lookup = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars.begin())));
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+            while ((size - pos) >= 32)
+            {
+                const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + pos));
+                const __m256i hi = _mm256_shuffle_epi8(
+                    lookup, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask));
+                const __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(in, nibble_mask));
+
+                // Interleave (per 128-bit lane), then put the lanes in order.
+                const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+                const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (pos * 2)),
+                                    _mm256_permute2x128_si256(a, b, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (pos * 2) + 32),
+                                    _mm256_permute2x128_si256(a, b, 0x31));
+                pos += 32;
+            }
+        }
+#endif
+
+#if SNN_SSSE3_ENABLED
+        {
+            const __m128i lookup = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars.begin()));
+            const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+            while ((size - pos) >= 16)
+            {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+                const __m128i hi =
+                    _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask));
+                const __m128i lo = _mm_shuffle_epi8(lookup, _mm_and_si128(in, nibble_mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (pos * 2)),
+                                 _mm_unpacklo_epi8(hi, lo));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (pos * 2) + 16),
+                                 _mm_unpackhi_epi8(hi, lo));
+                pos += 16;
+            }
+        }
+#elif SNN_SSE2_ENABLED
+        if (&chars == &table::lower || &chars == &table::upper)
+        {
+            // Nibble to character: '0' + n, plus an offset for 10-15 ('a'/'A' - '0' - 10).
+            const char alpha_offset   = (&chars == &table::lower) ? ('a' - '0' - 10)
+                                                                  : ('A' - '0' - 10);
+            const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+            const auto to_chars       = [&](const __m128i n) {
+                const __m128i is_alpha = _mm_cmpgt_epi8(n, _mm_set1_epi8(9));
+                const __m128i offset   = _mm_and_si128(is_alpha, _mm_set1_epi8(alpha_offset));
+                return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), offset);
+            };
+            while ((size - pos) >= 16)
+            {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+                const __m128i hi = to_chars(_mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask));
+                const __m128i lo = to_chars(_mm_and_si128(in, nibble_mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (pos * 2)),
+                                 _mm_unpacklo_epi8(hi, lo));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (pos * 2) + 16),
+                                 _mm_unpackhi_epi8(hi, lo));
+                pos += 16;
+            }
+        }
+#endif
+
+        ignore_if_unused(src, size, dst, chars);
+        return pos;
+    }
+
+    // ### decode
+
+    // Decode chunks of 32 characters (upper or lower case), returns the number of characters
+    // decoded. Stops before any chunk with an invalid character (the scalar code reports the
+    // error).
+
+#if SNN_SSE2_ENABLED
+    namespace sse
+    {
+        // Characters to nibbles, `valid` is cleared for any invalid character.
+        inline __m128i decode_nibbles(const __m128i in, __m128i& valid) noexcept
+        {
+            // Signed comparisons, characters >= 0x80 are negative and never in range.
+            const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)),
+                                                   _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), in));
+            const __m128i lower    = _mm_or_si128(in, _mm_set1_epi8(0x20));
+            const __m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                                   _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+            valid = _mm_and_si128(valid, _mm_or_si128(is_digit, is_alpha));
+
+            const __m128i digit = _mm_and_si128(is_digit, _mm_sub_epi8(in, _mm_set1_epi8('0')));
+            const __m128i alpha =
+                _mm_and_si128(is_alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+            return _mm_or_si128(digit, alpha);
+        }
+
+        // 16 nibbles (high, low, high, low, ...) to 8 bytes, in the low byte of each 16-bit lane.
+        inline __m128i pack_nibbles(const __m128i n) noexcept
+        {
+            const __m128i merged = _mm_or_si128(_mm_slli_epi16(n, 4), _mm_srli_epi16(n, 8));
+            return _mm_and_si128(merged, _mm_set1_epi16(0x00ff));
+        }
+    }
+#endif
+
+    inline usize decode(const char* const src, const usize size, char* const dst) noexcept
+    {
+        usize pos = 0;
+
+#if SNN_SSE2_ENABLED
+        while ((size - pos) >= 32)
+        {
+            __m128i valid    = _mm_set1_epi8(-1);
+            const __m128i n1 = sse::decode_nibbles(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)), valid);
+            const __m128i n2 = sse::decode_nibbles(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos + 16)), valid);
+            if (_mm_movemask_epi8(valid) != 0xffff)
+            {
+                break;
+            }
+
+            const __m128i out = _mm_packus_epi16(sse::pack_nibbles(n1), sse::pack_nibbles(n2));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (pos / 2)), out);
+            pos += 32;
+        }
+#endif
+
+        ignore_if_unused(src, size, dst);
+        return pos;
+    }
+
+    SNN_DIAGNOSTIC_POP
+}
@@ -7,6 +7,7 @@
 
 #include "snn-core/array.hh"
 #include "snn-core/strcore.hh"
+#include "snn-core/hex/detail/simd.hh"
 #include "snn-core/hex/table/common.hh"
 
 namespace snn::hex
@@ -32,7 +33,16 @@ namespace snn::hex
             // Every byte turns into 2 bytes. Can't overflow (57-bit-virtual-address-space).
             strview buffer = append_to.append_for_overwrite(s.size() * 2);
             char* dest     = buffer.begin();
-            for (const char c : s)
+
+            cstrview rest = s;
+            if (!std::is_constant_evaluated())
+            {
+                const usize byte_count = simd::encode(s.begin(), s.size(), dest, table);
+                rest.drop_front_n(byte_count);
+                dest += byte_count * 2;
+            }
+
+            for (const char c : rest)
             {
                 const auto b = to_byte(c);
                 *(dest++)    = table.at(b >> 4u, bounds::mask); // High bits.
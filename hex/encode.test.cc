@@ -5,6 +5,8 @@
 
 #include "snn-core/unittest.hh"
 #include "snn-core/range/integral.hh"
+#include "snn-core/random/string.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -109,6 +111,29 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_encode_simd()
+        {
+            // Compare with byte-by-byte encoding (not vectorized), for all chunk/tail sizes.
+            random::wyrand rng{1234};
+            // Copies, not vectorized with only SSE2.
+            const array<char, 16> lower = hex::table::lower;
+            const array<char, 16> upper = hex::table::upper;
+            for (usize size = 0; size < 300; ++size)
+            {
+                const str s = random::string(size, rng);
+                str expected;
+                for (const char c : s)
+                {
+                    const auto pair = hex::encode(c, upper);
+                    expected << pair.get<0>() << pair.get<1>();
+                }
+                snn_require(hex::encode(s, upper) == expected);
+                snn_require(hex::encode(s, hex::table::upper) == expected);
+                snn_require(hex::encode(s, hex::table::lower) == hex::encode(s, lower));
+            }
+            return true;
+        }
     }
 }
 
@@ -118,5 +143,6 @@ namespace snn
     {
         snn_static_require(app::example());
         snn_static_require(app::test_encode());
+        snn_require(app::test_encode_simd());
     }
 }
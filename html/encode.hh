@@ -6,7 +6,7 @@
 #pragma once
 
 #include "snn-core/strcore.hh"
-#include "snn-core/chr/fn/lookup.hh"
+#include "snn-core/chr/detail/simd.hh"
 #include "snn-core/utf8/is_valid.hh"
 
 namespace snn::html
@@ -48,29 +48,31 @@ namespace snn::html
             1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
         };
 
+        inline constexpr chr::detail::simd::lookup encode_unreserved{encode_unreserved_lookup};
+        inline constexpr chr::detail::simd::lookup encode_unreserved_attribute{
+            encode_unreserved_attribute_lookup};
+        inline constexpr chr::detail::simd::lookup encode_unreserved_text{
+            encode_unreserved_text_lookup};
+
         template <typename Buf>
         constexpr void encode(const cstrview s, strcore<Buf>& append_to,
-                              const array<bool, 256>& unreserved_lookup)
+                              const chr::detail::simd::lookup& unreserved)
         {
             append_to.reserve_append(s.size()); // Reserve minimal size.
 
-            const auto is_unreserved = snn::chr::fn::lookup{unreserved_lookup};
-
             auto rng = s.range();
             while (rng)
             {
-                const auto unreserved_rng = rng.pop_front_while(is_unreserved);
-                if (unreserved_rng)
+                const cstrview unreserved_view = unreserved.pop_front_while(rng);
+                if (unreserved_view)
                 {
-                    append_to.append(cstrview{unreserved_rng});
+                    append_to.append(unreserved_view);
                 }
 
                 if (rng)
                 {
                     const char c = rng.pop_front(assume::not_empty);
 
-                    snn_should(!is_unreserved(c));
-
                     switch (c)
                     {
                         case '"':
@@ -127,14 +129,14 @@ namespace snn::html
                           assume::no_overlap_t)
     {
         snn_should(std::is_constant_evaluated() || !s.get().overlaps(append_to));
-        detail::encode(s.get(), append_to, detail::encode_unreserved_lookup);
+        detail::encode(s.get(), append_to, detail::encode_unreserved);
     }
 
     template <any_strcore Str = str>
     [[nodiscard]] constexpr Str encode(const transient<cstrview> s)
     {
         Str append_to;
-        detail::encode(s.get(), append_to, detail::encode_unreserved_lookup);
+        detail::encode(s.get(), append_to, detail::encode_unreserved);
         return append_to;
     }
 
@@ -153,7 +155,7 @@ namespace snn::html
     {
         snn_should(std::is_constant_evaluated() || !s.get().overlaps(append_to));
         snn_should_if_not_fuzzing(utf8::is_valid(s));
-        detail::encode(s.get(), append_to, detail::encode_unreserved_attribute_lookup);
+        detail::encode(s.get(), append_to, detail::encode_unreserved_attribute);
     }
 
     template <any_strcore Str = str>
@@ -162,7 +164,7 @@ namespace snn::html
     {
         snn_should_if_not_fuzzing(utf8::is_valid(s));
         Str append_to;
-        detail::encode(s.get(), append_to, detail::encode_unreserved_attribute_lookup);
+        detail::encode(s.get(), append_to, detail::encode_unreserved_attribute);
         return append_to;
     }
 
@@ -176,7 +178,7 @@ namespace snn::html
     {
         snn_should(std::is_constant_evaluated() || !s.get().overlaps(append_to));
         snn_should_if_not_fuzzing(utf8::is_valid(s));
-        detail::encode(s.get(), append_to, detail::encode_unreserved_text_lookup);
+        detail::encode(s.get(), append_to, detail::encode_unreserved_text);
     }
 
     template <any_strcore Str = str>
@@ -184,7 +186,7 @@ namespace snn::html
     {
         snn_should_if_not_fuzzing(utf8::is_valid(s));
         Str append_to;
-        detail::encode(s.get(), append_to, detail::encode_unreserved_text_lookup);
+        detail::encode(s.get(), append_to, detail::encode_unreserved_text);
         return append_to;
     }
 }
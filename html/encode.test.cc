@@ -211,6 +211,39 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_encode_simd()
+        {
+            // Every character at every position.
+            for (usize size = 1; size < 80; ++size)
+            {
+                for (usize pos = 0; pos < size; ++pos)
+                {
+                    const str prefix{init::fill, pos, 'a'};
+                    const str suffix{init::fill, size - pos - 1, 'a'};
+
+                    for (const auto b : range::integral<byte>{})
+                    {
+                        const char c = to_char(b);
+                        const str s  = concat(prefix, c, suffix);
+                        snn_require(html::encode(s) ==
+                                    concat(prefix, html::encode(cstrview{as_ref(c)}), suffix));
+                    }
+
+                    const str nbsp = concat(prefix, "\u00A0", suffix);
+                    snn_require(html::encode_attribute_value(nbsp, assume::is_utf8) ==
+                                concat(prefix, "&nbsp;", suffix));
+                    snn_require(html::encode_text_value(nbsp, assume::is_utf8) ==
+                                concat(prefix, "&nbsp;", suffix));
+
+                    const str quote = concat(prefix, '"', suffix);
+                    snn_require(html::encode_attribute_value(quote, assume::is_utf8) ==
+                                concat(prefix, "&quot;", suffix));
+                    snn_require(html::encode_text_value(quote, assume::is_utf8) == quote);
+                }
+            }
+            return true;
+        }
     }
 }
 
@@ -220,5 +253,6 @@ namespace snn
     {
         snn_static_require(app::example());
         snn_static_require(app::test_encode());
+        snn_require(app::test_encode_simd());
     }
 }
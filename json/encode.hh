@@ -8,6 +8,7 @@
 #include "snn-core/exception.hh"
 #include "snn-core/strcore.hh"
 #include "snn-core/chr/common.hh"
+#include "snn-core/chr/detail/simd.hh"
 #include "snn-core/chr/fn/lookup.hh"
 #include "snn-core/json/error.hh"
 #include "snn-core/range/contiguous.hh"
@@ -83,6 +84,11 @@ namespace snn::json
             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         };
 
+        inline constexpr chr::detail::simd::lookup encode_passthrough{
+            encode_passthrough_lookup};
+        inline constexpr chr::detail::simd::lookup encode_passthrough_opt{
+            encode_passthrough_opt_lookup};
+
         template <typename Buf>
         constexpr void encode(const cstrview s, const option options, strcore<Buf>& append_to)
         {
@@ -90,19 +96,19 @@ namespace snn::json
 
             append_to.append('"');
 
-            auto is_passthrough = snn::chr::fn::lookup{detail::encode_passthrough_lookup};
+            const chr::detail::simd::lookup* passthrough = &detail::encode_passthrough;
             if (options != option::none)
             {
-                is_passthrough = snn::chr::fn::lookup{detail::encode_passthrough_opt_lookup};
+                passthrough = &detail::encode_passthrough_opt;
             }
 
             auto rng = s.range();
             while (rng)
             {
-                const auto passthrough_rng = rng.pop_front_while(is_passthrough);
-                if (passthrough_rng)
+                const cstrview passthrough_view = passthrough->pop_front_while(rng);
+                if (passthrough_view)
                 {
-                    append_to.append(cstrview{passthrough_rng});
+                    append_to.append(passthrough_view);
                 }
 
                 if (rng)
@@ -97,6 +97,38 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_encode_simd()
+        {
+            // A character that must be escaped at every position, with and without options.
+            for (usize size = 1; size < 80; ++size)
+            {
+                for (usize pos = 0; pos < size; ++pos)
+                {
+                    const str prefix{init::fill, pos, 'a'};
+                    const str suffix{init::fill, size - pos - 1, 'a'};
+
+                    for (usize b = 0; b < 128; ++b)
+                    {
+                        const char c = static_cast<char>(b);
+                        for (const auto opt : {json::option::none, json::option::escape_lt})
+                        {
+                            const str single = json::encode(cstrview{as_ref(c)}, opt);
+                            str expected{"\""};
+                            expected << prefix << single.view(1, single.size() - 2) << suffix
+                                     << '"';
+                            snn_require(json::encode(concat(prefix, c, suffix), opt) == expected);
+                        }
+                    }
+
+                    const str utf8_expected = concat("\"", prefix, R"(\u2028)", suffix, "\"");
+                    snn_require(json::encode(concat(prefix, "\u2028", suffix)) == utf8_expected);
+                    snn_require(json::encode(concat(prefix, "å", suffix)) ==
+                                concat("\"", prefix, "å", suffix, "\""));
+                }
+            }
+            return true;
+        }
     }
 }
 
@@ -106,6 +138,7 @@ namespace snn
     {
         snn_static_require(app::example());
         snn_static_require(app::test_encode());
+        snn_require(app::test_encode_simd());
 
         static_assert(to_underlying(json::option::escape_ampersand) == 1);
         static_assert(to_underlying(json::option::escape_amp) == 1);
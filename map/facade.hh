@@ -4,7 +4,8 @@
 // # Facade (`std::` container wrapper)
 
 // Wrapper around `std::map` or `std::unordered_map`, see [map/sorted.hh](sorted.hh) and
-// [map/unsorted.hh](unsorted.hh).
+// [map/unsorted.hh](unsorted.hh). Also used with the small-buffer table of
+// [map/small.hh](small.hh).
 
 #pragma once
 
@@ -305,9 +306,10 @@ namespace snn::map
         {
             const usize size_before = map_.size();
 
-            auto cur        = map_.begin();
-            const auto last = map_.end();
-            while (cur != last)
+            // Don't cache `end()`, `erase(...)` invalidates it for maps with contiguous storage
+            // (`map::small`).
+            auto cur = map_.begin();
+            while (cur != map_.end())
             {
                 if (p(*cur))
                 {
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Small map
+
+// Stores up to `N` key-value pairs inline (like `vec<T, SmallCapacity>`) and finds them with a
+// linear scan, which is faster than hashing for a handful of keys. Beyond `N` pairs an open
+// addressing hash table is used to index the pairs (which are still stored contiguously).
+
+// Removing a pair moves the last pair into its place, iteration order is unspecified. The value
+// type is `std::pair<Key, Value>` (not `const Key`), keys must not be modified through an
+// iterator.
+
+#pragma once
+
+#include "snn-core/detail/small/table.hh"
+#include "snn-core/fn/common.hh"
+#include "snn-core/map/facade.hh"
+#include <functional> // hash
+
+namespace snn::map
+{
+    // ## Aliases
+
+    // ### small
+
+    template <typename Key, typename Value, usize N, typename Hash = std::hash<Key>,
+              typename KeyEqual = fn::equal_to>
+    using small = facade<snn::detail::small::table<Key, Value, N, Hash, KeyEqual>>;
+}
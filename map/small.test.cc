@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/map/small.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/map/unsorted.hh"
+#include <memory> // make_unique, unique_ptr
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // Up to 4 pairs are stored inline.
+            map::small<str, int, 4> m = {{"One", 1}, {"Two", 22}, {"Three", 333}};
+
+            snn_require(m);
+            snn_require(m.count() == 3);
+
+            snn_require(m.contains("One"));
+            snn_require(!m.contains("Four"));
+
+            snn_require(m.get("Two").value() == 22);
+            snn_require(m.get("Four").value_or_default() == 0);
+
+            // Insert (if unique).
+            {
+                auto ins_res = m.insert("Two", 123);
+                snn_require(ins_res.key() == "Two");
+                snn_require(ins_res.value() == 22); // Not changed.
+                snn_require(!ins_res.was_inserted());
+            }
+
+            // Insert or assign.
+            {
+                auto ins_res = m.insert_or_assign("Two", 123);
+                snn_require(ins_res.value() == 123); // Assigned
+                snn_require(ins_res.was_assigned());
+            }
+
+            // Beyond 4 pairs a hash table is used to find the keys.
+            snn_require(m.insert("Four", 4444));
+            snn_require(m.insert("Five", 55555));
+            snn_require(m.count() == 5);
+            snn_require(m.get("Five").value() == 55555);
+            snn_require(m.get("One").value() == 1);
+
+            m.get("One").value() = 111;
+            snn_require(m.get("One").value() == 111);
+
+            // Remove.
+            snn_require(m.remove("Three"));
+            snn_require(!m.remove("Three"));
+            snn_require(m.remove_if([](const auto& p) { return p.second > 1000; }) == 2);
+            snn_require(m.count() == 2);
+            snn_require(m.get("Two").value() == 123);
+
+            static_assert(std::is_same_v<decltype(m.get("Two")), optional<int&>>);
+
+            return true;
+        }
+
+        bool test_small()
+        {
+            {
+                // Compare with `map::unsorted` (random inserts, assigns and removes).
+                map::small<u32, usize, 8> small;
+                map::unsorted<u32, usize> reference;
+
+                u32 state = 42;
+                for (usize i = 0; i < 20'000; ++i)
+                {
+                    state         = (state * 1'103'515'245) + 12'345;
+                    const u32 key = (state >> 16) % 200;
+
+                    switch ((state >> 8) % 4)
+                    {
+                    case 0:
+                        snn_require(small.remove(key) == reference.remove(key));
+                        break;
+                    case 1:
+                        small.insert_or_assign(key, i);
+                        reference.insert_or_assign(key, i);
+                        break;
+                    default:
+                        snn_require(small.insert(key, i).was_inserted() ==
+                                    reference.insert(key, i).was_inserted());
+                        break;
+                    }
+                    snn_require(small.count() == reference.count());
+
+                    if (i % 1'000 == 0)
+                    {
+                        for (u32 k = 0; k < 200; ++k)
+                        {
+                            snn_require(small.get<usize>(k) == reference.get<usize>(k));
+                        }
+
+                        // Remove about half (odd values).
+                        const auto is_odd = [](const auto& p) { return p.second % 2 == 1; };
+                        snn_require(small.remove_if(is_odd) == reference.remove_if(is_odd));
+                        snn_require(small.count() == reference.count());
+                    }
+                }
+
+                for (const auto& [key, value] : small)
+                {
+                    snn_require(reference.get(key).value() == value);
+                }
+            }
+            {
+                // Move only value.
+                map::small<int, std::unique_ptr<int>, 2> m;
+                snn_require(m.insert(1, std::make_unique<int>(10)));
+                snn_require(m.insert(2, std::make_unique<int>(20)));
+                snn_require(m.insert(3, std::make_unique<int>(30)));
+                snn_require(m.remove(1));
+                snn_require(*m.get(3).value() == 30);
+
+                map::small<int, std::unique_ptr<int>, 2> other = std::move(m);
+                snn_require(other.count() == 2);
+                snn_require(*other.get(2).value() == 20);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_small());
+    }
+}
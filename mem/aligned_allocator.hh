@@ -0,0 +1,140 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Allocator without state with a minimum alignment
+
+// Like `allocator<T>` but all allocations are aligned to (at least) `Alignment` bytes, e.g. 64 for
+// cache line aligned buffers (no false sharing) or 32/64 for aligned AVX2/AVX-512 loads and stores:
+// `vec<float, 0, mem::aligned_allocator<float, 64>>`
+
+// Reallocation always copies (`aligned_alloc` has no `realloc` counterpart), except for very large
+// allocations which are `mmap`-ed (page aligned) and grown with `mremap`.
+
+#pragma once
+
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/mem/destruct_n.hh"
+#include "snn-core/mem/move_construct.hh"
+#include "snn-core/mem/relocate.hh"
+#include "snn-core/mem/detail/allocation.hh"
+#include <memory> // allocator
+
+namespace snn::mem
+{
+    // ## Classes
+
+    // ### aligned_allocator
+
+    template <typename T, usize Alignment = 64>
+        requires(math::is_power_of_two(Alignment) &&
+                 Alignment <= detail::allocation::max_alignment)
+    class aligned_allocator final
+    {
+      public:
+        static_assert(!std::is_array_v<T>, "Array type is currently not supported.");
+
+        // #### Constants
+
+        static constexpr usize alignment = math::max(Alignment, alignof(T));
+        static constexpr usize max_count = constant::limit<usize>::max / sizeof(T);
+
+        // #### Allocation/Deallocation
+
+        [[nodiscard]] constexpr optional_allocation<T*> allocate(
+            const not_zero<usize> count) noexcept
+        {
+            if (count.get() > max_count) [[unlikely]]
+            {
+                return optional_allocation<T*>{nullptr};
+            }
+
+            if (std::is_constant_evaluated())
+            {
+                return allocator<T>{}.allocate(count);
+            }
+
+            void* const ptr = detail::allocation::allocate(count.get() * sizeof(T), alignment);
+            return optional_allocation{static_cast<T*>(ptr)};
+        }
+
+        // Does nothing if `ptr` is null. The count must be the allocated count.
+
+        constexpr void deallocate(T* const ptr, const usize initial_count) noexcept
+        {
+            snn_should(ptr != nullptr || initial_count == 0);
+
+            if (std::is_constant_evaluated())
+            {
+                allocator<T>{}.deallocate(ptr, initial_count);
+                return;
+            }
+
+            detail::allocation::deallocate(ptr, initial_count * sizeof(T));
+        }
+
+        // If this fails the old memory is not deallocated.
+
+        [[nodiscard]] constexpr optional_allocation<T*> reallocate(T* const old_ptr,
+                                                                   const usize initial_count,
+                                                                   const not_zero<usize> new_count,
+                                                                   const usize use_count) noexcept
+        {
+            snn_should(old_ptr != nullptr || (initial_count == 0 && use_count == 0));
+            snn_should(use_count <= initial_count);
+
+            if (std::is_constant_evaluated())
+            {
+                return allocator<T>{}.reallocate(old_ptr, initial_count, new_count, use_count);
+            }
+
+            if (new_count.get() > max_count) [[unlikely]]
+            {
+                return optional_allocation<T*>{nullptr};
+            }
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            // Optimal path (bitwise copy or `mremap`).
+
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                if (std::is_trivially_copyable_v<T> || old_ptr == nullptr ||
+                    new_count.get() >= use_count) [[likely]]
+                {
+                    void* const new_ptr = detail::allocation::reallocate(
+                        old_ptr, initial_count * sizeof(T), new_count.get() * sizeof(T),
+                        math::min(use_count, new_count.get()) * sizeof(T), alignment);
+                    return optional_allocation{static_cast<T*>(new_ptr)};
+                }
+            }
+
+            // General path.
+
+            T* const new_ptr = allocate(new_count).value_or_nullptr();
+            if (new_ptr != nullptr && old_ptr != nullptr)
+            {
+                const usize keep_count = math::min(new_count.get(), use_count);
+
+                if constexpr (is_trivially_relocatable_v<T>)
+                {
+                    mem::relocate(not_null{old_ptr}, not_null{old_ptr + keep_count},
+                                  not_null{new_ptr});
+                    mem::destruct_n(old_ptr + keep_count, use_count - keep_count);
+                }
+                else
+                {
+                    mem::move_construct(not_null{old_ptr}, not_null{old_ptr + keep_count},
+                                        not_null{new_ptr}, assume::no_overlap);
+                    mem::destruct_n(old_ptr, use_count);
+                }
+
+                deallocate(old_ptr, initial_count);
+            }
+            return optional_allocation{new_ptr};
+
+            SNN_DIAGNOSTIC_POP
+        }
+    };
+}
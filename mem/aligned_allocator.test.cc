@@ -0,0 +1,105 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/mem/aligned_allocator.hh"
+
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/mem/construct.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // Cache line aligned, e.g. for aligned SIMD loads.
+            vec<float, 0, mem::aligned_allocator<float, 64>> v;
+            for (usize i = 0; i < 1000; ++i)
+            {
+                v.append(1.0f);
+                snn_require(reinterpret_cast<uptr>(v.data()) % 64 == 0);
+            }
+            snn_require(v.count() == 1000);
+
+            return true;
+        }
+
+        constexpr bool test_constexpr()
+        {
+            vec<int, 0, mem::aligned_allocator<int, 32>> v{init::reserve, 3};
+            v.append(1);
+            v.append(2);
+            v.append(3);
+            v.append(4);
+            snn_require(v.count() == 4);
+            snn_require(v.at(3, assume::within_bounds) == 4);
+            return true;
+        }
+
+        bool test_aligned_allocator()
+        {
+            static_assert(mem::aligned_allocator<char, 64>::alignment == 64);
+            static_assert(mem::aligned_allocator<u64, 4>::alignment == 8);
+            static_assert(sizeof(vec<int, 0, mem::aligned_allocator<int>>) == sizeof(vec<int>));
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            {
+                mem::aligned_allocator<str, 128> alloc;
+
+                str* ptr = alloc.allocate(not_zero<usize>{3}).value();
+                snn_require(reinterpret_cast<uptr>(ptr) % 128 == 0);
+
+                mem::construct(not_null{&ptr[0]}, "One");
+                mem::construct(not_null{&ptr[1]}, "A longer string that goes on the heap.");
+                mem::construct(not_null{&ptr[2]}, "Three");
+
+                // Grow.
+                ptr = alloc.reallocate(ptr, 3, not_zero<usize>{50}, 3).value();
+                snn_require(reinterpret_cast<uptr>(ptr) % 128 == 0);
+                snn_require(ptr[0] == "One");
+                snn_require(ptr[1] == "A longer string that goes on the heap.");
+                snn_require(ptr[2] == "Three");
+
+                // Shrink (one destructed).
+                ptr = alloc.reallocate(ptr, 50, not_zero<usize>{2}, 3).value();
+                snn_require(reinterpret_cast<uptr>(ptr) % 128 == 0);
+                snn_require(ptr[0] == "One");
+                snn_require(ptr[1] == "A longer string that goes on the heap.");
+
+                mem::destruct_n(ptr, 2);
+                alloc.deallocate(ptr, 2);
+                alloc.deallocate(nullptr, 0); // Does nothing.
+
+                snn_require(!alloc.allocate(not_zero{constant::limit<usize>::max}));
+            }
+            {
+                mem::aligned_allocator<char, 4096> alloc;
+                char* ptr = alloc.allocate(not_zero<usize>{1}).value();
+                snn_require(reinterpret_cast<uptr>(ptr) % 4096 == 0);
+                ptr[0] = 'a';
+                ptr    = alloc.reallocate(ptr, 1, not_zero<usize>{5000}, 1).value();
+                snn_require(reinterpret_cast<uptr>(ptr) % 4096 == 0);
+                snn_require(ptr[0] == 'a');
+                alloc.deallocate(ptr, 5000);
+            }
+
+            SNN_DIAGNOSTIC_POP
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_static_require(app::test_constexpr());
+        snn_require(app::test_aligned_allocator());
+    }
+}
@@ -11,8 +11,8 @@
 #include "snn-core/mem/destruct_n.hh"
 #include "snn-core/mem/move_construct.hh"
 #include "snn-core/mem/relocate.hh"
-#include <cstdlib> // free, malloc, realloc
-#include <memory>  // allocator
+#include "snn-core/mem/detail/allocation.hh"
+#include <memory> // allocator
 
 namespace snn::mem
 {
@@ -74,18 +74,17 @@ namespace snn::mem
 
     // ### allocator
 
+    // Trivially relocatable types are allocated with `malloc`/`realloc`, over-aligned types (e.g.
+    // `alignas(64)`) with `aligned_alloc` and very large allocations (Linux) with `mmap` (huge
+    // pages) and `mremap`, see [detail/allocation.hh](detail/allocation.hh). Use
+    // `aligned_allocator` for greater alignment than the type requires.
+
     template <typename T>
     class allocator final
     {
       public:
         static_assert(!std::is_array_v<T>, "Array type is currently not supported.");
-
-        // The pointer returned by `malloc` is suitably aligned for any scalar type.
-#if SNN_INT128_ENABLED
-        static_assert(alignof(T) <= alignof(u128), "Alignment must be malloc() compatible.");
-#else
-        static_assert(alignof(T) <= alignof(u64), "Alignment must be malloc() compatible.");
-#endif
+        static_assert(alignof(T) <= detail::allocation::max_alignment);
 
         // #### Constants
 
@@ -107,7 +106,8 @@ namespace snn::mem
             {
                 if (!std::is_constant_evaluated())
                 {
-                    void* const ptr = std::malloc(count.get() * sizeof(T));
+                    void* const ptr =
+                        detail::allocation::allocate(count.get() * sizeof(T), alignof(T));
                     return optional_allocation{static_cast<T*>(ptr)};
                 }
             }
@@ -128,7 +128,7 @@ namespace snn::mem
             return optional_allocation<T*>{nullptr};
         }
 
-        // Does nothing if `ptr` is null.
+        // Does nothing if `ptr` is null. The count must be the allocated count.
 
         constexpr void deallocate(T* const ptr, const usize initial_count) noexcept
         {
@@ -140,7 +140,7 @@ namespace snn::mem
             {
                 if (!std::is_constant_evaluated())
                 {
-                    std::free(ptr);
+                    detail::allocation::deallocate(ptr, initial_count * sizeof(T));
                     return;
                 }
             }
@@ -181,11 +181,14 @@ namespace snn::mem
                     if (std::is_trivially_copyable_v<T> || old_ptr == nullptr ||
                         new_count.get() >= use_count) [[likely]]
                     {
-                        new_ptr = std::realloc(old_ptr, new_count.get() * sizeof(T));
+                        new_ptr = detail::allocation::reallocate(
+                            old_ptr, initial_count * sizeof(T), new_count.get() * sizeof(T),
+                            math::min(use_count, new_count.get()) * sizeof(T), alignof(T));
                     }
                     else
                     {
-                        new_ptr = std::malloc(new_count.get() * sizeof(T));
+                        new_ptr =
+                            detail::allocation::allocate(new_count.get() * sizeof(T), alignof(T));
                         if (new_ptr != nullptr)
                         {
                             snn_should(new_count.get() < use_count);
@@ -203,7 +206,7 @@ namespace snn::mem
 
                             SNN_DIAGNOSTIC_POP
 
-                            std::free(old_ptr);
+                            detail::allocation::deallocate(old_ptr, initial_count * sizeof(T));
                         }
                     }
 
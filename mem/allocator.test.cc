@@ -5,6 +5,7 @@
 
 #include "snn-core/strcore.hh"
 #include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
 #include "snn-core/mem/construct.hh"
 #include "snn-core/mem/destruct_n.hh"
 
@@ -166,6 +167,87 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_over_aligned()
+        {
+            struct alignas(64) cache_line final
+            {
+                u64 value;
+            };
+
+            mem::allocator<cache_line> alloc;
+
+            cache_line* ptr = alloc.allocate(not_zero<usize>{3}).value();
+            snn_require(reinterpret_cast<uptr>(ptr) % 64 == 0);
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            ptr[0].value = 123;
+            ptr[2].value = 456;
+
+            ptr = alloc.reallocate(ptr, 3, not_zero<usize>{100}, 3).value();
+            snn_require(reinterpret_cast<uptr>(ptr) % 64 == 0);
+            snn_require(ptr[0].value == 123);
+            snn_require(ptr[2].value == 456);
+
+            SNN_DIAGNOSTIC_POP
+
+            alloc.deallocate(ptr, 100);
+
+            return true;
+        }
+
+        bool test_large()
+        {
+            // Large allocations are `mmap`-ed and grown with `mremap` (Linux).
+            constexpr usize count = mem::detail::allocation::large_threshold / sizeof(u64);
+
+            mem::allocator<u64> alloc;
+
+            u64* ptr = alloc.allocate(not_zero{count}).value();
+            if constexpr (mem::detail::allocation::large_enabled)
+            {
+                snn_require(reinterpret_cast<uptr>(ptr) % mem::detail::allocation::huge_page_size ==
+                            0);
+            }
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            ptr[0]         = 123;
+            ptr[count - 1] = 456;
+
+            // Grow.
+            ptr = alloc.reallocate(ptr, count, not_zero{count * 3}, count).value();
+            snn_require(ptr[0] == 123);
+            snn_require(ptr[count - 1] == 456);
+            ptr[(count * 3) - 1] = 789;
+
+            // Shrink below the threshold (copied to a `malloc` allocation).
+            ptr = alloc.reallocate(ptr, count * 3, not_zero<usize>{10}, count * 3).value();
+            snn_require(ptr[0] == 123);
+
+            // Grow above the threshold again.
+            ptr = alloc.reallocate(ptr, 10, not_zero{count * 2}, 10).value();
+            snn_require(ptr[0] == 123);
+
+            SNN_DIAGNOSTIC_POP
+
+            alloc.deallocate(ptr, count * 2);
+
+            // A large vec.
+            vec<u32> v;
+            for (u32 i = 0; i < 20'000'000; ++i)
+            {
+                v.append(i);
+            }
+            snn_require(v.count() == 20'000'000);
+            snn_require(v.at(0, assume::within_bounds) == 0);
+            snn_require(v.at(19'999'999, assume::within_bounds) == 19'999'999);
+
+            return true;
+        }
     }
 }
 
@@ -174,5 +256,7 @@ namespace snn
     void unittest()
     {
         snn_static_require(app::test_allocator());
+        snn_require(app::test_over_aligned());
+        snn_require(app::test_large());
     }
 }
@@ -0,0 +1,316 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Monotonic memory arena
+
+// Memory is handed out from large blocks by bumping a pointer, individual allocations are never
+// released. All memory is released at once with `reset()` or when the arena is destroyed.
+// The most recent allocation can grow (or shrink) in place if it fits in the current block.
+
+// An arena is owned by the caller and is not thread-safe. It can be made the current arena of a
+// thread with `arena_scope`, which is what `arena_allocator` allocates from. An arena is also a
+// `mem::resource` and can be referenced by a `resource_allocator`.
+
+#pragma once
+
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/mem/raw/copy.hh"
+#include "snn-core/mem/raw/optimal_size.hh"
+#include "snn-core/num/bounded.hh"
+#include <cstddef> // max_align_t
+#include <cstdlib> // free, malloc
+
+namespace snn::mem
+{
+    // ## Classes
+
+    // ### arena
+
+    class arena final
+    {
+      public:
+        // #### Constants
+
+        static constexpr usize default_block_size = 64 * 1024;
+        static constexpr usize max_alignment      = alignof(std::max_align_t);
+        static constexpr usize max_block_size     = constant::limit<iptrdiff>::max / 2;
+
+        // #### Explicit constructors
+
+        explicit arena(const num::bounded<usize, 1, max_block_size> min_block_size =
+                           default_block_size) noexcept
+            : block_size_{mem::raw::optimal_size(min_block_size.not_zero())}
+        {
+        }
+
+        // #### Non-copyable/non-movable
+
+        // An arena can be referenced by an `arena_scope` or by memory handed out from it.
+
+        arena(const arena&)            = delete;
+        arena& operator=(const arena&) = delete;
+
+        arena(arena&&)            = delete;
+        arena& operator=(arena&&) = delete;
+
+        // #### Destructor
+
+        ~arena()
+        {
+            release_blocks_(nullptr);
+        }
+
+        // #### Allocation
+
+        // Alignment must be a power of two and not greater than `max_alignment`.
+
+        [[nodiscard]] optional_allocation<void*> allocate(
+            const not_zero<usize> size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(is_valid_alignment_(alignment));
+
+            byte* const p = align_up_(next_, alignment);
+            if (p != nullptr && size.get() <= static_cast<usize>(end_ - p)) [[likely]]
+            {
+                next_ = p + size.get();
+                return optional_allocation<void*>{p};
+            }
+
+            return allocate_in_new_block_(size);
+        }
+
+        // Grows or shrinks in place if `ptr` is the most recent allocation and `new_size` fits in
+        // the current block, otherwise the allocation is moved.
+        // If this fails the old memory is left as is.
+        // Memory is never released, so `ptr` stays valid (until `reset()`) even if moved.
+
+        [[nodiscard]] optional_allocation<void*> reallocate(
+            void* const ptr, const usize old_size, const not_zero<usize> new_size,
+            const usize use_size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(ptr != nullptr || (old_size == 0 && use_size == 0));
+            snn_should(use_size <= old_size);
+
+            if (ptr == nullptr)
+            {
+                return allocate(new_size, alignment);
+            }
+
+            byte* const p = static_cast<byte*>(ptr);
+
+            if (p + old_size == next_ && new_size.get() <= static_cast<usize>(end_ - p))
+            {
+                next_ = p + new_size.get();
+                return optional_allocation<void*>{p};
+            }
+
+            if (new_size.get() <= old_size)
+            {
+                return optional_allocation<void*>{p};
+            }
+
+            auto opt = allocate(new_size, alignment);
+            if (opt && use_size > 0)
+            {
+                mem::raw::copy(not_null<const byte*>{p},
+                               not_null{static_cast<byte*>(opt.value(assume::has_value))},
+                               byte_size{use_size}, assume::no_overlap);
+            }
+            return opt;
+        }
+
+        // #### Deallocation
+
+        // Only the most recent allocation is released (its memory is reused), all other memory is
+        // released with `reset()`. Makes an arena usable as a `mem::resource`.
+
+        void deallocate(void* const ptr, const usize size,
+                        const usize alignment = max_alignment) noexcept
+        {
+            ignore_if_unused(alignment);
+            const auto addr = reinterpret_cast<uptr>(ptr);
+            if (ptr != nullptr && (addr + size) == reinterpret_cast<uptr>(next_))
+            {
+                next_ = static_cast<byte*>(ptr);
+            }
+        }
+
+        // #### Status
+
+        [[nodiscard]] usize block_count() const noexcept
+        {
+            usize count = 0;
+            for (const block_header* b = current_; b != nullptr; b = b->previous)
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        [[nodiscard]] usize block_size() const noexcept
+        {
+            return block_size_.get();
+        }
+
+        // Bytes left in the current block (ignoring alignment).
+        [[nodiscard]] usize remaining_size() const noexcept
+        {
+            return static_cast<usize>(end_ - next_);
+        }
+
+        // #### Reset
+
+        // Releases all memory handed out by this arena. The most recently allocated block is kept
+        // (and reused), all other blocks are freed.
+
+        void reset() noexcept
+        {
+            if (current_ != nullptr)
+            {
+                release_blocks_(current_);
+                current_->previous = nullptr;
+                next_              = data_(current_);
+            }
+        }
+
+        // Frees all blocks.
+        void release() noexcept
+        {
+            release_blocks_(nullptr);
+            current_ = nullptr;
+            next_    = nullptr;
+            end_     = nullptr;
+        }
+
+        // #### Current
+
+        // The current arena of the calling thread (set with `arena_scope`), can be null.
+        [[nodiscard]] static arena* current() noexcept
+        {
+            return current_arena_();
+        }
+
+      private:
+        struct block_header final
+        {
+            block_header* previous;
+            usize size;
+        };
+
+        static_assert(sizeof(block_header) % max_alignment == 0);
+
+        block_header* current_{nullptr};
+        byte* next_{nullptr};
+        byte* end_{nullptr};
+        not_zero<usize> block_size_;
+
+        friend class arena_scope;
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        static arena*& current_arena_() noexcept
+        {
+            static thread_local arena* a = nullptr;
+            return a;
+        }
+
+        static byte* data_(block_header* const b) noexcept
+        {
+            return reinterpret_cast<byte*>(b) + sizeof(block_header);
+        }
+
+        static byte* align_up_(byte* const p, const usize alignment) noexcept
+        {
+            const auto addr    = reinterpret_cast<uptr>(p);
+            const auto aligned = (addr + (alignment - 1)) & ~(alignment - 1);
+            return p + (aligned - addr);
+        }
+
+        static constexpr bool is_valid_alignment_(const usize alignment) noexcept
+        {
+            return alignment > 0 && (alignment & (alignment - 1)) == 0 &&
+                   alignment <= max_alignment;
+        }
+
+        optional_allocation<void*> allocate_in_new_block_(const not_zero<usize> size) noexcept
+        {
+            // Blocks are `malloc` aligned, so no alignment padding is needed at the start.
+
+            if (size.get() > max_block_size) [[unlikely]]
+            {
+                return optional_allocation<void*>{nullptr};
+            }
+
+            const usize min_data_size = math::max(size.get(), block_size_.get());
+            const auto total_size =
+                mem::raw::optimal_size(not_zero{sizeof(block_header) + min_data_size});
+
+            void* const ptr = std::malloc(total_size.get());
+            if (ptr == nullptr) [[unlikely]]
+            {
+                return optional_allocation<void*>{nullptr};
+            }
+
+            auto* const b = static_cast<block_header*>(ptr);
+            b->previous   = current_;
+            b->size       = total_size.get();
+
+            current_ = b;
+            end_     = static_cast<byte*>(ptr) + total_size.get();
+
+            byte* const p = data_(b);
+            next_         = p + size.get();
+            return optional_allocation<void*>{p};
+        }
+
+        // Frees blocks from the current block (exclusive if `keep` is the current block) and back.
+        void release_blocks_(block_header* const keep) noexcept
+        {
+            block_header* b = current_;
+            if (b != nullptr && b == keep)
+            {
+                b = b->previous;
+            }
+            while (b != nullptr)
+            {
+                block_header* const previous = b->previous;
+                std::free(b);
+                b = previous;
+            }
+        }
+
+        SNN_DIAGNOSTIC_POP
+    };
+
+    // ### arena_scope
+
+    // Makes an arena the current arena of the calling thread for the lifetime of the scope.
+    // Scopes can be nested, the previous arena is restored on destruction.
+
+    class arena_scope final
+    {
+      public:
+        explicit arena_scope(arena& a) noexcept
+            : previous_{std::exchange(arena::current_arena_(), &a)}
+        {
+        }
+
+        // Non-copyable
+        arena_scope(const arena_scope&)            = delete;
+        arena_scope& operator=(const arena_scope&) = delete;
+
+        // Non-movable
+        arena_scope(arena_scope&&)            = delete;
+        arena_scope& operator=(arena_scope&&) = delete;
+
+        ~arena_scope()
+        {
+            arena::current_arena_() = previous_;
+        }
+
+      private:
+        arena* previous_;
+    };
+}
@@ -0,0 +1,134 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/mem/arena.hh"
+
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            mem::arena arena{1024};
+
+            snn_require(arena.block_count() == 0);
+            snn_require(arena.block_size() == 1024);
+
+            void* a = arena.allocate(not_zero<usize>{100}).value();
+            void* b = arena.allocate(not_zero<usize>{100}).value();
+            snn_require(a != b);
+            snn_require(arena.block_count() == 1);
+
+            // The most recent allocation can grow in place.
+            void* c = arena.reallocate(b, 100, not_zero<usize>{200}, 100).value();
+            snn_require(c == b);
+
+            // Release everything at once (the last block is kept for reuse).
+            arena.reset();
+            snn_require(arena.block_count() == 1);
+
+            void* d = arena.allocate(not_zero<usize>{100}).value();
+            snn_require(d == a);
+
+            return true;
+        }
+
+        bool test_arena()
+        {
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            {
+                mem::arena arena{1000};
+                snn_require(arena.block_size() == 1024); // Optimal size.
+                snn_require(arena.remaining_size() == 0);
+            }
+            {
+                mem::arena arena{256};
+
+                // Alignment.
+                auto* a = static_cast<byte*>(arena.allocate(not_zero<usize>{1}, 1).value());
+                auto* b = static_cast<byte*>(arena.allocate(not_zero<usize>{1}, 1).value());
+                snn_require(b == a + 1);
+                auto* c = static_cast<byte*>(arena.allocate(not_zero<usize>{8}, 8).value());
+                snn_require(c == a + 8);
+                auto* d = static_cast<byte*>(arena.allocate(not_zero<usize>{1}).value());
+                snn_require(d == a + 16);
+                snn_require(arena.block_count() == 1);
+
+                // Larger than the block size.
+                auto* e = static_cast<byte*>(arena.allocate(not_zero<usize>{1000}).value());
+                snn_require(arena.block_count() == 2);
+                e[0]   = 1;
+                e[999] = 2;
+
+                // Not the most recent allocation, must move (and copy).
+                d[0]     = 123;
+                auto opt = arena.reallocate(d, 1, not_zero<usize>{2}, 1);
+                auto* f  = static_cast<byte*>(opt.value());
+                snn_require(f != d);
+                snn_require(f[0] == 123);
+                snn_require(d[0] == 123); // Old memory is still valid.
+
+                // Shrink.
+                opt = arena.reallocate(e, 1000, not_zero<usize>{10}, 10);
+                snn_require(opt.value() == e);
+
+                // Reallocate null.
+                opt = arena.reallocate(nullptr, 0, not_zero<usize>{4}, 0);
+                snn_require(opt.value() != nullptr);
+
+                arena.release();
+                snn_require(arena.block_count() == 0);
+                snn_require(arena.remaining_size() == 0);
+            }
+            {
+                mem::arena arena;
+                snn_require(arena.block_size() == mem::arena::default_block_size);
+
+                auto opt = arena.allocate(not_zero{constant::limit<usize>::max});
+                snn_require(!opt);
+                snn_require(arena.block_count() == 0);
+            }
+
+            SNN_DIAGNOSTIC_POP
+
+            return true;
+        }
+
+        bool test_arena_scope()
+        {
+            snn_require(mem::arena::current() == nullptr);
+
+            mem::arena a;
+            {
+                mem::arena_scope scope_a{a};
+                snn_require(mem::arena::current() == &a);
+
+                mem::arena b;
+                {
+                    mem::arena_scope scope_b{b};
+                    snn_require(mem::arena::current() == &b);
+                }
+
+                snn_require(mem::arena::current() == &a);
+            }
+
+            snn_require(mem::arena::current() == nullptr);
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_arena());
+        snn_require(app::test_arena_scope());
+    }
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Allocator for trivial types backed by an arena
+
+// An allocator is bound to an arena, either explicitly or on its first allocation to the current
+// arena of the calling thread (see `arena_scope`). After that it keeps using that arena, also
+// outside of the scope (an arena is not thread-safe, so only one thread at a time). Allocation
+// fails if it isn't bound and there is no current arena. Copies are bound to the same arena.
+
+// Deallocation does nothing, memory is released when the arena is reset or destroyed. The arena
+// must outlive all memory allocated from it.
+
+// Reallocation grows in place if the allocation is the most recent allocation in the arena and it
+// fits in the current block. Old memory is never invalidated by a reallocation.
+
+// When constant evaluated this allocator behaves exactly like `trivial_allocator<T>`.
+
+#pragma once
+
+#include "snn-core/mem/arena.hh"
+#include "snn-core/mem/trivial_allocator.hh"
+
+namespace snn::mem
+{
+    // ## Classes
+
+    // ### arena_allocator
+
+    template <typename T>
+        requires(std::is_trivially_copyable_v<T> && std::is_nothrow_default_constructible_v<T>)
+    class arena_allocator final
+    {
+      public:
+        static_assert(alignof(T) <= arena::max_alignment);
+
+        // #### Constants
+
+        static constexpr usize max_count = constant::limit<usize>::max / sizeof(T);
+
+        // Old memory stays valid after a reallocation (until the arena is reset).
+        static constexpr bool reallocate_keeps_old_memory = true;
+
+        // #### Constructors
+
+        // Binds to the current arena on the first allocation.
+        constexpr arena_allocator() noexcept = default;
+
+        constexpr explicit arena_allocator(arena& a) noexcept
+            : arena_{&a}
+        {
+        }
+
+        // #### Arena
+
+        // The bound arena, can be null.
+        [[nodiscard]] constexpr arena* get_arena() const noexcept
+        {
+            return arena_;
+        }
+
+        // #### Allocation/Deallocation
+
+        [[nodiscard]] constexpr optional_allocation<T*> allocate(
+            const not_zero<usize> count) noexcept
+        {
+            if (std::is_constant_evaluated())
+            {
+                return trivial_allocator<T>{}.allocate(count);
+            }
+
+            arena* const a = bind_();
+            if (a == nullptr || count.get() > max_count) [[unlikely]]
+            {
+                return optional_allocation<T*>{nullptr};
+            }
+
+            auto opt = a->allocate(not_zero{count.get() * sizeof(T)}, alignof(T));
+            return optional_allocation{static_cast<T*>(opt.value_or_nullptr())};
+        }
+
+        // Does nothing (when not constant evaluated).
+        constexpr void deallocate(T* const ptr, const usize initial_count) noexcept
+        {
+            snn_should(ptr != nullptr || initial_count == 0);
+
+            if (std::is_constant_evaluated())
+            {
+                trivial_allocator<T>{}.deallocate(ptr, initial_count);
+            }
+            else
+            {
+                snn_should(ptr == nullptr || arena_ != nullptr);
+            }
+        }
+
+        // If this fails the old memory is left as is.
+        [[nodiscard]] constexpr optional_allocation<T*> reallocate(T* const old_ptr,
+                                                                   const usize initial_count,
+                                                                   const not_zero<usize> new_count,
+                                                                   const usize use_count) noexcept
+        {
+            snn_should(old_ptr != nullptr || (initial_count == 0 && use_count == 0));
+            snn_should(use_count <= initial_count);
+
+            if (std::is_constant_evaluated())
+            {
+                return trivial_allocator<T>{}.reallocate(old_ptr, initial_count, new_count,
+                                                         use_count);
+            }
+
+            // Memory allocated by this allocator, so it is already bound.
+            snn_should(old_ptr == nullptr || arena_ != nullptr);
+
+            arena* const a = bind_();
+            if (a == nullptr || new_count.get() > max_count) [[unlikely]]
+            {
+                return optional_allocation<T*>{nullptr};
+            }
+
+            auto opt = a->reallocate(old_ptr, initial_count * sizeof(T),
+                                     not_zero{new_count.get() * sizeof(T)}, use_count * sizeof(T),
+                                     alignof(T));
+            return optional_allocation{static_cast<T*>(opt.value_or_nullptr())};
+        }
+
+      private:
+        arena* arena_{nullptr};
+
+        arena* bind_() noexcept
+        {
+            if (arena_ == nullptr)
+            {
+                arena_ = arena::current();
+            }
+            return arena_;
+        }
+    };
+}
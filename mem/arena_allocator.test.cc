@@ -0,0 +1,223 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/mem/arena_allocator.hh"
+
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        using arena_string = strcore<detail::strcore::arena_buf>;
+
+        bool example()
+        {
+            mem::arena arena;
+
+            {
+                mem::arena_scope scope{arena};
+
+                arena_string s{"One"};
+                s << ", Two" << ", Three";
+                snn_require(s == "One, Two, Three");
+
+                arena_string copy{s};
+                snn_require(copy == s);
+                snn_require(copy.data().get() != s.data().get());
+            }
+
+            // All strings are freed at once.
+            arena.reset();
+
+            return true;
+        }
+
+        bool test_arena_allocator()
+        {
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            mem::arena_allocator<int> alloc;
+
+            // No current arena.
+            snn_require(!alloc.allocate(not_zero<usize>{2}));
+            snn_require_throws_code(alloc.allocate(not_zero<usize>{2}).value(),
+                                    generic::error::memory_allocation_failure);
+
+            mem::arena arena;
+            mem::arena_scope scope{arena};
+
+            int* ptr = alloc.allocate(not_zero<usize>{2}).value();
+            ptr[0]   = 123;
+            ptr[1]   = 456;
+
+            // Grow in place.
+            int* ptr2 = alloc.reallocate(ptr, 2, not_zero<usize>{3}, 2).value();
+            snn_require(ptr2 == ptr);
+            snn_require(ptr[0] == 123);
+            snn_require(ptr[1] == 456);
+
+            // Does nothing.
+            alloc.deallocate(ptr, 3);
+
+            // Not the most recent allocation, moved (the old memory is still valid).
+            int* other = alloc.allocate(not_zero<usize>{1}).value();
+            other[0]   = 789;
+            ptr2       = alloc.reallocate(ptr, 3, not_zero<usize>{4}, 2).value();
+            snn_require(ptr2 != ptr);
+            snn_require(ptr2[0] == 123);
+            snn_require(ptr2[1] == 456);
+            snn_require(ptr[0] == 123);
+            snn_require(other[0] == 789);
+
+            snn_require(!alloc.allocate(not_zero{constant::limit<usize>::max}));
+
+            snn_require(arena.block_count() == 1);
+
+            SNN_DIAGNOSTIC_POP
+
+            return true;
+        }
+
+        constexpr bool test_arena_string()
+        {
+            arena_string s;
+            snn_require(s.is_empty());
+            snn_require(s.capacity() == 0);
+
+            s.append("abcdefghijklmnopqrstuvwxyz");
+            s.append(s.view());
+            snn_require(s.size() == 52);
+            snn_require(s.view(0, 26) == "abcdefghijklmnopqrstuvwxyz");
+            snn_require(s.view(26) == "abcdefghijklmnopqrstuvwxyz");
+
+            s.insert_at(0, "123");
+            s.replace("abc", "_");
+            snn_require(s == "123_defghijklmnopqrstuvwxyz_defghijklmnopqrstuvwxyz");
+
+            s.shrink_to_fit();
+            snn_require(s.size() == 51);
+
+            arena_string moved{std::move(s)};
+            snn_require(moved.size() == 51);
+            snn_require(s.is_empty());
+
+            moved.reset();
+            snn_require(moved.capacity() == 0);
+
+            return true;
+        }
+
+        bool test_arena_string_in_place()
+        {
+            mem::arena arena;
+            mem::arena_scope scope{arena};
+
+            arena_string s{init::reserve, 20};
+            const char* const data = s.data().get();
+
+            // Grows in place as long as it's the most recent allocation in the arena.
+            while (s.size() < 10'000)
+            {
+                s.append("0123456789");
+                snn_require(s.data().get() == data);
+            }
+            snn_require(s.size() == 10'000);
+            snn_require(arena.block_count() == 1);
+
+            // Growing (append) from itself.
+            s.append(s.view(0, 5000));
+            snn_require(s.size() == 15'000);
+            snn_require(s.view(10'000, 10) == "0123456789");
+
+            return true;
+        }
+
+        bool test_arena_binding()
+        {
+            mem::arena a;
+            mem::arena b;
+
+            {
+                // Bound explicitly.
+                mem::arena_allocator<int> alloc{a};
+                snn_require(alloc.get_arena() == &a);
+                snn_require(alloc.allocate(not_zero<usize>{2}));
+                snn_require(a.block_count() == 1);
+            }
+
+            {
+                mem::arena_allocator<int> alloc;
+                snn_require(alloc.get_arena() == nullptr);
+
+                mem::arena_scope scope_a{a};
+                snn_require(alloc.allocate(not_zero<usize>{2}));
+                snn_require(alloc.get_arena() == &a);
+
+                // Stays bound to `a`.
+                mem::arena_scope scope_b{b};
+                snn_require(alloc.allocate(not_zero<usize>{2}));
+                snn_require(alloc.get_arena() == &a);
+                snn_require(b.block_count() == 0);
+
+                const mem::arena_allocator<int> copy{alloc};
+                snn_require(copy.get_arena() == &a);
+            }
+
+            arena_string s;
+            {
+                mem::arena_scope scope{b};
+                s.append("abc");
+            }
+
+            // Grows (and is destroyed) outside of the scope, with the arena it allocated from.
+            while (s.size() < 10'000)
+            {
+                s.append("0123456789");
+            }
+            snn_require(s.size() == 10'003);
+            snn_require(s.view(0, 5) == "abc01");
+            snn_require(b.block_count() == 1);
+
+            // Grows in another scope, still in `b`.
+            {
+                mem::arena_scope scope{a};
+                s.append(s.view(0, 3));
+                snn_require(s.view(10'000) == "789abc");
+            }
+            snn_require(b.block_count() == 1);
+
+            // After a reset it binds to the current arena again.
+            s.reset();
+            {
+                mem::arena_scope scope{a};
+                const usize block_count = a.block_count();
+                s.append("A string that will be allocated in the other arena.");
+                snn_require(a.block_count() == block_count);
+                snn_require(s.capacity() > 0);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_arena_allocator());
+
+        {
+            mem::arena arena;
+            mem::arena_scope scope{arena};
+            snn_static_require(app::test_arena_string());
+        }
+
+        snn_require(app::test_arena_string_in_place());
+        snn_require(app::test_arena_binding());
+    }
+}
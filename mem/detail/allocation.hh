@@ -0,0 +1,188 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Untyped heap allocation (malloc, aligned and large)
+
+// Used by the allocators without state, `size` must always be the size that was allocated.
+// * Alignment up to `malloc_alignment`: `malloc`/`realloc`/`free`.
+// * Greater alignment (e.g. 64 for cache lines or AVX-512): `aligned_alloc`, reallocation copies.
+// * At least `large_threshold` bytes (Linux): Anonymous `mmap` aligned to a huge page with
+//   `MADV_HUGEPAGE` (fewer TLB misses), reallocation with `mremap` (no copy, pages are remapped).
+
+#pragma once
+
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/raw/copy.hh"
+#include <cstddef> // max_align_t
+#include <cstdlib> // aligned_alloc, free, malloc, realloc
+#if defined(__linux__)
+    #include <sys/mman.h> // madvise, mmap, mremap, munmap
+#endif
+
+namespace snn::mem::detail::allocation
+{
+    inline constexpr usize malloc_alignment = alignof(std::max_align_t);
+
+#if defined(__linux__)
+    inline constexpr bool large_enabled = true;
+#else
+    inline constexpr bool large_enabled = false;
+#endif
+
+    inline constexpr usize large_threshold = usize{32} << 20;  // 32 MiB
+    inline constexpr usize huge_page_size  = usize{2} << 20;   // 2 MiB (x86-64 & AArch64 with 4K)
+    inline constexpr usize max_alignment   = usize{4} << 10;   // 4 KiB (page)
+
+    [[nodiscard]] constexpr bool is_large(const usize size) noexcept
+    {
+        return large_enabled && size >= large_threshold;
+    }
+
+    [[nodiscard]] constexpr bool is_valid_alignment(const usize alignment) noexcept
+    {
+        return alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= max_alignment;
+    }
+
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+#if defined(__linux__)
+    // Round up to a multiple of the huge page size (0 on overflow).
+    [[nodiscard]] constexpr usize map_size(const usize size) noexcept
+    {
+        if (size > (constant::limit<usize>::max - huge_page_size)) [[unlikely]]
+        {
+            return 0;
+        }
+        return (size + (huge_page_size - 1)) & ~(huge_page_size - 1);
+    }
+
+    inline void* map(const usize size) noexcept
+    {
+        const usize mapped = map_size(size);
+        if (mapped == 0) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        // Over-map by a huge page and trim, so the mapping starts on a huge page boundary.
+        const usize over = mapped + huge_page_size;
+        void* const ptr =
+            ::mmap(nullptr, over, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        auto* const first = static_cast<byte*>(ptr);
+        const auto addr   = reinterpret_cast<uptr>(first);
+        const usize head  = ((addr + (huge_page_size - 1)) & ~(huge_page_size - 1)) - addr;
+        if (head > 0)
+        {
+            ::munmap(first, head);
+        }
+        ::munmap(first + head + mapped, huge_page_size - head);
+
+        byte* const p = first + head;
+        // Failure (e.g. transparent huge pages disabled) is ignored.
+        ::madvise(p, mapped, MADV_HUGEPAGE);
+        return p;
+    }
+#endif
+
+    // #### allocate/deallocate/reallocate
+
+    [[nodiscard]] inline void* allocate(const usize size, const usize alignment) noexcept
+    {
+        snn_should(size > 0 && is_valid_alignment(alignment));
+
+#if defined(__linux__)
+        if (is_large(size))
+        {
+            return map(size);
+        }
+#endif
+
+        if (alignment <= malloc_alignment)
+        {
+            return std::malloc(size);
+        }
+
+        // The size must be a multiple of the alignment.
+        if (size > (constant::limit<usize>::max - alignment)) [[unlikely]]
+        {
+            return nullptr;
+        }
+        return std::aligned_alloc(alignment, (size + (alignment - 1)) & ~(alignment - 1));
+    }
+
+    // Does nothing if `ptr` is null.
+    inline void deallocate(void* const ptr, const usize size) noexcept
+    {
+#if defined(__linux__)
+        if (ptr != nullptr && is_large(size))
+        {
+            ::munmap(ptr, map_size(size));
+            return;
+        }
+#else
+        ignore_if_unused(size);
+#endif
+        std::free(ptr);
+    }
+
+    // The first `use_size` bytes are preserved. If this fails the old memory is left as is.
+    [[nodiscard]] inline void* reallocate(void* const ptr, const usize old_size,
+                                          const usize new_size, const usize use_size,
+                                          const usize alignment) noexcept
+    {
+        snn_should(ptr != nullptr || (old_size == 0 && use_size == 0));
+        snn_should(new_size > 0 && use_size <= old_size);
+
+        if (ptr == nullptr)
+        {
+            return allocate(new_size, alignment);
+        }
+
+#if defined(__linux__)
+        if (is_large(old_size) && is_large(new_size))
+        {
+            const usize old_mapped = map_size(old_size);
+            const usize new_mapped = map_size(new_size);
+            if (new_mapped == 0) [[unlikely]]
+            {
+                return nullptr;
+            }
+            if (new_mapped == old_mapped)
+            {
+                return ptr;
+            }
+
+            // Huge page advice is kept when a mapping is resized or moved.
+            void* const new_ptr = ::mremap(ptr, old_mapped, new_mapped, MREMAP_MAYMOVE);
+            return new_ptr != MAP_FAILED ? new_ptr : nullptr;
+        }
+#endif
+
+        if (!is_large(old_size) && !is_large(new_size) && alignment <= malloc_alignment)
+        {
+            return std::realloc(ptr, new_size);
+        }
+
+        void* const new_ptr = allocate(new_size, alignment);
+        if (new_ptr != nullptr)
+        {
+            const usize copy_size = math::min(use_size, new_size);
+            if (copy_size > 0)
+            {
+                mem::raw::copy(not_null<const byte*>{static_cast<const byte*>(ptr)},
+                               not_null{static_cast<byte*>(new_ptr)}, byte_size{copy_size},
+                               assume::no_overlap);
+            }
+            deallocate(ptr, old_size);
+        }
+        return new_ptr;
+    }
+
+    SNN_DIAGNOSTIC_POP
+}
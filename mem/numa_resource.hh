@@ -0,0 +1,203 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # NUMA-local memory resource
+
+// Page-granular memory (`mmap`) with a preference for a given NUMA node (Linux, `mbind` with
+// `MPOL_PREFERRED`, falls back to other nodes if the preferred node is full). The node defaults
+// to the node of the CPU the calling thread is running on.
+
+// Every allocation is a separate mapping, so this is typically used as the upstream resource of a
+// `pool_resource` owned by a thread that is pinned to a CPU: a per-thread pool with local memory.
+
+// On other platforms memory is mapped without a node preference.
+
+#pragma once
+
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/resource.hh"
+#include "snn-core/mem/raw/copy.hh"
+#include <sys/mman.h> // mmap, mremap, munmap
+#include <unistd.h>   // sysconf, syscall
+#if defined(__linux__)
+    #include <sys/syscall.h> // SYS_getcpu, SYS_mbind
+#endif
+
+namespace snn::mem
+{
+    // ## Classes
+
+    // ### numa_resource
+
+    class numa_resource final
+    {
+      public:
+        // #### Constants
+
+        static constexpr usize max_alignment = alignof(std::max_align_t); // Pages are aligned.
+
+        // #### Default constructor
+
+        // Prefer the node of the CPU the calling thread is running on.
+        numa_resource() noexcept
+            : numa_resource{current_node()}
+        {
+        }
+
+        // #### Explicit constructors
+
+        explicit numa_resource(const u32 node) noexcept
+            : node_{node},
+              page_size_{static_cast<usize>(math::max(::sysconf(_SC_PAGESIZE), 4096L))}
+        {
+        }
+
+        // #### Allocation/Deallocation
+
+        [[nodiscard]] optional_allocation<void*> allocate(
+            const not_zero<usize> size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(alignment > 0 && alignment <= max_alignment);
+            ignore_if_unused(alignment);
+
+            const usize map_size = page_round_(size.get());
+            if (map_size == 0) [[unlikely]]
+            {
+                return optional_allocation<void*>{nullptr};
+            }
+
+            void* const ptr = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+                                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr == MAP_FAILED) [[unlikely]]
+            {
+                return optional_allocation<void*>{nullptr};
+            }
+
+            prefer_node_(ptr, map_size);
+            return optional_allocation<void*>{ptr};
+        }
+
+        // Does nothing if `ptr` is null.
+        void deallocate(void* const ptr, const usize size,
+                        const usize alignment = max_alignment) noexcept
+        {
+            ignore_if_unused(alignment);
+            if (ptr != nullptr)
+            {
+                ::munmap(ptr, page_round_(size));
+            }
+        }
+
+        // If this fails the old memory is left as is.
+        [[nodiscard]] optional_allocation<void*> reallocate(
+            void* const ptr, const usize old_size, const not_zero<usize> new_size,
+            const usize use_size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(ptr != nullptr || (old_size == 0 && use_size == 0));
+            snn_should(use_size <= old_size);
+
+            if (ptr == nullptr)
+            {
+                return allocate(new_size, alignment);
+            }
+
+            const usize old_map_size = page_round_(old_size);
+            const usize new_map_size = page_round_(new_size.get());
+            if (new_map_size == 0) [[unlikely]]
+            {
+                return optional_allocation<void*>{nullptr};
+            }
+
+            if (new_map_size == old_map_size)
+            {
+                return optional_allocation<void*>{ptr};
+            }
+
+#if defined(__linux__)
+            ignore_if_unused(use_size); // mremap() keeps the whole mapping.
+
+            // The memory policy is kept when a mapping is resized or moved.
+            void* const new_ptr = ::mremap(ptr, old_map_size, new_map_size, MREMAP_MAYMOVE);
+            if (new_ptr == MAP_FAILED) [[unlikely]]
+            {
+                return optional_allocation<void*>{nullptr};
+            }
+            return optional_allocation<void*>{new_ptr};
+#else
+            auto opt = allocate(new_size, alignment);
+            if (opt)
+            {
+                const usize copy_size = math::min(use_size, new_size.get());
+                if (copy_size > 0)
+                {
+                    mem::raw::copy(not_null<const byte*>{static_cast<const byte*>(ptr)},
+                                   not_null{static_cast<byte*>(opt.value(assume::has_value))},
+                                   byte_size{copy_size}, assume::no_overlap);
+                }
+                deallocate(ptr, old_size, alignment);
+            }
+            return opt;
+#endif
+        }
+
+        // #### Status
+
+        [[nodiscard]] u32 node() const noexcept
+        {
+            return node_;
+        }
+
+        [[nodiscard]] usize page_size() const noexcept
+        {
+            return page_size_;
+        }
+
+        // #### Current node
+
+        // The NUMA node of the CPU the calling thread is running on (0 if unknown).
+        [[nodiscard]] static u32 current_node() noexcept
+        {
+#if defined(__linux__)
+            unsigned int cpu  = 0;
+            unsigned int node = 0;
+            if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+            {
+                return node;
+            }
+#endif
+            return 0;
+        }
+
+      private:
+        u32 node_;
+        usize page_size_;
+
+        // Returns 0 on overflow.
+        usize page_round_(const usize size) const noexcept
+        {
+            const usize mask = page_size_ - 1;
+            if (size > constant::limit<usize>::max - mask) [[unlikely]]
+            {
+                return 0;
+            }
+            return (size + mask) & ~mask;
+        }
+
+        void prefer_node_(void* const ptr, const usize size) const noexcept
+        {
+#if defined(__linux__)
+            constexpr int mpol_preferred = 1; // MPOL_PREFERRED (linux/mempolicy.h)
+            constexpr usize mask_bits    = sizeof(unsigned long) * 8;
+            if (node_ < mask_bits)
+            {
+                const unsigned long mask = 1UL << node_;
+                // Failure (e.g. no NUMA support) is ignored, the memory is still usable.
+                ::syscall(SYS_mbind, ptr, size, mpol_preferred, &mask, mask_bits + 1, 0);
+            }
+#else
+            ignore_if_unused(ptr);
+            ignore_if_unused(size);
+#endif
+        }
+    };
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/mem/numa_resource.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/mem/pool_resource.hh"
+#include "snn-core/mem/resource_allocator.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // A per-thread pool with chunks on the node the thread is running on.
+            mem::numa_resource numa;
+            mem::pool_resource<mem::numa_resource> pool{numa};
+
+            using allocator = mem::resource_allocator<u32, mem::pool_resource<mem::numa_resource>>;
+
+            vec<u32, 0, allocator> v{allocator{pool}};
+            for (u32 i = 0; i < 1000; ++i)
+            {
+                v.append(i);
+            }
+            snn_require(v.count() == 1000);
+            snn_require(v.at(999, assume::within_bounds) == 999);
+
+            return true;
+        }
+
+        bool test_numa_resource()
+        {
+            static_assert(mem::resource<mem::numa_resource>);
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            mem::numa_resource numa{mem::numa_resource::current_node()};
+            snn_require(numa.node() == mem::numa_resource::current_node());
+            snn_require(numa.page_size() >= 4096);
+
+            char* p = static_cast<char*>(numa.allocate(not_zero<usize>{10}).value());
+            snn_require(reinterpret_cast<uptr>(p) % numa.page_size() == 0);
+            p[0] = 'a';
+            p[9] = 'b';
+
+            // Same page count.
+            snn_require(numa.reallocate(p, 10, not_zero<usize>{100}, 10).value() == p);
+
+            // Grow.
+            const usize size = numa.page_size() * 10;
+            p = static_cast<char*>(numa.reallocate(p, 100, not_zero{size}, 10).value());
+            snn_require(p[0] == 'a');
+            snn_require(p[9] == 'b');
+            p[size - 1] = 'c';
+
+            numa.deallocate(p, size);
+            numa.deallocate(nullptr, 0); // Does nothing.
+
+            snn_require(!numa.allocate(not_zero{constant::limit<usize>::max}));
+
+            SNN_DIAGNOSTIC_POP
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_numa_resource());
+    }
+}
@@ -0,0 +1,278 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Size-class pool memory resource
+
+// Small allocations (up to `max_class_size` bytes) are rounded up to a power of two size class and
+// served from a free list per class. Free lists are refilled from large chunks allocated from an
+// upstream resource (`malloc_resource` by default). Deallocated memory is reused by later
+// allocations of the same class, chunks are only returned upstream by `release()` or when the pool
+// is destroyed. Larger allocations are forwarded to the upstream resource.
+
+// A pool is owned by the caller and is not thread-safe, use one per thread (or per request) to
+// avoid allocator contention. With a `numa_resource` upstream the chunks are NUMA-local.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/resource.hh"
+#include "snn-core/mem/raw/copy.hh"
+#include "snn-core/mem/raw/optimal_size.hh"
+#include <bit> // bit_width
+
+namespace snn::mem
+{
+    // ## Classes
+
+    // ### pool_resource
+
+    template <resource Upstream = malloc_resource>
+    class pool_resource final
+    {
+      public:
+        // #### Constants
+
+        static constexpr usize max_alignment = alignof(std::max_align_t);
+
+        static constexpr usize min_class_size = 16;
+        static constexpr usize max_class_size = 4096;
+        static constexpr usize class_count    = 9; // 16, 32, 64, ..., 4096
+
+        static constexpr usize default_chunk_size = 64 * 1024;
+
+        static_assert(min_class_size % max_alignment == 0);
+        static_assert(Upstream::max_alignment >= max_alignment);
+        static_assert((min_class_size << (class_count - 1)) == max_class_size);
+
+        // #### Explicit constructors
+
+        explicit pool_resource(Upstream& upstream,
+                               const usize min_chunk_size = default_chunk_size) noexcept
+            : upstream_{&upstream},
+              chunk_size_{mem::raw::optimal_size(
+                  not_zero{math::max(min_chunk_size, max_class_size) + sizeof(chunk_header)})}
+        {
+        }
+
+        // #### Default constructor
+
+        pool_resource() noexcept
+            requires(std::is_same_v<Upstream, malloc_resource>)
+            : pool_resource{malloc_resource::instance()}
+        {
+        }
+
+        // #### Non-copyable/non-movable
+
+        // A pool can be referenced by allocators or by memory handed out from it.
+
+        pool_resource(const pool_resource&)            = delete;
+        pool_resource& operator=(const pool_resource&) = delete;
+
+        pool_resource(pool_resource&&)            = delete;
+        pool_resource& operator=(pool_resource&&) = delete;
+
+        // #### Destructor
+
+        ~pool_resource()
+        {
+            release();
+        }
+
+        // #### Allocation/Deallocation
+
+        [[nodiscard]] optional_allocation<void*> allocate(
+            const not_zero<usize> size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(alignment > 0 && alignment <= max_alignment);
+
+            if (size.get() > max_class_size)
+            {
+                return upstream_->allocate(size, alignment);
+            }
+
+            const usize index = class_index_(size.get());
+            free_node*& head  = free_.at(index, assume::within_bounds);
+            if (head != nullptr) [[likely]]
+            {
+                free_node* const n = head;
+                head               = n->next;
+                return optional_allocation<void*>{n};
+            }
+
+            return allocate_from_chunk_(class_size_(index));
+        }
+
+        // Does nothing if `ptr` is null.
+        void deallocate(void* const ptr, const usize size,
+                        const usize alignment = max_alignment) noexcept
+        {
+            if (ptr == nullptr)
+            {
+                return;
+            }
+
+            if (size > max_class_size)
+            {
+                upstream_->deallocate(ptr, size, alignment);
+                return;
+            }
+
+            snn_should(size > 0);
+            free_node*& head = free_.at(class_index_(size), assume::within_bounds);
+            auto* const n    = static_cast<free_node*>(ptr);
+            n->next          = head;
+            head             = n;
+        }
+
+        // If this fails the old memory is left as is.
+        [[nodiscard]] optional_allocation<void*> reallocate(
+            void* const ptr, const usize old_size, const not_zero<usize> new_size,
+            const usize use_size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(ptr != nullptr || (old_size == 0 && use_size == 0));
+            snn_should(use_size <= old_size);
+
+            if (ptr == nullptr)
+            {
+                return allocate(new_size, alignment);
+            }
+
+            if (old_size > max_class_size && new_size.get() > max_class_size)
+            {
+                return upstream_->reallocate(ptr, old_size, new_size, use_size, alignment);
+            }
+
+            if (old_size <= max_class_size && new_size.get() <= max_class_size &&
+                class_index_(old_size) == class_index_(new_size.get()))
+            {
+                return optional_allocation<void*>{ptr};
+            }
+
+            auto opt = allocate(new_size, alignment);
+            if (opt)
+            {
+                const usize copy_size = math::min(use_size, new_size.get());
+                if (copy_size > 0)
+                {
+                    mem::raw::copy(not_null<const byte*>{static_cast<const byte*>(ptr)},
+                                   not_null{static_cast<byte*>(opt.value(assume::has_value))},
+                                   byte_size{copy_size}, assume::no_overlap);
+                }
+                deallocate(ptr, old_size, alignment);
+            }
+            return opt;
+        }
+
+        // #### Status
+
+        [[nodiscard]] usize chunk_count() const noexcept
+        {
+            usize count = 0;
+            for (const chunk_header* c = chunks_; c != nullptr; c = c->previous)
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        [[nodiscard]] usize chunk_size() const noexcept
+        {
+            return chunk_size_.get();
+        }
+
+        [[nodiscard]] Upstream& upstream() const noexcept
+        {
+            return *upstream_;
+        }
+
+        // #### Release
+
+        // Returns all chunks to the upstream resource, invalidating all small allocations. Large
+        // allocations (forwarded upstream) are not tracked and must be deallocated individually.
+
+        void release() noexcept
+        {
+            chunk_header* c = chunks_;
+            while (c != nullptr)
+            {
+                chunk_header* const previous = c->previous;
+                upstream_->deallocate(c, c->size, max_alignment);
+                c = previous;
+            }
+
+            chunks_ = nullptr;
+            next_   = nullptr;
+            end_    = nullptr;
+            free_.fill(nullptr);
+        }
+
+      private:
+        struct free_node final
+        {
+            free_node* next;
+        };
+
+        struct chunk_header final
+        {
+            chunk_header* previous;
+            usize size;
+        };
+
+        static_assert(sizeof(chunk_header) % max_alignment == 0);
+
+        array<free_node*, class_count> free_{};
+        chunk_header* chunks_{nullptr};
+        byte* next_{nullptr};
+        byte* end_{nullptr};
+        Upstream* upstream_;
+        not_zero<usize> chunk_size_;
+
+        static constexpr usize class_index_(const usize size) noexcept
+        {
+            snn_should(size > 0 && size <= max_class_size);
+            if (size <= min_class_size)
+            {
+                return 0;
+            }
+            return static_cast<usize>(std::bit_width(size - 1)) -
+                   static_cast<usize>(std::bit_width(min_class_size - 1));
+        }
+
+        static constexpr usize class_size_(const usize index) noexcept
+        {
+            return min_class_size << index;
+        }
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        optional_allocation<void*> allocate_from_chunk_(const usize size) noexcept
+        {
+            if (size > static_cast<usize>(end_ - next_)) [[unlikely]]
+            {
+                // The rest of the current chunk is abandoned (less than `size` bytes).
+                auto opt = upstream_->allocate(chunk_size_, max_alignment);
+                if (!opt) [[unlikely]]
+                {
+                    return opt;
+                }
+
+                auto* const c = static_cast<chunk_header*>(opt.value(assume::has_value));
+                c->previous   = chunks_;
+                c->size       = chunk_size_.get();
+                chunks_       = c;
+
+                next_ = reinterpret_cast<byte*>(c) + sizeof(chunk_header);
+                end_  = reinterpret_cast<byte*>(c) + chunk_size_.get();
+            }
+
+            byte* const p = next_;
+            next_ += size;
+            return optional_allocation<void*>{p};
+        }
+
+        SNN_DIAGNOSTIC_POP
+    };
+}
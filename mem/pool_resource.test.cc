@@ -0,0 +1,106 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/mem/pool_resource.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/mem/resource_allocator.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // One pool per thread, no allocator contention between threads.
+            static thread_local mem::pool_resource<> pool;
+
+            using allocator = mem::resource_allocator<u64, mem::pool_resource<>>;
+
+            vec<u64, 0, allocator> v{allocator{pool}};
+            for (u64 i = 0; i < 100; ++i)
+            {
+                v.append(i);
+            }
+            snn_require(v.count() == 100);
+            snn_require(v.at(99, assume::within_bounds) == 99);
+
+            return true;
+        }
+
+        bool test_pool_resource()
+        {
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            {
+                mem::pool_resource<> pool;
+                snn_require(pool.chunk_count() == 0);
+                snn_require(pool.chunk_size() >= mem::pool_resource<>::default_chunk_size);
+
+                // Same size class, freed memory is reused.
+                void* a = pool.allocate(not_zero<usize>{20}).value();
+                snn_require(pool.chunk_count() == 1);
+                pool.deallocate(a, 20);
+                void* b = pool.allocate(not_zero<usize>{32}).value();
+                snn_require(b == a);
+
+                // Different size class.
+                void* c = pool.allocate(not_zero<usize>{16}).value();
+                snn_require(c != b);
+                snn_require(reinterpret_cast<uptr>(c) % mem::pool_resource<>::max_alignment == 0);
+
+                // Reallocate within the same size class keeps the pointer.
+                void* d = pool.reallocate(b, 32, not_zero<usize>{30}, 32).value();
+                snn_require(d == b);
+
+                // Reallocate to another class copies.
+                static_cast<char*>(d)[0] = 'x';
+                void* e                  = pool.reallocate(d, 30, not_zero<usize>{100}, 1).value();
+                snn_require(e != d);
+                snn_require(static_cast<char*>(e)[0] == 'x');
+
+                // Large allocations are forwarded to the upstream resource.
+                void* f = pool.allocate(not_zero<usize>{100'000}).value();
+                f       = pool.reallocate(f, 100'000, not_zero<usize>{200'000}, 100'000).value();
+                void* g = pool.reallocate(f, 200'000, not_zero<usize>{10}, 10).value();
+                snn_require(g != nullptr);
+                snn_require(pool.chunk_count() == 1);
+
+                // Many allocations.
+                for (usize i = 0; i < 1000; ++i)
+                {
+                    snn_require(pool.allocate(not_zero<usize>{4096}));
+                }
+                snn_require(pool.chunk_count() > 1);
+
+                pool.release();
+                snn_require(pool.chunk_count() == 0);
+
+                snn_require(!pool.allocate(not_zero{constant::limit<usize>::max}));
+            }
+            {
+                // Custom upstream.
+                mem::malloc_resource upstream;
+                mem::pool_resource<mem::malloc_resource> pool{upstream, 1024};
+                snn_require(&pool.upstream() == &upstream);
+                snn_require(pool.chunk_size() > mem::pool_resource<>::max_class_size);
+                snn_require(pool.allocate(not_zero<usize>{1}));
+            }
+
+            SNN_DIAGNOSTIC_POP
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_pool_resource());
+    }
+}
@@ -0,0 +1,326 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # SIMD search kernels (SSE2/SSSE3/AVX2)
+
+// All kernels return a position before which there is no match, this is the position of the
+// first match if a match is found. Only full chunks are processed, the caller continues with the
+// scalar code from the returned position. The kernels return 0 if no supported instruction set is
+// enabled at compile time.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/mem/raw/is_equal.hh"
+#include <bit> // countr_zero
+#if SNN_SSE2_ENABLED
+    #include <immintrin.h>
+#endif
+
+namespace snn::mem::raw::detail::simd
+{
+    SNN_DIAGNOSTIC_PUSH
+    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+#if SNN_SSE2_ENABLED
+    namespace sse
+    {
+        inline __m128i load(const char* const data) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        }
+
+        inline __m128i load(const array<u8, 16>& table) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.begin()));
+        }
+    }
+#endif
+
+#if SNN_AVX2_ENABLED
+    namespace avx
+    {
+        inline __m256i load(const char* const data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+    }
+#endif
+
+    // ## Functions
+
+    // ### find
+
+    // Substring search, "SIMD-friendly algorithms for substring searching" by Wojciech Muła
+    // (http://0x80.pl/articles/simd-strfind.html): The first and the last byte of the needle are
+    // compared with 16 or 32 positions at a time, only candidates are compared in full.
+
+    inline usize find(const char* const haystack, const usize haystack_size,
+                      const char* const needle, const usize needle_size) noexcept
+    {
+        usize pos = 0;
+
+#if SNN_SSE2_ENABLED
+        if (needle_size < 2 || needle_size > haystack_size)
+        {
+            return 0;
+        }
+
+        const usize last_offset = needle_size - 1;
+
+        // The first and the last byte have already been compared.
+        const auto is_match = [&](const usize candidate) noexcept {
+            if (needle_size == 2)
+            {
+                return true;
+            }
+            return mem::raw::is_equal(not_null{haystack + candidate + 1}, not_null{needle + 1},
+                                      byte_size{needle_size - 2});
+        };
+
+    #if SNN_AVX2_ENABLED
+        {
+            const __m256i first = _mm256_set1_epi8(needle[0]);
+            const __m256i last  = _mm256_set1_epi8(needle[last_offset]);
+            while ((haystack_size - last_offset - pos) >= 32)
+            {
+                const __m256i a = avx::load(haystack + pos);
+                const __m256i b = avx::load(haystack + pos + last_offset);
+                u32 mask        = static_cast<u32>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+                while (mask != 0)
+                {
+                    const usize candidate = pos + static_cast<usize>(std::countr_zero(mask));
+                    if (is_match(candidate))
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1; // Clear lowest set bit.
+                }
+                pos += 32;
+            }
+        }
+    #endif
+
+        {
+            const __m128i first = _mm_set1_epi8(needle[0]);
+            const __m128i last  = _mm_set1_epi8(needle[last_offset]);
+            while ((haystack_size - last_offset - pos) >= 16)
+            {
+                const __m128i a = sse::load(haystack + pos);
+                const __m128i b = sse::load(haystack + pos + last_offset);
+                u32 mask        = static_cast<u32>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+                while (mask != 0)
+                {
+                    const usize candidate = pos + static_cast<usize>(std::countr_zero(mask));
+                    if (is_match(candidate))
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1; // Clear lowest set bit.
+                }
+                pos += 16;
+            }
+        }
+#endif
+
+        ignore_if_unused(haystack, haystack_size, needle, needle_size);
+        return pos;
+    }
+
+    // ### find_any_of
+
+    // Find any of up to 16 bytes, one comparison per byte.
+
+    inline constexpr usize find_any_of_max_size = 16;
+
+    inline usize find_any_of(const char* const haystack, const usize haystack_size,
+                             const char* const bytes, const usize bytes_size) noexcept
+    {
+        usize pos = 0;
+
+#if SNN_SSE2_ENABLED
+        if (bytes_size == 0 || bytes_size > find_any_of_max_size)
+        {
+            return 0;
+        }
+
+    #if SNN_AVX2_ENABLED
+        while ((haystack_size - pos) >= 32)
+        {
+            const __m256i in = avx::load(haystack + pos);
+            __m256i found    = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(bytes[0]));
+            for (usize i = 1; i < bytes_size; ++i)
+            {
+                found = _mm256_or_si256(found, _mm256_cmpeq_epi8(in, _mm256_set1_epi8(bytes[i])));
+            }
+            const u32 mask = static_cast<u32>(_mm256_movemask_epi8(found));
+            if (mask != 0)
+            {
+                return pos + static_cast<usize>(std::countr_zero(mask));
+            }
+            pos += 32;
+        }
+    #endif
+
+        while ((haystack_size - pos) >= 16)
+        {
+            const __m128i in = sse::load(haystack + pos);
+            __m128i found    = _mm_cmpeq_epi8(in, _mm_set1_epi8(bytes[0]));
+            for (usize i = 1; i < bytes_size; ++i)
+            {
+                found = _mm_or_si128(found, _mm_cmpeq_epi8(in, _mm_set1_epi8(bytes[i])));
+            }
+            const u32 mask = static_cast<u32>(_mm_movemask_epi8(found));
+            if (mask != 0)
+            {
+                return pos + static_cast<usize>(std::countr_zero(mask));
+            }
+            pos += 16;
+        }
+#endif
+
+        ignore_if_unused(haystack, haystack_size, bytes, bytes_size);
+        return pos;
+    }
+
+    // ### find_fingerprint
+
+    // Multiple substring search, "Teddy" (from the Hyperscan project): Each of the first
+    // `FingerprintSize` bytes at every position is classified by two nibble table lookups
+    // (`pshufb`), giving a bit per needle (bucket). A candidate position is one where a bucket bit
+    // survives for all fingerprint bytes. `is_match(position, buckets)` must compare candidates in
+    // full.
+
+    // Requires SSSE3.
+
+    template <usize FingerprintSize, typename IsMatch>
+    usize find_fingerprint(const char* const haystack, const usize haystack_size,
+                           const array<array<u8, 16>, FingerprintSize>& lo_nibble,
+                           const array<array<u8, 16>, FingerprintSize>& hi_nibble,
+                           IsMatch&& is_match)
+    {
+        static_assert(FingerprintSize >= 1 && FingerprintSize <= 3);
+
+        usize pos = 0;
+
+#if SNN_SSSE3_ENABLED
+        if (haystack_size < FingerprintSize)
+        {
+            return 0;
+        }
+
+        const usize last_offset = FingerprintSize - 1;
+
+    #if SNN_AVX2_ENABLED
+        {
+            // Wrapped, an `array<__m256i, ...>` would ignore the attributes of `__m256i`.
+            struct nibble_tables final
+            {
+                __m256i lo;
+                __m256i hi;
+            };
+
+            array<nibble_tables, FingerprintSize> tables;
+            for (usize i = 0; i < FingerprintSize; ++i)
+            {
+                nibble_tables& t = tables.at(i, assume::within_bounds);
+                t.lo             = _mm256_broadcastsi128_si256(
+                    sse::load(lo_nibble.at(i, assume::within_bounds)));
+                t.hi             = _mm256_broadcastsi128_si256(
+                    sse::load(hi_nibble.at(i, assume::within_bounds)));
+            }
+
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+            while ((haystack_size - last_offset - pos) >= 32)
+            {
+                __m256i buckets = _mm256_set1_epi8(-1);
+                for (usize i = 0; i < FingerprintSize; ++i)
+                {
+                    const __m256i in = avx::load(haystack + pos + i);
+                    const nibble_tables& t = tables.at(i, assume::within_bounds);
+                    const __m256i lo = _mm256_shuffle_epi8(t.lo, _mm256_and_si256(in, nibble_mask));
+                    const __m256i hi = _mm256_shuffle_epi8(
+                        t.hi, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask));
+                    buckets = _mm256_and_si256(buckets, _mm256_and_si256(lo, hi));
+                }
+
+                u32 mask = ~static_cast<u32>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(buckets, _mm256_setzero_si256())));
+                if (mask != 0)
+                {
+                    array<u8, 32> lanes;
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.begin()), buckets);
+                    while (mask != 0)
+                    {
+                        const auto lane = static_cast<usize>(std::countr_zero(mask));
+                        if (is_match(pos + lane, lanes.at(lane, bounds::mask)))
+                        {
+                            return pos + lane;
+                        }
+                        mask &= mask - 1; // Clear lowest set bit.
+                    }
+                }
+                pos += 32;
+            }
+        }
+    #endif
+
+        {
+            struct nibble_tables final
+            {
+                __m128i lo;
+                __m128i hi;
+            };
+
+            array<nibble_tables, FingerprintSize> tables;
+            for (usize i = 0; i < FingerprintSize; ++i)
+            {
+                nibble_tables& t = tables.at(i, assume::within_bounds);
+                t.lo             = sse::load(lo_nibble.at(i, assume::within_bounds));
+                t.hi             = sse::load(hi_nibble.at(i, assume::within_bounds));
+            }
+
+            const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+            while ((haystack_size - last_offset - pos) >= 16)
+            {
+                __m128i buckets = _mm_set1_epi8(-1);
+                for (usize i = 0; i < FingerprintSize; ++i)
+                {
+                    const __m128i in = sse::load(haystack + pos + i);
+                    const nibble_tables& t = tables.at(i, assume::within_bounds);
+                    const __m128i lo = _mm_shuffle_epi8(t.lo, _mm_and_si128(in, nibble_mask));
+                    const __m128i hi =
+                        _mm_shuffle_epi8(t.hi, _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask));
+                    buckets = _mm_and_si128(buckets, _mm_and_si128(lo, hi));
+                }
+
+                u32 mask = ~static_cast<u32>(
+                               _mm_movemask_epi8(_mm_cmpeq_epi8(buckets, _mm_setzero_si128()))) &
+                           0xffffu;
+                if (mask != 0)
+                {
+                    array<u8, 16> lanes;
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.begin()), buckets);
+                    while (mask != 0)
+                    {
+                        const auto lane = static_cast<usize>(std::countr_zero(mask));
+                        if (is_match(pos + lane, lanes.at(lane, bounds::mask)))
+                        {
+                            return pos + lane;
+                        }
+                        mask &= mask - 1; // Clear lowest set bit.
+                    }
+                }
+                pos += 16;
+            }
+        }
+#endif
+
+        ignore_if_unused(haystack, haystack_size, lo_nibble, hi_nibble, is_match);
+        return pos;
+    }
+
+    SNN_DIAGNOSTIC_POP
+}
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "snn-core/mem/raw/is_equal.hh"
+#include "snn-core/mem/raw/detail/simd.hh"
 
 namespace snn::mem::raw
 {
@@ -89,7 +90,16 @@ namespace snn::mem::raw
         auto* cur                = haystack_data.get();
         auto* const last         = cur + (haystack_size.get() - needle_size.get().get() + 1);
         snn_should(cur < last);
-        do
+
+        if (!std::is_constant_evaluated())
+        {
+            // No match before this position (SIMD, not dependent on the first byte being rare).
+            cur += detail::simd::find(reinterpret_cast<const char*>(cur), haystack_size.get(),
+                                      reinterpret_cast<const char*>(needle_data.get()),
+                                      needle_size.get().get());
+        }
+
+        while (cur < last)
         {
             cur = mem::raw::find(not_null{cur}, byte_size{to_usize(last - cur)}, needle_prefix);
             if (cur == nullptr)
@@ -103,7 +113,7 @@ namespace snn::mem::raw
             }
 
             ++cur;
-        } while (cur < last);
+        }
 
         SNN_DIAGNOSTIC_POP
 
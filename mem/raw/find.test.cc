@@ -153,6 +153,37 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_find_simd()
+        {
+            // Needles where the first byte is frequent, at every position.
+            const array<cstrview, 5> needles{"ab", "aab", "aaaaaaaaab", "b\xff\x80" "a",
+                                             "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"};
+            for (usize size = 0; size < 100; ++size)
+            {
+                const strbuf subject{init::fill, size, 'a'};
+                for (const cstrview needle : needles)
+                {
+                    snn_require(mem::raw::find(subject.data(), subject.byte_size(), needle.data(),
+                                               not_zero{needle.byte_size()}) == nullptr);
+
+                    for (usize pos = 0; (pos + needle.size()) <= size; ++pos)
+                    {
+                        strbuf haystack = subject;
+                        haystack.replace_at(pos, needle.size(), needle);
+
+                        auto* p = app::std_find(haystack.to<std::string_view>(),
+                                                needle.to<std::string_view>());
+                        snn_require(p != nullptr);
+                        snn_require(mem::raw::find(haystack.data(), haystack.byte_size(),
+                                                   needle.data(),
+                                                   not_zero{needle.byte_size()}) == p);
+                    }
+                }
+            }
+
+            return true;
+        }
     }
 }
 
@@ -163,5 +194,6 @@ namespace snn
         snn_static_require(app::example());
         snn_static_require(app::test_find());
         snn_require(app::test_find_rnd());
+        snn_require(app::test_find_simd());
     }
 }
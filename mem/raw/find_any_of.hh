@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Find any of a set of bytes (`strpbrk` without null termination)
+
+// Up to 16 bytes are searched for with SIMD (SSE2/AVX2), larger sets use a lookup table.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/mem/raw/find.hh"
+#include "snn-core/mem/raw/detail/simd.hh"
+
+namespace snn::mem::raw
+{
+    // ## Functions
+
+    // ### `find_any_of`
+
+    template <octet T, octet U>
+        requires same_as<const T, const U>
+    [[nodiscard]] constexpr T* find_any_of(const not_null<T*> haystack_data,
+                                           const byte_size<usize> haystack_size,
+                                           const not_null<U*> bytes_data,
+                                           const byte_size<usize> bytes_size) noexcept
+    {
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        T* const data    = haystack_data.get();
+        const usize size = haystack_size.get();
+        const U* bytes   = bytes_data.get();
+
+        if (bytes_size.get() == 1)
+        {
+            return mem::raw::find(haystack_data, haystack_size, bytes[0]);
+        }
+
+        usize pos = 0;
+        if (!std::is_constant_evaluated())
+        {
+            // No match before this position.
+            pos = detail::simd::find_any_of(reinterpret_cast<const char*>(data), size,
+                                            reinterpret_cast<const char*>(bytes),
+                                            bytes_size.get());
+        }
+
+        array<bool, 256> is_any_of{};
+        for (usize i = 0; i < bytes_size.get(); ++i)
+        {
+            is_any_of.at(static_cast<u8>(bytes[i]), assume::within_bounds) = true;
+        }
+
+        for (; pos < size; ++pos)
+        {
+            if (is_any_of.at(static_cast<u8>(data[pos]), assume::within_bounds))
+            {
+                return &data[pos];
+            }
+        }
+
+        SNN_DIAGNOSTIC_POP
+
+        return nullptr;
+    }
+}
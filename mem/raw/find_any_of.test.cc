@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/mem/raw/find_any_of.hh"
+
+#include "snn-core/array.hh"
+#include "snn-core/unittest.hh"
+#include "snn-core/random/number.hh"
+#include "snn-core/random/string.hh"
+#include <string_view>
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            const array<byte, 5> a{182, 0, 34, 182, 7};
+
+            const array<byte, 2> b{34, 7};
+            snn_require(mem::raw::find_any_of(a.data(), a.byte_size(), b.data(), b.byte_size()) ==
+                        &a.get<2>());
+
+            const array<byte, 3> c{1, 2, 3};
+            snn_require(mem::raw::find_any_of(a.data(), a.byte_size(), c.data(), c.byte_size()) ==
+                        nullptr);
+
+            return true;
+        }
+
+        constexpr bool test_find_any_of()
+        {
+            array<char, 5> a{'a', '\0', to_char(174), '\n', '\0'};
+
+            const array<char, 1> nl{'\n'};
+            snn_require(mem::raw::find_any_of(a.writable(), a.byte_size(), nl.data(),
+                                              nl.byte_size()) == &a.get<3>());
+
+            const array<char, 2> nul{'\n', '\0'};
+            snn_require(mem::raw::find_any_of(a.data(), a.byte_size(), nul.data(),
+                                              nul.byte_size()) == &a.get<1>());
+
+            // Empty set.
+            snn_require(mem::raw::find_any_of(a.data(), a.byte_size(), nul.data(),
+                                              byte_size<usize>{0}) == nullptr);
+
+            return true;
+        }
+
+        bool test_find_any_of_simd()
+        {
+            // Each byte at every position, with small (SIMD) and large (lookup table) sets.
+            for (usize size = 1; size < 70; ++size)
+            {
+                for (usize pos = 0; pos < size; ++pos)
+                {
+                    strbuf haystack{init::fill, size, 'a'};
+                    for (const char c : {'b', '\0', to_char(0xff), to_char(0x80)})
+                    {
+                        haystack.at(pos, assume::within_bounds) = c;
+
+                        const cstrview small{"xyz\xff\x80\0b", 7};
+                        const cstrview large{"\x80\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b"
+                                             "\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17"
+                                             "\xff\0b",
+                                             27};
+                        for (const cstrview set : {small, large})
+                        {
+                            const char* p = mem::raw::find_any_of(
+                                haystack.data(), haystack.byte_size(), set.data(), set.byte_size());
+                            snn_require(p == &haystack.at(pos, assume::within_bounds));
+                        }
+                    }
+                }
+            }
+
+            // Random.
+            for (loop::count lc{100}; lc--;)
+            {
+                const auto haystack = random::string(random::number<usize>(0, 1'000));
+                const auto set      = random::string(random::number<usize>(1, 20));
+
+                const std::string_view alt_haystack{haystack.data().get(), haystack.size()};
+                const usize pos = alt_haystack.find_first_of(set.to<std::string_view>());
+                const char* p   = mem::raw::find_any_of(haystack.data(), haystack.byte_size(),
+                                                        set.data(), set.byte_size());
+                if (pos == std::string_view::npos)
+                {
+                    snn_require(p == nullptr);
+                }
+                else
+                {
+                    snn_require(p == &haystack.at(pos, assume::within_bounds));
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_find_any_of());
+        snn_require(app::test_find_any_of_simd());
+    }
+}
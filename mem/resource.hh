@@ -0,0 +1,103 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Memory resource concept
+
+// A memory resource hands out untyped memory and is owned by the caller (it has state, unlike
+// `allocator<T>`). Containers reference a resource through `resource_allocator<T, Resource>`.
+
+// Implementations:
+// * `malloc_resource` (this file): `malloc`/`realloc`/`free`.
+// * [arena.hh](arena.hh): Monotonic arena, deallocation only releases the most recent allocation.
+// * [pool\_resource.hh](pool_resource.hh): Size-class pool with per-class free lists.
+// * [numa\_resource.hh](numa_resource.hh): Page-granular memory bound to a NUMA node.
+
+// Resources are not thread-safe, use one per thread (or per request) to avoid contention.
+
+#pragma once
+
+#include "snn-core/mem/allocator.hh"
+#include <cstddef> // max_align_t
+#include <cstdlib> // free, malloc, realloc
+
+namespace snn::mem
+{
+    // ## Concepts
+
+    // ### resource
+
+    // * `allocate(size, alignment)`: Alignment must be a power of two and not greater than
+    //   `max_alignment`.
+    // * `deallocate(ptr, size, alignment)`: Does nothing if `ptr` is null, `size` and `alignment`
+    //   must be the same as when allocated.
+    // * `reallocate(ptr, old_size, new_size, use_size, alignment)`: The first `use_size` bytes are
+    //   preserved. If this fails the old memory is left as is.
+
+    template <typename R>
+    concept resource = requires(R& r, void* ptr, usize n, not_zero<usize> size) {
+        { R::max_alignment } -> same_as<const usize&>;
+        { r.allocate(size, n) } -> same_as<optional_allocation<void*>>;
+        { r.reallocate(ptr, n, size, n, n) } -> same_as<optional_allocation<void*>>;
+        r.deallocate(ptr, n, n);
+    };
+
+    // ## Classes
+
+    // ### malloc_resource
+
+    class malloc_resource final
+    {
+      public:
+        // #### Constants
+
+        static constexpr usize max_alignment = alignof(std::max_align_t);
+
+        // #### Allocation/Deallocation
+
+        [[nodiscard]] optional_allocation<void*> allocate(
+            const not_zero<usize> size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(alignment > 0 && alignment <= max_alignment);
+            ignore_if_unused(alignment);
+            if (size.get() > constant::limit<isize>::max) [[unlikely]]
+            {
+                // No object can be this large.
+                return optional_allocation<void*>{nullptr};
+            }
+            return optional_allocation<void*>{std::malloc(size.get())};
+        }
+
+        void deallocate(void* const ptr, const usize size,
+                        const usize alignment = max_alignment) noexcept
+        {
+            ignore_if_unused(size);
+            ignore_if_unused(alignment);
+            std::free(ptr);
+        }
+
+        [[nodiscard]] optional_allocation<void*> reallocate(
+            void* const ptr, const usize old_size, const not_zero<usize> new_size,
+            const usize use_size, const usize alignment = max_alignment) noexcept
+        {
+            snn_should(ptr != nullptr || (old_size == 0 && use_size == 0));
+            snn_should(use_size <= old_size);
+            ignore_if_unused(old_size);
+            ignore_if_unused(use_size);
+            ignore_if_unused(alignment);
+            if (new_size.get() > constant::limit<isize>::max) [[unlikely]]
+            {
+                return optional_allocation<void*>{nullptr};
+            }
+            return optional_allocation<void*>{std::realloc(ptr, new_size.get())};
+        }
+
+        // #### Shared instance
+
+        // Stateless, a single instance can be shared by all threads.
+        [[nodiscard]] static malloc_resource& instance() noexcept
+        {
+            static malloc_resource r;
+            return r;
+        }
+    };
+}
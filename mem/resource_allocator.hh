@@ -0,0 +1,166 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Allocator with state referencing a memory resource
+
+// Allocates from a `mem::resource` (see [resource.hh](resource.hh)) owned by the caller, the
+// resource must outlive all memory allocated from it. Copies reference the same resource.
+
+// Trivially relocatable types are reallocated with the resource's `reallocate()`, which can grow
+// in place (e.g. the most recent allocation in an arena).
+
+#pragma once
+
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/mem/destruct_n.hh"
+#include "snn-core/mem/move_construct.hh"
+#include "snn-core/mem/relocate.hh"
+#include "snn-core/mem/resource.hh"
+
+namespace snn::mem
+{
+    // ## Classes
+
+    // ### resource_allocator
+
+    template <typename T, resource Resource>
+    class resource_allocator final
+    {
+      public:
+        static_assert(!std::is_array_v<T>, "Array type is currently not supported.");
+        static_assert(alignof(T) <= Resource::max_alignment);
+
+        // #### Types
+
+        using resource_type = Resource;
+
+        // #### Constants
+
+        static constexpr usize max_count = constant::limit<usize>::max / sizeof(T);
+
+        // #### Explicit constructors
+
+        constexpr explicit resource_allocator(Resource& r) noexcept
+            : resource_{&r}
+        {
+        }
+
+        // #### Converting constructors
+
+        // Rebind to another type (same resource).
+        template <typename U>
+        constexpr resource_allocator(const resource_allocator<U, Resource>& other) noexcept
+            : resource_{&other.get_resource()}
+        {
+        }
+
+        // #### Resource
+
+        [[nodiscard]] constexpr Resource& get_resource() const noexcept
+        {
+            return *resource_;
+        }
+
+        // #### Allocation/Deallocation
+
+        [[nodiscard]] optional_allocation<T*> allocate(const not_zero<usize> count) noexcept
+        {
+            if (count.get() > max_count) [[unlikely]]
+            {
+                return optional_allocation<T*>{nullptr};
+            }
+
+            auto opt = resource_->allocate(not_zero{count.get() * sizeof(T)}, alignof(T));
+            return optional_allocation{static_cast<T*>(opt.value_or_nullptr())};
+        }
+
+        // Does nothing if `ptr` is null.
+
+        void deallocate(T* const ptr, const usize initial_count) noexcept
+        {
+            snn_should(ptr != nullptr || initial_count == 0);
+            if (ptr != nullptr)
+            {
+                resource_->deallocate(ptr, initial_count * sizeof(T), alignof(T));
+            }
+        }
+
+        // If this fails the old memory is not deallocated.
+
+        [[nodiscard]] optional_allocation<T*> reallocate(T* const old_ptr,
+                                                         const usize initial_count,
+                                                         const not_zero<usize> new_count,
+                                                         const usize use_count) noexcept
+        {
+            snn_should(old_ptr != nullptr || (initial_count == 0 && use_count == 0));
+            snn_should(use_count <= initial_count);
+
+            if (new_count.get() > max_count) [[unlikely]]
+            {
+                return optional_allocation<T*>{nullptr};
+            }
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            // Optimal path.
+
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                // Trivially copyable (no destructor), new allocation or no destruction needed?
+                if (std::is_trivially_copyable_v<T> || old_ptr == nullptr ||
+                    new_count.get() >= use_count) [[likely]]
+                {
+                    const usize use_size = math::min(new_count.get(), use_count) * sizeof(T);
+                    auto opt = resource_->reallocate(old_ptr, initial_count * sizeof(T),
+                                                     not_zero{new_count.get() * sizeof(T)},
+                                                     use_size, alignof(T));
+                    return optional_allocation{static_cast<T*>(opt.value_or_nullptr())};
+                }
+
+                T* const new_ptr = allocate(new_count).value_or_nullptr();
+                if (new_ptr != nullptr)
+                {
+                    const usize relocate_count = new_count.get();
+                    const usize destruct_count = use_count - relocate_count;
+
+                    mem::relocate(not_null{old_ptr}, not_null{old_ptr + relocate_count},
+                                  not_null{new_ptr});
+                    mem::destruct_n(old_ptr + relocate_count, destruct_count);
+
+                    deallocate(old_ptr, initial_count);
+                }
+                return optional_allocation{new_ptr};
+            }
+
+            // General path.
+
+            T* const new_ptr = allocate(new_count).value_or_nullptr();
+            if (new_ptr != nullptr && old_ptr != nullptr)
+            {
+                const usize move_count = math::min(new_count.get(), use_count);
+
+                mem::move_construct(not_null{old_ptr}, not_null{old_ptr + move_count},
+                                    not_null{new_ptr}, assume::no_overlap);
+                mem::destruct_n(old_ptr, use_count);
+
+                deallocate(old_ptr, initial_count);
+            }
+            return optional_allocation{new_ptr};
+
+            SNN_DIAGNOSTIC_POP
+        }
+
+        // #### Comparison
+
+        // Memory allocated by one allocator can be deallocated by the other.
+        [[nodiscard]] constexpr bool operator==(const resource_allocator& other) const noexcept
+        {
+            return resource_ == other.resource_;
+        }
+
+      private:
+        Resource* resource_;
+    };
+}
@@ -0,0 +1,208 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/mem/resource_allocator.hh"
+
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/mem/arena.hh"
+#include "snn-core/mem/construct.hh"
+#include "snn-core/mem/pool_resource.hh"
+#include "snn-core/pool/append_only.hh"
+#include "snn-core/pool/fixed.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // A per-request arena, everything is released at once when it goes out of scope.
+            mem::arena arena;
+
+            using allocator = mem::resource_allocator<int, mem::arena>;
+
+            vec<int, 0, allocator> v{allocator{arena}};
+            v << 1 << 2 << 3;
+            snn_require(v.count() == 3);
+            snn_require(&v.allocator().get_resource() == &arena);
+            snn_require(arena.block_count() == 1);
+
+            // Copies allocate from the same arena.
+            vec<int, 0, allocator> copy{v};
+            snn_require(copy == v);
+            snn_require(copy.allocator() == v.allocator());
+
+            return true;
+        }
+
+        bool test_resource_allocator()
+        {
+            static_assert(mem::resource<mem::malloc_resource>);
+            static_assert(mem::resource<mem::arena>);
+            static_assert(mem::resource<mem::pool_resource<>>);
+
+            // Stateful allocators are trivially relocatable (a single pointer).
+            static_assert(sizeof(mem::resource_allocator<str, mem::arena>) == sizeof(void*));
+            static_assert(is_trivially_relocatable_v<mem::resource_allocator<str, mem::arena>>);
+            static_assert(
+                is_trivially_relocatable_v<vec<str, 0, mem::resource_allocator<str, mem::arena>>>);
+
+            // Stateless allocators take no space.
+            static_assert(sizeof(vec<int>) == (sizeof(void*) * 3));
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            {
+                mem::pool_resource<> pool;
+                mem::resource_allocator<str, mem::pool_resource<>> alloc{pool};
+
+                // Trivially relocatable, but not trivially copyable.
+                static_assert(is_trivially_relocatable_v<str>);
+                static_assert(!std::is_trivially_copyable_v<str>);
+
+                str* ptr = alloc.allocate(not_zero<usize>{3}).value();
+                mem::construct(not_null{&ptr[0]}, "One");
+                mem::construct(not_null{&ptr[1]}, "A longer string that goes on the heap.");
+                mem::construct(not_null{&ptr[2]}, "Three");
+
+                // Grow (relocated by the resource).
+                ptr = alloc.reallocate(ptr, 3, not_zero<usize>{10}, 3).value();
+                snn_require(ptr[0] == "One");
+                snn_require(ptr[1] == "A longer string that goes on the heap.");
+                snn_require(ptr[2] == "Three");
+
+                // Shrink (the last element is destructed).
+                ptr = alloc.reallocate(ptr, 10, not_zero<usize>{2}, 3).value();
+                snn_require(ptr[0] == "One");
+                snn_require(ptr[1] == "A longer string that goes on the heap.");
+
+                mem::destruct_n(ptr, 2);
+                alloc.deallocate(ptr, 2);
+
+                // Does nothing.
+                alloc.deallocate(nullptr, 0);
+
+                snn_require(!alloc.allocate(not_zero{constant::limit<usize>::max}));
+            }
+            {
+                // Grow in place (most recent allocation in the arena).
+                mem::arena arena;
+                mem::resource_allocator<int, mem::arena> alloc{arena};
+
+                int* ptr = alloc.allocate(not_zero<usize>{2}).value();
+                ptr[0]   = 123;
+                ptr[1]   = 456;
+
+                int* ptr2 = alloc.reallocate(ptr, 2, not_zero<usize>{100}, 2).value();
+                snn_require(ptr2 == ptr);
+                snn_require(ptr2[0] == 123);
+                snn_require(ptr2[1] == 456);
+
+                // The most recent allocation is released (and reused).
+                alloc.deallocate(ptr2, 100);
+                snn_require(alloc.allocate(not_zero<usize>{1}).value() == ptr);
+
+                // Rebind.
+                mem::resource_allocator<char, mem::arena> char_alloc{alloc};
+                snn_require(&char_alloc.get_resource() == &arena);
+            }
+
+            SNN_DIAGNOSTIC_POP
+
+            return true;
+        }
+
+        bool test_containers()
+        {
+            // Resources must outlive the containers.
+            mem::pool_resource<> pool;
+            mem::pool_resource<> other_pool;
+
+            {
+                using allocator = mem::resource_allocator<str, mem::pool_resource<>>;
+
+                vec<str, 0, allocator> a{allocator{pool}};
+                for (usize i = 0; i < 100; ++i)
+                {
+                    a.append("A longer string that goes on the heap.");
+                }
+                snn_require(a.count() == 100);
+                snn_require(pool.chunk_count() == 1);
+
+                // Move/swap exchange allocators.
+                vec<str, 0, allocator> b{std::move(a)};
+                snn_require(b.count() == 100);
+                snn_require(a.is_empty());
+                snn_require(&b.allocator().get_resource() == &pool);
+
+                vec<str, 0, allocator> c{init::reserve, 10, allocator{other_pool}};
+                c.append("abc");
+                c.swap(b);
+                snn_require(c.count() == 100);
+                snn_require(b.count() == 1);
+                snn_require(&c.allocator().get_resource() == &pool);
+                snn_require(&b.allocator().get_resource() == &other_pool);
+
+                // Copy assignment keeps the allocator.
+                b = c;
+                snn_require(b.count() == 100);
+                snn_require(&b.allocator().get_resource() == &other_pool);
+
+                // Small capacity.
+                vec<str, 2, allocator> d{allocator{pool}};
+                d.append("One");
+                d.append("Two");
+                snn_require(d.capacity() == 2);
+                d.append("Three");
+                d.append_inplace("Four");
+                snn_require(d.capacity() > 2);
+                snn_require(d.count() == 4);
+                snn_require(d.at(3, assume::within_bounds) == "Four");
+
+                vec<str, 2, allocator> e{std::move(d)};
+                snn_require(e.count() == 4);
+                snn_require(&e.allocator().get_resource() == &pool);
+            }
+            {
+                using allocator = mem::resource_allocator<int, mem::pool_resource<>>;
+
+                pool::fixed<int, allocator> p{not_zero<usize>{10}, allocator{pool}};
+                p.append(123);
+                p.append(456);
+                snn_require(p.count() == 2);
+                snn_require(&p.allocator().get_resource() == &pool);
+
+                pool::fixed<int, allocator> moved{std::move(p)};
+                snn_require(moved.count() == 2);
+                snn_require(moved.at(1, assume::within_bounds) == 456);
+            }
+            {
+                using allocator = mem::resource_allocator<str, mem::pool_resource<>>;
+
+                pool::append_only<str, allocator> p{allocator{pool}, 3};
+                for (usize i = 0; i < 10; ++i)
+                {
+                    p.append_inplace("A longer string that goes on the heap.");
+                }
+                snn_require(p.count() == 10);
+                snn_require(p.back(assume::not_empty) == "A longer string that goes on the heap.");
+                snn_require(&p.allocator().get_resource() == &pool);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_resource_allocator());
+        snn_require(app::test_containers());
+    }
+}
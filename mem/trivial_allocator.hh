@@ -7,8 +7,8 @@
 
 #include "snn-core/math/common.hh"
 #include "snn-core/mem/allocator.hh"
-#include <cstdlib> // free, malloc, realloc
-#include <new>     // nothrow
+#include "snn-core/mem/detail/allocation.hh"
+#include <new> // nothrow
 
 namespace snn::mem
 {
@@ -23,13 +23,15 @@ namespace snn::mem
     // `mem::destruct*` on the allocated memory, simply use `mem::raw::copy` or `mem::raw::move`.
 
     // When not constant evaluated there is no difference between `allocator<T>` and
-    // `trivial_allocator<T>`.
+    // `trivial_allocator<T>` (including over-aligned types and the large `mmap`/`mremap` path).
 
     template <typename T>
         requires(std::is_trivially_copyable_v<T> && std::is_nothrow_default_constructible_v<T>)
     class trivial_allocator final
     {
       public:
+        static_assert(alignof(T) <= detail::allocation::max_alignment);
+
         // #### Constants
 
         static constexpr usize max_count = constant::limit<usize>::max / sizeof(T);
@@ -51,16 +53,15 @@ namespace snn::mem
             }
             else
             {
-                void* const ptr = std::malloc(count.get() * sizeof(T));
+                void* const ptr = detail::allocation::allocate(count.get() * sizeof(T), alignof(T));
                 return optional_allocation{static_cast<T*>(ptr)};
             }
         }
 
-        // Does nothing if `ptr` is null.
+        // Does nothing if `ptr` is null. The count must be the allocated count.
         constexpr void deallocate(T* const ptr, const usize initial_count) noexcept
         {
             snn_should(ptr != nullptr || initial_count == 0);
-            ignore_if_unused(initial_count);
 
             if (std::is_constant_evaluated())
             {
@@ -68,7 +69,7 @@ namespace snn::mem
             }
             else
             {
-                std::free(ptr);
+                detail::allocation::deallocate(ptr, initial_count * sizeof(T));
             }
         }
 
@@ -80,7 +81,6 @@ namespace snn::mem
         {
             snn_should(old_ptr != nullptr || (initial_count == 0 && use_count == 0));
             snn_should(use_count <= initial_count);
-            ignore_if_unused(initial_count);
 
             if (new_count.get() > max_count) [[unlikely]]
             {
@@ -109,7 +109,9 @@ namespace snn::mem
             }
             else
             {
-                void* const new_ptr = std::realloc(old_ptr, new_count.get() * sizeof(T));
+                void* const new_ptr = detail::allocation::reallocate(
+                    old_ptr, initial_count * sizeof(T), new_count.get() * sizeof(T),
+                    math::min(use_count, new_count.get()) * sizeof(T), alignof(T));
                 return optional_allocation{static_cast<T*>(new_ptr)};
             }
         }
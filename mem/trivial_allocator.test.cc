@@ -3,6 +3,7 @@
 
 #include "snn-core/mem/trivial_allocator.hh"
 
+#include "snn-core/strcore.hh"
 #include "snn-core/unittest.hh"
 
 namespace snn::app
@@ -129,6 +130,40 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_large()
+        {
+            constexpr usize size = mem::detail::allocation::large_threshold;
+
+            mem::trivial_allocator<char> alloc;
+
+            char* ptr = alloc.allocate(not_zero{size}).value();
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            ptr[0]        = 'a';
+            ptr[size - 1] = 'b';
+
+            ptr = alloc.reallocate(ptr, size, not_zero{size * 2}, size).value();
+            snn_require(ptr[0] == 'a');
+            snn_require(ptr[size - 1] == 'b');
+
+            SNN_DIAGNOSTIC_POP
+
+            alloc.deallocate(ptr, size * 2);
+
+            // A large string.
+            str s;
+            for (usize i = 0; i < 1000; ++i)
+            {
+                s.append_for_overwrite(100'000).fill('x');
+            }
+            snn_require(s.size() == 100'000'000);
+            snn_require(s.count('x') == 100'000'000);
+
+            return true;
+        }
     }
 }
 
@@ -137,5 +172,6 @@ namespace snn
     void unittest()
     {
         snn_static_require(app::test_trivial_allocator());
+        snn_require(app::test_large());
     }
 }
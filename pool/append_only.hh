@@ -8,6 +8,8 @@
 // Elements can only be added, not removed.
 // Can hold non-movable types.
 // Sacrifices size (of the pool object itself) for simplicity and performance.
+// Optional allocator with state for the blocks, e.g. `mem::resource_allocator<T, mem::arena>`
+// (the small list of block pointers is allocated with `mem::allocator`).
 
 #pragma once
 
@@ -24,11 +26,15 @@ namespace snn::pool
 
     // ### append_only
 
-    template <typename T>
+    template <typename T, typename Alloc = mem::allocator<T>>
         requires(std::is_same_v<std::remove_cvref_t<T>, T>)
     class append_only final
     {
       public:
+        // #### Types
+
+        using allocator_type = Alloc;
+
         // #### Constants
 
         static constexpr usize max_elements_per_block = constant::limit<iptrdiff>::max / sizeof(T);
@@ -42,6 +48,15 @@ namespace snn::pool
             snn_should(elements_per_block_.get() >= min_elements_per_block.get());
         }
 
+        constexpr explicit append_only(const Alloc& alloc,
+                                       const num::bounded<usize, 1, max_elements_per_block>
+                                           min_elements_per_block = 100) noexcept
+            : elements_per_block_{optimal_elements_per_block_(min_elements_per_block.not_zero())},
+              alloc_{alloc}
+        {
+            snn_should(elements_per_block_.get() >= min_elements_per_block.get());
+        }
+
         // #### Copy-constructor/assignment operator
 
         append_only(const append_only&)            = delete;
@@ -55,7 +70,8 @@ namespace snn::pool
               end_{std::exchange(other.end_, nullptr)},
               back_{std::exchange(other.back_, nullptr)},
               count_{std::exchange(other.count_, 0)},
-              elements_per_block_{other.elements_per_block_}
+              elements_per_block_{other.elements_per_block_},
+              alloc_{other.alloc_}
         {
         }
 
@@ -104,6 +120,13 @@ namespace snn::pool
             return *p;
         }
 
+        // #### Allocator
+
+        [[nodiscard]] constexpr const Alloc& allocator() const noexcept
+        {
+            return alloc_;
+        }
+
         // #### Single element access
 
         [[nodiscard]] constexpr T& back(assume::not_empty_t) noexcept
@@ -143,6 +166,7 @@ namespace snn::pool
             std::swap(back_, other.back_);
             std::swap(count_, other.count_);
             std::swap(elements_per_block_, other.elements_per_block_);
+            std::swap(alloc_, other.alloc_);
         }
 
 #if SNN_SHOULD_ENABLED
@@ -159,19 +183,18 @@ namespace snn::pool
         T* back_{nullptr};
         usize count_{0};
         not_zero<usize> elements_per_block_;
+        [[no_unique_address]] Alloc alloc_;
 
         SNN_DIAGNOSTIC_PUSH
         SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
 
         constexpr void destruct_deallocate_() noexcept
         {
-            mem::allocator<T> alloc;
-
             if (!std::is_constant_evaluated() && std::is_trivially_destructible_v<T>)
             {
                 for (T* block : blocks_)
                 {
-                    alloc.deallocate(block, elements_per_block_.get());
+                    alloc_.deallocate(block, elements_per_block_.get());
                 }
             }
             else if (next_ != nullptr)
@@ -189,7 +212,7 @@ namespace snn::pool
                         mem::destruct(not_null{next_}); // Call element destructor.
                     }
                     snn_should(next_ == block);
-                    alloc.deallocate(block, elements_per_block_.get());
+                    alloc_.deallocate(block, elements_per_block_.get());
                 }
 
                 // Remaining blocks.
@@ -203,7 +226,7 @@ namespace snn::pool
                         mem::destruct(not_null{next_}); // Call element destructor.
                     } while (next_ > block);
                     snn_should(next_ == block);
-                    alloc.deallocate(block, elements_per_block_.get());
+                    alloc_.deallocate(block, elements_per_block_.get());
                 }
             }
         }
@@ -212,8 +235,7 @@ namespace snn::pool
         {
             blocks_.reserve_append(1);
 
-            mem::allocator<T> alloc;
-            T* block = alloc.allocate(elements_per_block_).value();
+            T* block = alloc_.allocate(elements_per_block_).value();
 
             blocks_.append(block); // Will never throw since we reserved beforehand.
             next_ = block;
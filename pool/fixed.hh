@@ -7,6 +7,7 @@
 // The capacity is set when the pool is constructed and can not be changed after that.
 // Can hold non-movable types.
 // Contiguous storage.
+// Optional allocator with state, e.g. `mem::resource_allocator<T, mem::pool_resource<>>`.
 
 #pragma once
 
@@ -23,7 +24,7 @@ namespace snn::pool
 
     // ### fixed
 
-    template <typename T>
+    template <typename T, typename Alloc = mem::allocator<T>>
     class fixed final
     {
       public:
@@ -32,13 +33,21 @@ namespace snn::pool
         using iterator       = T*;
         using const_iterator = const T*;
 
+        using allocator_type = Alloc;
+
         // #### Explicit constructors
 
         constexpr explicit fixed(const not_zero<usize> capacity)
             : capacity_{capacity.get()}
         {
-            mem::allocator<T> alloc;
-            data_ = alloc.allocate(capacity).value();
+            data_ = alloc_.allocate(capacity).value();
+        }
+
+        constexpr explicit fixed(const not_zero<usize> capacity, const Alloc& alloc)
+            : capacity_{capacity.get()},
+              alloc_{alloc}
+        {
+            data_ = alloc_.allocate(capacity).value();
         }
 
         // #### Copy constructor/copy assignment operator
@@ -51,7 +60,8 @@ namespace snn::pool
         constexpr fixed(fixed&& other) noexcept
             : data_{std::exchange(other.data_, nullptr)},
               count_{std::exchange(other.count_, 0)},
-              capacity_{std::exchange(other.capacity_, 0)}
+              capacity_{std::exchange(other.capacity_, 0)},
+              alloc_{other.alloc_}
         {
         }
 
@@ -67,8 +77,7 @@ namespace snn::pool
         {
             mem::destruct_n(data_, count_);
 
-            mem::allocator<T> alloc;
-            alloc.deallocate(data_, capacity_); // Does nothing if nullptr (moved from).
+            alloc_.deallocate(data_, capacity_); // Does nothing if nullptr (moved from).
         }
 
         // #### Explicit conversion operators
@@ -78,6 +87,13 @@ namespace snn::pool
             return !is_empty();
         }
 
+        // #### Allocator
+
+        [[nodiscard]] constexpr const Alloc& allocator() const noexcept
+        {
+            return alloc_;
+        }
+
         // #### Count
 
         [[nodiscard]] constexpr usize count() const noexcept
@@ -216,12 +232,14 @@ namespace snn::pool
             std::swap(data_, other.data_);
             std::swap(count_, other.count_);
             std::swap(capacity_, other.capacity_);
+            std::swap(alloc_, other.alloc_);
         }
 
       private:
         T* data_{nullptr};
         usize count_{0};
         usize capacity_;
+        [[no_unique_address]] Alloc alloc_;
 
         SNN_DIAGNOSTIC_PUSH
         SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
@@ -18,4 +18,12 @@ namespace snn::random
         const auto i = random::number<u32>();
         return static_cast<bool>(i & 1u);
     }
+
+    // With a (non-cryptographic) engine.
+
+    template <random::engine Engine>
+    [[nodiscard]] constexpr bool boolean(Engine& engine)
+    {
+        return static_cast<bool>(engine.next() >> 63);
+    }
 }
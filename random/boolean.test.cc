@@ -4,6 +4,7 @@
 #include "snn-core/random/boolean.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -27,6 +28,22 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_boolean_with_engine()
+        {
+            random::wyrand rng{1};
+            usize true_count = 0;
+            for (usize i = 0; i < 1000; ++i)
+            {
+                if (random::boolean(rng))
+                {
+                    ++true_count;
+                }
+            }
+            snn_require(true_count > 400 && true_count < 600);
+
+            return true;
+        }
     }
 }
 
@@ -35,5 +52,6 @@ namespace snn
     void unittest()
     {
         snn_require(app::example());
+        snn_static_require(app::test_boolean_with_engine());
     }
 }
@@ -3,27 +3,142 @@
 
 #pragma once
 
+#include "snn-core/array.hh"
 #include "snn-core/array_view.hh"
-#include <stdlib.h> // arc4random, arc4random_buf
+#include "snn-core/mem/raw/copy.hh"
+#include "snn-core/mem/raw/zero.hh"
+#include <pthread.h> // pthread_atfork
+#include <stdlib.h>  // arc4random_buf
 
 // arc4random(3) never fails and uses ChaCha20 as of FreeBSD 12.
 
+// Small requests (e.g. `random::number<u32>()`) are served from a per-thread buffer that is
+// refilled with a single `arc4random_buf()` call. Served bytes are wiped from the buffer and the
+// buffer of the forking thread is discarded in the child after `fork()`, so a child process never
+// repeats random data from its parent. Large requests bypass the buffer.
+
 namespace snn::random::detail
 {
     struct source final
     {
+        static constexpr usize buffer_size = 1024;
+
+        // Requests of this size or larger bypass the buffer.
+        static constexpr usize direct_size = 256;
+
         template <octet Octet, usize Count>
         static void fill(array_view<Octet, Count> buffer)
         {
             if (buffer)
             {
-                ::arc4random_buf(buffer.begin(), buffer.size());
+                if (buffer.size() < direct_size)
+                {
+                    take_(buffer.begin(), buffer.size());
+                }
+                else
+                {
+                    ::arc4random_buf(buffer.begin(), buffer.size());
+                }
             }
         }
 
         static u32 number()
         {
-            return ::arc4random();
+            u32 n = 0;
+            fill(as_bytes(as_ref(n)));
+            return n;
+        }
+
+        // Wipe and discard the buffer of the current thread.
+        static void discard() noexcept
+        {
+            buffer_().discard();
+        }
+
+        // Number of buffered bytes available to the current thread (for testing).
+        [[nodiscard]] static usize buffered_size() noexcept
+        {
+            return buffer_().available();
+        }
+
+      private:
+        class buffer final
+        {
+          public:
+            buffer() noexcept
+            {
+                // Registered once (by the first thread to use a buffer).
+                [[maybe_unused]] static const int registered =
+                    ::pthread_atfork(nullptr, nullptr, &discard_in_child_);
+            }
+
+            buffer(const buffer&)            = delete;
+            buffer& operator=(const buffer&) = delete;
+            buffer(buffer&&)                 = delete;
+            buffer& operator=(buffer&&)      = delete;
+
+            ~buffer()
+            {
+                discard();
+            }
+
+            [[nodiscard]] usize available() const noexcept
+            {
+                return buffer_size - pos_;
+            }
+
+            void discard() noexcept
+            {
+                mem::raw::zero(data_);
+                pos_ = buffer_size;
+            }
+
+            template <typename Octet>
+            void take(Octet* const destination, const usize size) noexcept
+            {
+                snn_should(size > 0 && size < buffer_size);
+
+                if (size > available())
+                {
+                    // Overwrites (wipes) any remaining bytes.
+                    ::arc4random_buf(data_.begin(), buffer_size);
+                    pos_ = 0;
+                }
+
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+                byte* const first = data_.begin() + pos_;
+
+                SNN_DIAGNOSTIC_POP
+
+                mem::raw::copy(not_null<const byte*>{first}, not_null{destination},
+                               byte_size{size}, assume::no_overlap);
+                mem::raw::zero(not_null{first}, byte_size{size});
+                pos_ += size;
+            }
+
+          private:
+            array<byte, buffer_size> data_;
+            usize pos_{buffer_size};
+
+            static void discard_in_child_() noexcept
+            {
+                // Only the thread that called `fork()` exists in the child.
+                buffer_().discard();
+            }
+        };
+
+        static buffer& buffer_() noexcept
+        {
+            static thread_local buffer b;
+            return b;
+        }
+
+        template <typename Octet>
+        static void take_(Octet* const destination, const usize size) noexcept
+        {
+            buffer_().take(destination, size);
         }
     };
 }
@@ -0,0 +1,26 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "snn-core/core.hh"
+
+namespace snn::random::detail
+{
+    // SplitMix64, used to expand a single 64-bit seed into a larger engine state.
+    // https://prng.di.unimi.it/splitmix64.c
+
+    // clang-format off
+
+    [[nodiscard]] __attribute__((__no_sanitize__("unsigned-integer-overflow")))
+    constexpr u64 splitmix64(u64& state) noexcept
+    {
+        state += 0x9e3779b97f4a7c15;
+        u64 z = state;
+        z     = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z     = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    // clang-format on
+}
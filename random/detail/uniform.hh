@@ -11,7 +11,7 @@ namespace snn::random::detail
     // that is each number in the range has equal probably.
 
     template <unsigned_integral Uint, typename Generator>
-    Uint uniform(const Uint upper_bound, Generator generator)
+    constexpr Uint uniform(const Uint upper_bound, Generator generator)
     {
         static_assert(std::is_same_v<decltype(generator()), Uint>);
 
@@ -29,4 +29,22 @@ namespace snn::random
 
     template <typename Container>
     void element(const Container&&) = delete;
+
+    // With a (non-cryptographic) engine.
+
+    template <typename Container, random::engine Engine>
+    [[nodiscard]] constexpr auto element(Container& container, Engine& engine) //
+        -> optional<decltype(container.at(usize{}, assume::within_bounds))>
+    {
+        const auto random_index = random::number<usize>(0, container.count(), engine);
+        if (random_index < container.count())
+        {
+            return container.at(random_index, assume::within_bounds);
+        }
+        snn_should(container.count() == 0);
+        return nullopt;
+    }
+
+    template <typename Container, random::engine Engine>
+    void element(const Container&&, Engine&) = delete;
 }
@@ -4,6 +4,7 @@
 #include "snn-core/random/element.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/random/wyrand.hh"
 
 namespace snn::app
 {
@@ -20,6 +21,28 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_element_with_engine()
+        {
+            random::wyrand rng{5};
+
+            str s{"abc"};
+            while (s != "...")
+            {
+                char& c = random::element(s, rng).value();
+                c       = '.';
+            }
+
+            str empty;
+            snn_require(!random::element(empty, rng));
+
+            const str one{"a"};
+            decltype(auto) opt = random::element(one, rng);
+            static_assert(std::is_same_v<decltype(opt), optional<const char&>>);
+            snn_require(opt.value() == 'a');
+
+            return true;
+        }
     }
 }
 
@@ -28,6 +51,7 @@ namespace snn
     void unittest()
     {
         snn_require(app::example());
+        snn_static_require(app::test_element_with_engine());
 
         {
             str s;
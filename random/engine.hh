@@ -0,0 +1,27 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Random number engine concept
+
+// An engine is a seedable, non-cryptographic pseudo-random number generator, e.g.
+// [xoshiro256pp.hh](xoshiro256pp.hh), [pcg64.hh](pcg64.hh) or [wyrand.hh](wyrand.hh).
+
+// Engines are reproducible (the same seed gives the same sequence) and must not be used for
+// anything security related. Functions like `random::number(...)` without an engine parameter use
+// a cryptographically secure source.
+
+#pragma once
+
+#include "snn-core/core.hh"
+
+namespace snn::random
+{
+    // ## Concepts
+
+    // ### engine
+
+    template <typename E>
+    concept engine = requires(E& e) {
+        { e.next() } -> same_as<u64>;
+    };
+}
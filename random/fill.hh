@@ -6,6 +6,7 @@
 #pragma once
 
 #include "snn-core/array_view.hh"
+#include "snn-core/random/engine.hh"
 #include "snn-core/random/detail/source.hh"
 
 namespace snn::random
@@ -19,4 +20,55 @@ namespace snn::random
     {
         random::detail::source::fill(buffer);
     }
+
+    // With a (non-cryptographic) engine.
+
+    // Writes 8 bytes per call to `engine.next()` (little-endian), the byte stores are merged by
+    // the compiler and the loop is unrolled to interleave the stores with the state updates.
+
+    template <octet Octet, usize Count, random::engine Engine>
+    constexpr void fill(array_view<Octet, Count> buffer, Engine& engine)
+    {
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        const auto store = [](Octet* const p, const u64 word, const usize size) {
+            for (usize i = 0; i < size; ++i)
+            {
+                p[i] = static_cast<Octet>(word >> (i * 8));
+            }
+        };
+
+        Octet* cur        = buffer.begin();
+        const usize count = buffer.count();
+        Octet* const last = cur + (count - (count % 32));
+
+        while (cur < last)
+        {
+            const u64 a = engine.next();
+            const u64 b = engine.next();
+            const u64 c = engine.next();
+            const u64 d = engine.next();
+            store(cur, a, 8);
+            store(cur + 8, b, 8);
+            store(cur + 16, c, 8);
+            store(cur + 24, d, 8);
+            cur += 32;
+        }
+
+        usize rem = count % 32;
+        while (rem >= 8)
+        {
+            store(cur, engine.next(), 8);
+            cur += 8;
+            rem -= 8;
+        }
+
+        if (rem > 0)
+        {
+            store(cur, engine.next(), rem);
+        }
+
+        SNN_DIAGNOSTIC_POP
+    }
 }
@@ -6,6 +6,7 @@
 #include "snn-core/array.hh"
 #include "snn-core/unittest.hh"
 #include "snn-core/fn/common.hh"
+#include "snn-core/random/pcg64.hh"
 
 namespace snn::app
 {
@@ -21,6 +22,50 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_fill_with_engine()
+        {
+            {
+                random::pcg64 rng{1};
+                random::pcg64 copy{rng};
+
+                // Little-endian, 8 bytes per `next()`.
+                array<u8, 11> buf;
+                random::fill(buf.view(), rng);
+                const u64 a = copy.next();
+                const u64 b = copy.next();
+                snn_require(buf.at(0, assume::within_bounds) == static_cast<u8>(a));
+                snn_require(buf.at(7, assume::within_bounds) == static_cast<u8>(a >> 56));
+                snn_require(buf.at(8, assume::within_bounds) == static_cast<u8>(b));
+                snn_require(buf.at(10, assume::within_bounds) == static_cast<u8>(b >> 16));
+                snn_require(rng == copy);
+            }
+            {
+                // Every size up to and past the unrolled loop.
+                for (usize size = 0; size < 80; ++size)
+                {
+                    random::pcg64 rng{2};
+                    str s{init::fill, size, '\0'};
+                    random::fill(s.view(), rng);
+
+                    random::pcg64 copy{2};
+                    str expected{init::fill, size, '\0'};
+                    for (usize i = 0; i < size; i += 8)
+                    {
+                        const u64 word = copy.next();
+                        for (usize j = i; j < math::min(i + 8, size); ++j)
+                        {
+                            expected.at(j, assume::within_bounds) =
+                                static_cast<char>(word >> ((j - i) * 8));
+                        }
+                    }
+                    snn_require(s == expected);
+                    snn_require(rng == copy);
+                }
+            }
+
+            return true;
+        }
     }
 }
 
@@ -29,6 +74,7 @@ namespace snn
     void unittest()
     {
         snn_require(app::example());
+        snn_static_require(app::test_fill_with_engine());
 
         {
             array<char, 8> buf; // Zero initiated.
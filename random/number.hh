@@ -6,6 +6,7 @@
 #pragma once
 
 #include "snn-core/math/common.hh"
+#include "snn-core/random/engine.hh"
 #include "snn-core/random/detail/source.hh"
 #include "snn-core/random/detail/uniform.hh"
 
@@ -51,4 +52,49 @@ namespace snn::random
         }
         return min_inclusive;
     }
+
+    // With a (non-cryptographic) engine.
+
+    template <strict_integral Int, random::engine Engine>
+    [[nodiscard]] constexpr Int number(Engine& engine)
+    {
+        if constexpr (sizeof(Int) <= sizeof(u32))
+        {
+            // Use the upper bits (the lower bits of some engines are of lower quality).
+            return static_cast<Int>(engine.next() >> 32);
+        }
+        else if constexpr (sizeof(Int) == sizeof(u64))
+        {
+            return static_cast<Int>(engine.next());
+        }
+        else
+        {
+            static_assert(sizeof(Int) == (sizeof(u64) * 2));
+            using Uint   = std::make_unsigned_t<Int>;
+            const Uint n = (Uint{engine.next()} << 64) | Uint{engine.next()};
+            return static_cast<Int>(n);
+        }
+    }
+
+    template <strict_integral Int, random::engine Engine>
+    [[nodiscard]] constexpr Int number(const Int min_inclusive, const Int max_exclusive,
+                                       Engine& engine)
+    {
+        if (min_inclusive < max_exclusive)
+        {
+            using Uint = std::make_unsigned_t<Int>;
+
+            const Uint abs_diff = math::subtract_with_overflow(static_cast<Uint>(max_exclusive),
+                                                               static_cast<Uint>(min_inclusive));
+            const Uint rnd      = random::detail::uniform(
+                abs_diff, [&engine] { return random::number<Uint>(engine); });
+
+            // Safe overflow/wrap around for negative minimum.
+            const auto i =
+                static_cast<Int>(math::add_with_overflow(rnd, static_cast<Uint>(min_inclusive)));
+            snn_should(i >= min_inclusive && i < max_exclusive);
+            return i;
+        }
+        return min_inclusive;
+    }
 }
@@ -4,6 +4,9 @@
 #include "snn-core/random/number.hh"
 
 #include "snn-core/unittest.hh"
+#include "snn-core/random/xoshiro256pp.hh"
+#include <sys/wait.h> // waitpid
+#include <unistd.h>   // _exit, close, fork, pipe, read, write
 
 namespace snn::app
 {
@@ -88,6 +91,91 @@ namespace snn::app
             }
             return true;
         }
+
+        constexpr bool test_number_with_engine()
+        {
+            random::xoshiro256pp rng{7};
+            random::xoshiro256pp copy{rng};
+
+            // Reproducible.
+            snn_require(random::number<u64>(rng) == copy.next());
+            snn_require(random::number<u32>(rng) == static_cast<u32>(copy.next() >> 32));
+            snn_require(random::number<i8>(rng) == static_cast<i8>(copy.next() >> 32));
+
+            // Range.
+            for (usize i = 0; i < 1000; ++i)
+            {
+                const auto n = random::number<int>(-3, 4, rng);
+                snn_require(n >= -3 && n < 4);
+            }
+
+            bool min_found = false;
+            bool max_found = false;
+            for (usize i = 0; i < 1000; ++i)
+            {
+                const auto n = random::number<u8>(0, 255, rng);
+                min_found    = min_found || n == 0;
+                max_found    = max_found || n == 254;
+            }
+            snn_require(min_found && max_found);
+
+            snn_require(random::number<int>(0, 1, rng) == 0);
+            snn_require(random::number<int>(2, 0, rng) == 2); // Invalid range.
+
+            // Full range.
+            snn_require(random::number<i64>(constant::limit<i64>::min, constant::limit<i64>::max,
+                                            rng) != random::number<i64>(rng));
+
+            return true;
+        }
+
+        bool test_buffered_source()
+        {
+            using random::detail::source;
+
+            source::discard();
+            snn_require(source::buffered_size() == 0);
+
+            // One refill serves many numbers.
+            ignore_if_unused(random::number<u32>());
+            snn_require(source::buffered_size() == (source::buffer_size - 4));
+            ignore_if_unused(random::number<u64>());
+            snn_require(source::buffered_size() == (source::buffer_size - 12));
+
+            // Large requests bypass the buffer.
+            str s{init::fill, source::direct_size, '\0'};
+            source::fill(s.view());
+            snn_require(source::buffered_size() == (source::buffer_size - 12));
+
+            // A forked child must not repeat the parent's buffered bytes.
+            int fds[2] = {-1, -1};
+            snn_require(::pipe(fds) == 0);
+
+            const ::pid_t pid = ::fork();
+            snn_require(pid >= 0);
+            if (pid == 0)
+            {
+                const u64 n = random::number<u64>();
+                const bool ok =
+                    ::write(fds[1], &n, sizeof(n)) == static_cast<::ssize_t>(sizeof(n));
+                ::_exit(ok ? 0 : 1);
+            }
+
+            const u64 parent_n = random::number<u64>();
+
+            u64 child_n = 0;
+            snn_require(::read(fds[0], &child_n, sizeof(child_n)) ==
+                        static_cast<::ssize_t>(sizeof(child_n)));
+            int status = -1;
+            snn_require(::waitpid(pid, &status, 0) == pid);
+            snn_require(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+            ::close(fds[0]);
+            ::close(fds[1]);
+
+            snn_require(parent_n != child_n);
+
+            return true;
+        }
     }
 }
 
@@ -96,6 +184,8 @@ namespace snn
     void unittest()
     {
         snn_require(app::example());
+        snn_static_require(app::test_number_with_engine());
+        snn_require(app::test_buffered_source());
 
         {
             const auto i1 = random::number<u64>();
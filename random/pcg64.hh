@@ -0,0 +1,111 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # PCG64 engine
+
+// Fast, seedable, non-cryptographic pseudo-random number generator with a period of 2^128
+// (PCG-XSL-RR 128/64, the same as `pcg64` in the PCG reference implementation).
+// https://www.pcg-random.org/
+
+// Different streams (selected when seeding) produce different sequences from the same seed.
+// `advance(n)` advances the engine n steps in O(log n).
+
+#pragma once
+
+#include "snn-core/random/engine.hh"
+#include <bit> // rotr
+
+namespace snn::random
+{
+    // ## Classes
+
+    // ### pcg64
+
+    class pcg64 final
+    {
+      public:
+        // #### Explicit constructors
+
+        // clang-format off
+
+        __attribute__((__no_sanitize__("unsigned-integer-overflow")))
+        constexpr explicit pcg64(const u64 seed, const u64 stream = 0) noexcept
+            : state_{0},
+              inc_{(u128_{stream} << 1) | 1}
+        {
+            step_();
+            state_ += seed;
+            step_();
+        }
+
+        // clang-format on
+
+        // #### Generate
+
+        [[nodiscard]] constexpr u64 next() noexcept
+        {
+            step_();
+            const auto rot = static_cast<int>(state_ >> 122);
+            return std::rotr(static_cast<u64>(state_ >> 64) ^ static_cast<u64>(state_), rot);
+        }
+
+        // #### Jump
+
+        // Equivalent to `n` calls to `next()`.
+        constexpr void advance(const u64 n) noexcept
+        {
+            advance_(u128_{n});
+        }
+
+        // Equivalent to 2^64 calls to `next()`.
+        constexpr void jump() noexcept
+        {
+            advance_(u128_{1} << 64);
+        }
+
+        // #### Comparison
+
+        constexpr bool operator==(const pcg64&) const noexcept = default;
+
+      private:
+        using u128_ = __uint128_t;
+
+        static constexpr u128_ multiplier_ =
+            (u128_{2549297995355413924} << 64) | u128_{4865540595714422341};
+
+        u128_ state_;
+        u128_ inc_;
+
+        // clang-format off
+
+        __attribute__((__no_sanitize__("unsigned-integer-overflow")))
+        constexpr void step_() noexcept
+        {
+            state_ = (state_ * multiplier_) + inc_;
+        }
+
+        __attribute__((__no_sanitize__("unsigned-integer-overflow")))
+        constexpr void advance_(u128_ delta) noexcept
+        {
+            // Brown, "Random Number Generation with Arbitrary Stride".
+            u128_ cur_mult = multiplier_;
+            u128_ cur_plus = inc_;
+            u128_ acc_mult = 1;
+            u128_ acc_plus = 0;
+            while (delta > 0)
+            {
+                if (delta & 1)
+                {
+                    acc_mult *= cur_mult;
+                    acc_plus = (acc_plus * cur_mult) + cur_plus;
+                }
+                cur_plus = (cur_mult + 1) * cur_plus;
+                cur_mult *= cur_mult;
+                delta >>= 1;
+            }
+            state_ = (acc_mult * state_) + acc_plus;
+        }
+
+        // clang-format on
+    };
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/random/pcg64.hh"
+
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            // Seed and stream.
+            random::pcg64 rng{42, 54};
+
+            // Same output as the PCG reference implementation (`pcg64_srandom_r(&rng, 42, 54)`).
+            snn_require(rng.next() == 0x86b1da1d72062b68);
+            snn_require(rng.next() == 0x1304aa46c9853d39);
+            snn_require(rng.next() == 0xa3670e9e0dd50358);
+
+            return true;
+        }
+
+        constexpr bool test_pcg64()
+        {
+            static_assert(random::engine<random::pcg64>);
+
+            {
+                // Different streams.
+                random::pcg64 a{42, 1};
+                random::pcg64 b{42, 2};
+                snn_require(a != b);
+                snn_require(a.next() != b.next());
+
+                // Default stream.
+                snn_require(random::pcg64{42} == random::pcg64{42, 0});
+            }
+            {
+                // Advance.
+                random::pcg64 a{123};
+                random::pcg64 b{123};
+                for (usize i = 0; i < 1000; ++i)
+                {
+                    ignore_if_unused(a.next());
+                }
+                b.advance(1000);
+                snn_require(a == b);
+                snn_require(a.next() == b.next());
+
+                b.advance(0);
+                snn_require(a == b);
+            }
+            {
+                random::pcg64 a{123};
+                random::pcg64 b{a};
+                b.jump();
+                snn_require(a != b);
+                b.advance(0xffffffffffffffff);
+                b.advance(1);
+                a.advance(0xffffffffffffffff);
+                a.advance(0xffffffffffffffff);
+                a.advance(2);
+                snn_require(a == b); // 2 * 2^64 steps.
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_pcg64());
+    }
+}
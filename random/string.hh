@@ -6,6 +6,7 @@
 #pragma once
 
 #include "snn-core/strcore.hh"
+#include "snn-core/random/fill.hh"
 #include "snn-core/random/detail/source.hh"
 
 namespace snn::random
@@ -27,4 +28,20 @@ namespace snn::random
         random::string(size, append_to);
         return append_to;
     }
+
+    // With a (non-cryptographic) engine.
+
+    template <typename Buf, random::engine Engine>
+    constexpr void string(const usize size, strcore<Buf>& append_to, Engine& engine)
+    {
+        random::fill(append_to.append_for_overwrite(size), engine);
+    }
+
+    template <any_strcore Str = str, random::engine Engine>
+    [[nodiscard]] constexpr Str string(const usize size, Engine& engine)
+    {
+        Str append_to;
+        random::string(size, append_to, engine);
+        return append_to;
+    }
 }
@@ -6,6 +6,7 @@
 #include "snn-core/unittest.hh"
 #include "snn-core/string/repeat.hh"
 #include "snn-core/string/range/chunk.hh"
+#include "snn-core/random/xoshiro256pp.hh"
 
 namespace snn::app
 {
@@ -21,6 +22,27 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_string_with_engine()
+        {
+            random::xoshiro256pp a{99};
+            random::xoshiro256pp b{99};
+
+            const str s1 = random::string(100, a);
+            const str s2 = random::string(100, b);
+            snn_require(s1.size() == 100);
+            snn_require(s1 == s2); // Reproducible.
+
+            str s{"abc"};
+            random::string(5, s, a);
+            snn_require(s.size() == 8);
+            snn_require(s.view(0, 3) == "abc");
+
+            const str s3 = random::string(100, a);
+            snn_require(s3 != s1);
+
+            return true;
+        }
     }
 }
 
@@ -29,6 +51,7 @@ namespace snn
     void unittest()
     {
         snn_require(app::example());
+        snn_static_require(app::test_string_with_engine());
 
         // void string(const usize size, strcore<Buf>& append_to)
         {
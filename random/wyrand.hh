@@ -0,0 +1,64 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # wyrand engine
+
+// Very fast, seedable, non-cryptographic pseudo-random number generator with a period of 2^64
+// (a single 64-bit state).
+// https://github.com/wangyi-fudan/wyhash
+
+// `advance(n)` advances the engine n steps in O(1).
+
+#pragma once
+
+#include "snn-core/random/engine.hh"
+
+namespace snn::random
+{
+    // ## Classes
+
+    // ### wyrand
+
+    class wyrand final
+    {
+      public:
+        // #### Explicit constructors
+
+        constexpr explicit wyrand(const u64 seed) noexcept
+            : state_{seed}
+        {
+        }
+
+        // #### Generate
+
+        // clang-format off
+
+        [[nodiscard]] __attribute__((__no_sanitize__("unsigned-integer-overflow")))
+        constexpr u64 next() noexcept
+        {
+            state_ += increment_;
+            const auto t = static_cast<__uint128_t>(state_) * (state_ ^ 0xe7037ed1a0b428db);
+            return static_cast<u64>(t >> 64) ^ static_cast<u64>(t);
+        }
+
+        // #### Jump
+
+        // Equivalent to `n` calls to `next()`.
+        __attribute__((__no_sanitize__("unsigned-integer-overflow")))
+        constexpr void advance(const u64 n) noexcept
+        {
+            state_ += n * increment_; // Wraps around.
+        }
+
+        // clang-format on
+
+        // #### Comparison
+
+        constexpr bool operator==(const wyrand&) const noexcept = default;
+
+      private:
+        static constexpr u64 increment_ = 0xa0761d6478bd642f;
+
+        u64 state_;
+    };
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/random/wyrand.hh"
+
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            random::wyrand rng{0};
+            snn_require(rng.next() == 0x111cb3a78f59a58e);
+            snn_require(rng.next() == 0xceabd938ff4e856d);
+            snn_require(rng.next() == 0x61fb51318f47d2a4);
+
+            return true;
+        }
+
+        constexpr bool test_wyrand()
+        {
+            static_assert(random::engine<random::wyrand>);
+
+            random::wyrand a{987654321};
+            random::wyrand b{987654321};
+            snn_require(a == b);
+
+            for (usize i = 0; i < 1000; ++i)
+            {
+                ignore_if_unused(a.next());
+            }
+            snn_require(a != b);
+
+            b.advance(1000);
+            snn_require(a == b);
+            snn_require(a.next() == b.next());
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_wyrand());
+    }
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # xoshiro256++ engine
+
+// Fast, seedable, non-cryptographic pseudo-random number generator with a period of 2^256 - 1.
+// https://prng.di.unimi.it/
+
+// `jump()` advances the engine 2^128 steps and `long_jump()` 2^192 steps, which can be used to
+// create non-overlapping sequences, e.g. one per thread.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/random/engine.hh"
+#include "snn-core/random/detail/splitmix64.hh"
+#include <bit> // rotl
+
+namespace snn::random
+{
+    // ## Classes
+
+    // ### xoshiro256pp
+
+    class xoshiro256pp final
+    {
+      public:
+        // #### Explicit constructors
+
+        // The seed is expanded with SplitMix64.
+        constexpr explicit xoshiro256pp(u64 seed) noexcept
+            : s_{random::detail::splitmix64(seed), random::detail::splitmix64(seed),
+                 random::detail::splitmix64(seed), random::detail::splitmix64(seed)}
+        {
+        }
+
+        // #### Generate
+
+        // clang-format off
+
+        [[nodiscard]] __attribute__((__no_sanitize__("unsigned-integer-overflow", "unsigned-shift-base")))
+        constexpr u64 next() noexcept
+        {
+            u64& s0 = s_.get<0>();
+            u64& s1 = s_.get<1>();
+            u64& s2 = s_.get<2>();
+            u64& s3 = s_.get<3>();
+
+            const u64 result = std::rotl(s0 + s3, 23) + s0;
+            const u64 t      = s1 << 17;
+
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+
+            s2 ^= t;
+
+            s3 = std::rotl(s3, 45);
+
+            return result;
+        }
+
+        // clang-format on
+
+        // #### Jump
+
+        // Equivalent to 2^128 calls to `next()`.
+        constexpr void jump() noexcept
+        {
+            jump_(array<u64, 4>{0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa,
+                                0x39abdc4529b1661c});
+        }
+
+        // Equivalent to 2^192 calls to `next()`.
+        constexpr void long_jump() noexcept
+        {
+            jump_(array<u64, 4>{0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241,
+                                0x39109bb02acbe635});
+        }
+
+        // #### Comparison
+
+        constexpr bool operator==(const xoshiro256pp&) const noexcept = default;
+
+      private:
+        array<u64, 4> s_;
+
+        constexpr void jump_(const array<u64, 4> polynomial) noexcept
+        {
+            array<u64, 4> s{};
+            for (const u64 p : polynomial)
+            {
+                for (usize b = 0; b < 64; ++b)
+                {
+                    if (p & (u64{1} << b))
+                    {
+                        s.get<0>() ^= s_.get<0>();
+                        s.get<1>() ^= s_.get<1>();
+                        s.get<2>() ^= s_.get<2>();
+                        s.get<3>() ^= s_.get<3>();
+                    }
+                    ignore_if_unused(next());
+                }
+            }
+            s_ = s;
+        }
+    };
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/random/xoshiro256pp.hh"
+
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            // The same seed gives the same sequence.
+            random::xoshiro256pp a{12345};
+            random::xoshiro256pp b{12345};
+            snn_require(a == b);
+            snn_require(a.next() == 0x8d948a82def8a568);
+            snn_require(b.next() == 0x8d948a82def8a568);
+
+            // Non-overlapping sequences, e.g. one per thread.
+            random::xoshiro256pp c{12345};
+            random::xoshiro256pp d{c};
+            d.jump();
+            snn_require(c != d);
+
+            return true;
+        }
+
+        constexpr bool test_xoshiro256pp()
+        {
+            static_assert(random::engine<random::xoshiro256pp>);
+
+            {
+                random::xoshiro256pp rng{0};
+                snn_require(rng.next() == 0x53175d61490b23df);
+                snn_require(rng.next() == 0x61da6f3dc380d507);
+                snn_require(rng.next() == 0x5c0fdf91ec9a7bfc);
+            }
+            {
+                // Verified against a GF(2) matrix power of the state transition.
+                random::xoshiro256pp rng{0};
+                rng.jump();
+                snn_require(rng.next() == 0x2107d23f5380538b);
+            }
+            {
+                random::xoshiro256pp rng{0};
+                rng.long_jump();
+                snn_require(rng.next() == 0x708919b147f78af3);
+            }
+            {
+                random::xoshiro256pp a{1};
+                random::xoshiro256pp b{2};
+                snn_require(a != b);
+                snn_require(a.next() != b.next());
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_xoshiro256pp());
+    }
+}
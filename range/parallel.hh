@@ -0,0 +1,192 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Parallel terminal stage for range views
+
+// The source range is split into chunks with `range::view::chunk` (constant time per chunk, the
+// source must have `count()` and `pop_front_n(usize)`, e.g. a contiguous or random access range).
+// Every chunk is passed to `pipeline` (e.g. `v::filter(...)`, `v::transform(...)`), which runs
+// lazily on a worker of a `thread::pool`. The results of the chunks are combined in order, so the
+// result is the same as running the pipeline on the whole source on a single thread.
+
+// * `to<Container>(...)`: Append every element of every chunk to a `Container` (e.g. `vec<T>`
+//   or `str`), chunks are then merged in order (moved).
+// * `reduce(...)`: Fold every chunk starting with `init`, then fold the chunk results in order.
+//   `init` must be an identity for `op` and `op` must be associative.
+// * `for_each(...)`: Call `f` with every element (chunks run concurrently).
+
+// `pipeline` is shared by all workers and is invoked concurrently, it must be safe to call from
+// multiple threads (e.g. a non-mutable lambda that builds a view pipeline).
+
+// The default chunk size gives each worker about four chunks (load balancing). The calling thread
+// blocks until all chunks are done, so don't call these functions from a task running on the
+// same pool.
+
+// If a chunk fails (throws), all other chunks still run to completion before the error is thrown
+// (`pipeline` and `f` are referenced by the chunks).
+
+#pragma once
+
+#include "snn-core/vec.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/range/view/chunk.hh"
+#include "snn-core/thread/pool.hh"
+
+namespace snn::range::parallel
+{
+    namespace detail
+    {
+        template <typename Rng>
+        concept splittable_range =
+            forward_range<Rng> && requires(Rng& rng) {
+                { rng.count() } -> same_as<usize>;
+                rng.pop_front_n(usize{});
+            };
+
+        inline usize chunk_size(const usize count, const usize worker_count,
+                                const usize chunk_size) noexcept
+        {
+            if (chunk_size > 0)
+            {
+                return chunk_size;
+            }
+            const usize chunk_count = worker_count * 4;
+            return math::max((count / chunk_count) + ((count % chunk_count) != 0), usize{1});
+        }
+
+        // Submit `fn(chunk)` for every chunk, returns the task handles (in order).
+        template <typename T, typename Rng, typename Fn>
+        vec<thread::task<T>> submit_chunks(thread::pool& pool, Rng src, const Fn& fn,
+                                           const usize chunk_size)
+        {
+            const usize size = detail::chunk_size(src.count(), pool.worker_count(), chunk_size);
+
+            vec<thread::task<T>> tasks{init::reserve, (src.count() / size) + 1};
+            try
+            {
+                for (auto chunk : range::view::chunk{std::move(src), size})
+                {
+                    tasks.append(pool.submit([&fn, chunk]() mutable { return fn(chunk); }));
+                }
+            }
+            catch (...)
+            {
+                // Tasks reference `fn`.
+                for (thread::task<T>& t : tasks)
+                {
+                    t.wait();
+                }
+                throw;
+            }
+
+            for (thread::task<T>& t : tasks)
+            {
+                t.wait();
+            }
+
+            return tasks;
+        }
+    }
+
+    // ## Functions
+
+    // ### to
+
+    template <typename Container, detail::splittable_range Rng, typename Pipeline>
+    [[nodiscard]] Container to(thread::pool& pool, Rng src, const Pipeline& pipeline,
+                               const usize chunk_size = 0)
+    {
+        auto tasks = detail::submit_chunks<Container>(
+            pool, std::move(src),
+            [&pipeline](Rng& chunk) {
+                Container part;
+                for (auto&& e : pipeline(std::move(chunk)))
+                {
+                    part.append(std::forward<decltype(e)>(e));
+                }
+                return part;
+            },
+            chunk_size);
+
+        vec<Container> parts{init::reserve, tasks.count()};
+        usize total = 0;
+        for (thread::task<Container>& t : tasks)
+        {
+            parts.append(t.get().value());
+            if constexpr (any_strcore<Container>)
+            {
+                total += parts.back(assume::not_empty).size();
+            }
+            else
+            {
+                total += parts.back(assume::not_empty).count();
+            }
+        }
+
+        Container out;
+        out.reserve(total);
+        for (Container& part : parts)
+        {
+            if constexpr (any_strcore<Container>)
+            {
+                out.append(part);
+            }
+            else
+            {
+                for (auto& e : part)
+                {
+                    out.append(std::move(e));
+                }
+            }
+        }
+        return out;
+    }
+
+    // ### reduce
+
+    template <detail::splittable_range Rng, typename Pipeline, typename T, typename TwoArgOp>
+    [[nodiscard]] T reduce(thread::pool& pool, Rng src, const Pipeline& pipeline, const T& init,
+                           const TwoArgOp& op, const usize chunk_size = 0)
+    {
+        auto tasks = detail::submit_chunks<T>(
+            pool, std::move(src),
+            [&pipeline, &init, &op](Rng& chunk) {
+                T acc = init;
+                for (auto&& e : pipeline(std::move(chunk)))
+                {
+                    acc = op(std::move(acc), std::forward<decltype(e)>(e));
+                }
+                return acc;
+            },
+            chunk_size);
+
+        T acc = init;
+        for (thread::task<T>& t : tasks)
+        {
+            acc = op(std::move(acc), t.get().value());
+        }
+        return acc;
+    }
+
+    // ### for_each
+
+    template <detail::splittable_range Rng, typename Pipeline, typename OneArgFn>
+    void for_each(thread::pool& pool, Rng src, const Pipeline& pipeline, const OneArgFn& f,
+                  const usize chunk_size = 0)
+    {
+        auto tasks = detail::submit_chunks<void>(
+            pool, std::move(src),
+            [&pipeline, &f](Rng& chunk) {
+                for (auto&& e : pipeline(std::move(chunk)))
+                {
+                    f(std::forward<decltype(e)>(e));
+                }
+            },
+            chunk_size);
+
+        for (thread::task<void>& t : tasks)
+        {
+            t.get().or_throw();
+        }
+    }
+}
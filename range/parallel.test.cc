@@ -0,0 +1,166 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/range/parallel.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/range/random_access.hh"
+#include "snn-core/range/view/filter.hh"
+#include "snn-core/range/view/transform.hh"
+#include <atomic> // atomic
+#include <deque>  // deque
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            thread::pool pool{not_zero<usize>{4}};
+
+            vec<u32> records;
+            for (u32 i = 0; i < 100'000; ++i)
+            {
+                records.append(i);
+            }
+
+            // The pipeline runs on every chunk (on a worker), the result is in order.
+            const auto pipeline = [](auto chunk) {
+                return std::move(chunk) | range::v::filter{[](const u32 i) { return i % 3 == 0; }} |
+                       range::v::transform{[](const u32 i) { return u64{i} * 2; }};
+            };
+
+            const vec<u64> doubled = range::parallel::to<vec<u64>>(pool, records.range(), pipeline);
+            snn_require(doubled.count() == 33'334);
+            snn_require(doubled.at(0).value() == 0);
+            snn_require(doubled.at(1).value() == 6);
+            snn_require(doubled.back().value() == 199'998);
+
+            const u64 sum = range::parallel::reduce(pool, records.range(), pipeline, u64{0},
+                                                    [](const u64 a, const u64 b) { return a + b; });
+            snn_require(sum == 3'333'366'666);
+
+            return true;
+        }
+
+        bool test_parallel()
+        {
+            thread::pool pool{not_zero<usize>{3}};
+
+            const auto identity = [](auto chunk) { return chunk; };
+
+            {
+                // Empty source.
+                const vec<int> empty;
+                const auto out = range::parallel::to<vec<int>>(pool, empty.range(), identity);
+                snn_require(out.is_empty());
+                snn_require(range::parallel::reduce(pool, empty.range(), identity, 7,
+                                                    [](int a, int b) { return a + b; }) == 7);
+            }
+            {
+                // Order is preserved for every chunk size.
+                vec<usize> source;
+                for (usize i = 0; i < 1'000; ++i)
+                {
+                    source.append(i);
+                }
+
+                for (const int chunk_size : {0, 1, 7, 999, 1000, 5000})
+                {
+                    const auto out = range::parallel::to<vec<usize>>(
+                        pool, source.range(), identity, static_cast<usize>(chunk_size));
+                    snn_require(out == source);
+                }
+
+                // Non-commutative reduce.
+                const str digits = range::parallel::reduce(
+                    pool, source.range(),
+                    [](auto chunk) {
+                        return std::move(chunk) | range::v::transform{[](const usize i) {
+                                   return static_cast<char>('0' + (i % 10));
+                               }};
+                    },
+                    str{},
+                    [](str a, const auto& b) {
+                        a.append(b); // Char or string.
+                        return a;
+                    },
+                    13);
+                snn_require(digits.size() == 1'000);
+                snn_require(digits.view(0, 12) == "012345678901");
+            }
+            {
+                // Merge into a string.
+                const str s{"The quick brown fox jumps over the lazy dog"};
+                const str upper = range::parallel::to<str>(
+                    pool, s.range(),
+                    [](auto chunk) {
+                        return std::move(chunk) |
+                               range::v::transform{[](const char c) {
+                                   return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 32) : c;
+                               }};
+                    },
+                    4);
+                snn_require(upper == "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG");
+            }
+            {
+                // Random access source.
+                std::deque<int> deque;
+                for (int i = 0; i < 500; ++i)
+                {
+                    deque.push_back(i);
+                }
+                range::random_access rng{init::from, deque.begin(), deque.end()};
+                const int sum = range::parallel::reduce(pool, rng, identity, 0,
+                                                        [](int a, int b) { return a + b; });
+                snn_require(sum == 124'750);
+            }
+            {
+                // For each.
+                vec<usize> source;
+                for (usize i = 1; i <= 100; ++i)
+                {
+                    source.append(i);
+                }
+                std::atomic<usize> sum{0};
+                range::parallel::for_each(
+                    pool, source.range(), identity,
+                    [&sum](const usize i) { sum.fetch_add(i, std::memory_order_relaxed); }, 9);
+                snn_require(sum.load() == 5050);
+            }
+            {
+                // Errors are thrown after all chunks are done.
+                vec<int> source;
+                for (int i = 0; i < 100; ++i)
+                {
+                    source.append(i);
+                }
+                std::atomic<usize> done{0};
+                snn_require_throws_code(
+                    range::parallel::for_each(
+                        pool, source.range(), identity,
+                        [&done](const int i) {
+                            if (i == 50)
+                            {
+                                throw_or_abort(generic::error::invalid_value);
+                            }
+                            done.fetch_add(1);
+                        },
+                        10),
+                    generic::error::invalid_value);
+                snn_require(done.load() == 90); // The failing chunk stops at the error.
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_parallel());
+    }
+}
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "snn-core/optional.hh"
+#include "snn-core/math/common.hh"
 
 namespace snn::range
 {
@@ -80,6 +81,13 @@ namespace snn::range
             ++first_;
         }
 
+        constexpr random_access pop_front_n(const usize count)
+        {
+            const auto first = first_;
+            first_ += to_isize(math::min(count, this->count()));
+            return random_access{init::from, first, first_};
+        }
+
         [[nodiscard]] constexpr optional<dereference_type> front()
         {
             if (first_ != last_)
@@ -123,6 +123,31 @@ namespace snn
             snn_require(!std::as_const(rng).front().has_value());
         }
 
+        // constexpr random_access pop_front_n(const usize count)
+        {
+            std::deque<int> deque;
+            deque.push_back(1);
+            deque.push_back(2);
+            deque.push_back(3);
+
+            range::random_access rng{init::from, deque.begin(), deque.end()};
+
+            auto r = rng.pop_front_n(2);
+            snn_require(r.count() == 2);
+            snn_require(r.front().value() == 1);
+            snn_require(r.back().value() == 2);
+            snn_require(rng.count() == 1);
+            snn_require(rng.front().value() == 3);
+
+            r = rng.pop_front_n(99);
+            snn_require(r.count() == 1);
+            snn_require(r.front().value() == 3);
+            snn_require(rng.is_empty());
+
+            r = rng.pop_front_n(1);
+            snn_require(r.is_empty());
+        }
+
         // constexpr optional<dereference_type> back()
         // constexpr optional<const_dereference_type> back() const
         // constexpr dereference_type back(assume::not_empty_t)
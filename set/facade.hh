@@ -4,7 +4,8 @@
 // # Facade (`std::` container wrapper)
 
 // Wrapper around `std::set` or `std::unordered_set`, see [set/sorted.hh](sorted.hh) and
-// [set/unsorted.hh](unsorted.hh).
+// [set/unsorted.hh](unsorted.hh). Also used with the small-buffer table of
+// [set/small.hh](small.hh).
 
 #pragma once
 
@@ -0,0 +1,865 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Compressed set of `u32` values (Roaring bitmap)
+
+// "Better bitmap performance with Roaring bitmaps" by Samy Chambi, Daniel Lemire, Owen Kaser and
+// Robert Godin (https://arxiv.org/abs/1402.6407): Values are partitioned by their high 16 bits
+// into containers of up to 65536 values. A container with at most 4096 values is a sorted array
+// of the low 16 bits (2 bytes per value), a larger container is a bitmap (8 KiB). Memory usage is
+// proportional to the number of values for sparse sets and one bit per value for dense sets.
+
+// Intersections (`&=` and `count_and(...)`) skip containers with no matching high bits, bitmap
+// containers are combined with SIMD (SSE2/AVX2) when enabled at compile time. Run-length encoded
+// containers are not implemented.
+
+#pragma once
+
+#include "snn-core/vec.hh"
+#include "snn-core/algo/find_greater_than_or_equal_to.hh"
+#include "snn-core/detail/bitset/simd.hh"
+#include "snn-core/range/forward.hh"
+#include <bit> // countr_zero, popcount
+
+namespace snn::set
+{
+    namespace detail::roaring
+    {
+        // ### container
+
+        // The low 16 bits of all values with the same high 16 bits. A container is never empty
+        // when it's part of a `roaring` set.
+
+        class container final
+        {
+          public:
+            static constexpr usize array_max_count = 4096;
+            static constexpr usize word_count      = 1024; // 65536 bits.
+
+            // Position (array index or bit position) past the end.
+            static constexpr u32 end_pos = 0x10000;
+
+            using trivially_relocatable_type =
+                trivially_relocatable_if_t<container, vec<u16>, vec<u64>>;
+
+            // #### Status
+
+            [[nodiscard]] usize count() const noexcept
+            {
+                return count_;
+            }
+
+            [[nodiscard]] bool is_bitmap() const noexcept
+            {
+                return !words_.is_empty();
+            }
+
+            // #### Single value
+
+            [[nodiscard]] bool contains(const u16 value) const noexcept
+            {
+                if (is_bitmap())
+                {
+                    return (word_(value) & bit_(value)) != 0;
+                }
+                const usize pos = lower_bound_(values_, value);
+                return pos < values_.count() && values_.at(pos, assume::within_bounds) == value;
+            }
+
+            bool insert(const u16 value)
+            {
+                if (is_bitmap())
+                {
+                    u64& w = word_(value);
+                    if ((w & bit_(value)) != 0)
+                    {
+                        return false;
+                    }
+                    w |= bit_(value);
+                    ++count_;
+                    return true;
+                }
+
+                const usize pos = lower_bound_(values_, value);
+                if (pos < values_.count() && values_.at(pos, assume::within_bounds) == value)
+                {
+                    return false;
+                }
+                if (values_.count() < array_max_count)
+                {
+                    values_.insert_at(pos, value);
+                    ++count_;
+                    return true;
+                }
+                to_bitmap_();
+                return insert(value);
+            }
+
+            bool remove(const u16 value)
+            {
+                if (is_bitmap())
+                {
+                    u64& w = word_(value);
+                    if ((w & bit_(value)) == 0)
+                    {
+                        return false;
+                    }
+                    w &= ~bit_(value);
+                    --count_;
+                    normalize_();
+                    return true;
+                }
+
+                const usize pos = lower_bound_(values_, value);
+                if (pos < values_.count() && values_.at(pos, assume::within_bounds) == value)
+                {
+                    values_.drop_at(pos, 1);
+                    --count_;
+                    return true;
+                }
+                return false;
+            }
+
+            // #### Iteration
+
+            [[nodiscard]] u32 first_pos() const noexcept
+            {
+                return next_pos(0);
+            }
+
+            // Position at or after `pos` (`end_pos` if there is none).
+            [[nodiscard]] u32 next_pos(const u32 pos) const noexcept
+            {
+                if (!is_bitmap())
+                {
+                    return pos < values_.count() ? pos : end_pos;
+                }
+
+                usize index = pos / 64;
+                if (index >= word_count)
+                {
+                    return end_pos;
+                }
+                u64 w = words_.at(index, assume::within_bounds) & (~u64{0} << (pos % 64));
+                while (w == 0)
+                {
+                    ++index;
+                    if (index == word_count)
+                    {
+                        return end_pos;
+                    }
+                    w = words_.at(index, assume::within_bounds);
+                }
+                return static_cast<u32>((index * 64) + static_cast<usize>(std::countr_zero(w)));
+            }
+
+            [[nodiscard]] u16 value_at(const u32 pos) const noexcept
+            {
+                if (is_bitmap())
+                {
+                    return static_cast<u16>(pos);
+                }
+                return values_.at(pos, assume::within_bounds);
+            }
+
+            // #### Set operations
+
+            void intersect(const container& other)
+            {
+                if (is_bitmap() && other.is_bitmap())
+                {
+                    apply_words_<simd_operation::and_op>(other);
+                }
+                else if (is_bitmap())
+                {
+                    // The result has at most as many values as the array.
+                    vec<u16> values{init::reserve, other.count_};
+                    for (const u16 v : other.values_)
+                    {
+                        if (contains(v))
+                        {
+                            values.append(v);
+                        }
+                    }
+                    set_values_(std::move(values));
+                }
+                else if (other.is_bitmap())
+                {
+                    filter_values_([&other](const u16 v) { return other.contains(v); });
+                }
+                else
+                {
+                    intersect_arrays_(other);
+                }
+            }
+
+            void unite(const container& other)
+            {
+                if (!other.is_bitmap() && !is_bitmap() &&
+                    (count_ + other.count_) <= array_max_count)
+                {
+                    unite_arrays_(other);
+                    return;
+                }
+
+                if (!is_bitmap())
+                {
+                    to_bitmap_();
+                }
+
+                if (other.is_bitmap())
+                {
+                    apply_words_<simd_operation::or_op>(other);
+                }
+                else
+                {
+                    for (const u16 v : other.values_)
+                    {
+                        insert(v);
+                    }
+                    normalize_();
+                }
+            }
+
+            void subtract(const container& other)
+            {
+                if (is_bitmap() && other.is_bitmap())
+                {
+                    apply_words_<simd_operation::and_not_op>(other);
+                }
+                else if (is_bitmap())
+                {
+                    for (const u16 v : other.values_)
+                    {
+                        if (count_ == 0)
+                        {
+                            break;
+                        }
+                        remove(v);
+                    }
+                }
+                else
+                {
+                    filter_values_([&other](const u16 v) { return !other.contains(v); });
+                }
+            }
+
+            [[nodiscard]] usize count_and(const container& other) const noexcept
+            {
+                if (is_bitmap() && other.is_bitmap())
+                {
+                    return count_words_(words_.cbegin(), other.words_.cbegin());
+                }
+
+                const container& array = is_bitmap() ? other : *this;
+                const container& probe = is_bitmap() ? *this : other;
+
+                usize count = 0;
+                for (const u16 v : array.values_)
+                {
+                    count += probe.contains(v);
+                }
+                return count;
+            }
+
+            // #### Comparison
+
+            bool operator==(const container& other) const noexcept
+            {
+                if (count_ != other.count_)
+                {
+                    return false;
+                }
+                if (is_bitmap() == other.is_bitmap())
+                {
+                    return values_ == other.values_ && words_ == other.words_;
+                }
+                return count_and(other) == count_;
+            }
+
+          private:
+            using simd_operation = snn::detail::bitset::simd::operation;
+
+            vec<u16> values_; // Sorted (array container).
+            vec<u64> words_;  // Exactly `word_count` words (bitmap container).
+            usize count_{0};
+
+            static u64 bit_(const u16 value) noexcept
+            {
+                return u64{1} << (value % 64);
+            }
+
+            u64& word_(const u16 value) noexcept
+            {
+                return words_.at(value / 64, assume::within_bounds);
+            }
+
+            const u64& word_(const u16 value) const noexcept
+            {
+                return words_.at(value / 64, assume::within_bounds);
+            }
+
+            static usize lower_bound_(const vec<u16>& values, const u16 value) noexcept
+            {
+                return algo::find_greater_than_or_equal_to(values.range(), value, assume::is_sorted)
+                    .value_or(values.count());
+            }
+
+            static usize count_words_(const u64* const a, const u64* const b) noexcept
+            {
+                usize total = 0;
+                usize i     = snn::detail::bitset::simd::count_and(a, b, word_count, total);
+
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+                for (; i < word_count; ++i)
+                {
+                    total += static_cast<usize>(std::popcount(a[i] & b[i]));
+                }
+
+                SNN_DIAGNOSTIC_POP
+
+                return total;
+            }
+
+            template <simd_operation Op>
+            void apply_words_(const container& other)
+            {
+                u64* const dst       = words_.begin();
+                const u64* const src = other.words_.cbegin();
+
+                usize i = snn::detail::bitset::simd::apply<Op>(dst, src, word_count);
+
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+                for (; i < word_count; ++i)
+                {
+                    if constexpr (Op == simd_operation::and_op)
+                    {
+                        dst[i] &= src[i];
+                    }
+                    else if constexpr (Op == simd_operation::or_op)
+                    {
+                        dst[i] |= src[i];
+                    }
+                    else
+                    {
+                        dst[i] &= ~src[i];
+                    }
+                }
+
+                SNN_DIAGNOSTIC_POP
+
+                count_ = count_words_(dst, dst);
+                normalize_();
+            }
+
+            void intersect_arrays_(const container& other)
+            {
+                const vec<u16>& small = count_ <= other.count_ ? values_ : other.values_;
+                const vec<u16>& large = count_ <= other.count_ ? other.values_ : values_;
+
+                vec<u16> values{init::reserve, small.count()};
+                if ((small.count() * 32) < large.count())
+                {
+                    // Skewed sizes, binary search the large array.
+                    usize first = 0;
+                    for (const u16 v : small)
+                    {
+                        const auto tail = large.view(first);
+                        first += lower_bound_view_(tail, v);
+                        if (first == large.count())
+                        {
+                            break;
+                        }
+                        if (large.at(first, assume::within_bounds) == v)
+                        {
+                            values.append(v);
+                        }
+                    }
+                }
+                else
+                {
+                    usize i = 0;
+                    usize j = 0;
+                    while (i < small.count() && j < large.count())
+                    {
+                        const u16 a = small.at(i, assume::within_bounds);
+                        const u16 b = large.at(j, assume::within_bounds);
+                        if (a < b)
+                        {
+                            ++i;
+                        }
+                        else if (b < a)
+                        {
+                            ++j;
+                        }
+                        else
+                        {
+                            values.append(a);
+                            ++i;
+                            ++j;
+                        }
+                    }
+                }
+                set_values_(std::move(values));
+            }
+
+            void unite_arrays_(const container& other)
+            {
+                vec<u16> values{init::reserve, count_ + other.count_};
+                usize i = 0;
+                usize j = 0;
+                while (i < values_.count() || j < other.values_.count())
+                {
+                    if (j == other.values_.count())
+                    {
+                        values.append(values_.at(i++, assume::within_bounds));
+                        continue;
+                    }
+                    if (i == values_.count())
+                    {
+                        values.append(other.values_.at(j++, assume::within_bounds));
+                        continue;
+                    }
+                    const u16 a = values_.at(i, assume::within_bounds);
+                    const u16 b = other.values_.at(j, assume::within_bounds);
+                    values.append(a <= b ? a : b);
+                    i += (a <= b);
+                    j += (b <= a);
+                }
+                set_values_(std::move(values));
+            }
+
+            static usize lower_bound_view_(const array_view<const u16> values, const u16 value)
+            {
+                return algo::find_greater_than_or_equal_to(values.range(), value, assume::is_sorted)
+                    .value_or(values.count());
+            }
+
+            template <typename OneArgPred>
+            void filter_values_(OneArgPred keep) noexcept
+            {
+                usize kept = 0;
+                for (usize i = 0; i < values_.count(); ++i)
+                {
+                    const u16 v = values_.at(i, assume::within_bounds);
+                    if (keep(v))
+                    {
+                        values_.at(kept++, assume::within_bounds) = v;
+                    }
+                }
+                values_.truncate(kept);
+                count_ = kept;
+            }
+
+            void set_values_(vec<u16> values) noexcept
+            {
+                count_  = values.count();
+                values_ = std::move(values);
+                words_  = vec<u64>{};
+            }
+
+            void to_bitmap_()
+            {
+                snn_should(!is_bitmap());
+                words_.reserve(word_count);
+                for (usize i = 0; i < word_count; ++i)
+                {
+                    words_.append(0);
+                }
+                for (const u16 v : values_)
+                {
+                    word_(v) |= bit_(v);
+                }
+                values_ = vec<u16>{};
+            }
+
+            void normalize_()
+            {
+                if (is_bitmap() && count_ <= array_max_count)
+                {
+                    vec<u16> values;
+                    values.reserve(count_);
+                    for (u32 pos = first_pos(); pos != end_pos; pos = next_pos(pos + 1))
+                    {
+                        values.append(static_cast<u16>(pos));
+                    }
+                    set_values_(std::move(values));
+                }
+            }
+        };
+
+        // ### iterator
+
+        template <typename Roaring>
+        class iterator final
+        {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = u32;
+            using difference_type   = isize;
+
+            iterator() noexcept = default;
+
+            explicit iterator(const Roaring* const r, const usize index) noexcept
+                : r_{r},
+                  index_{index}
+            {
+                if (index_ < r_->containers_.count())
+                {
+                    pos_ = r_->containers_.at(index_, assume::within_bounds).first_pos();
+                }
+            }
+
+            u32 operator*() const noexcept
+            {
+                const u32 high = r_->keys_.at(index_, assume::within_bounds);
+                const u16 low  = r_->containers_.at(index_, assume::within_bounds).value_at(pos_);
+                return (high << 16) | low;
+            }
+
+            iterator& operator++() noexcept
+            {
+                pos_ = r_->containers_.at(index_, assume::within_bounds).next_pos(pos_ + 1);
+                if (pos_ == container::end_pos)
+                {
+                    ++index_;
+                    pos_ = 0;
+                    if (index_ < r_->containers_.count())
+                    {
+                        pos_ = r_->containers_.at(index_, assume::within_bounds).first_pos();
+                    }
+                }
+                return *this;
+            }
+
+            bool operator==(const iterator& other) const noexcept
+            {
+                return index_ == other.index_ && pos_ == other.pos_;
+            }
+
+          private:
+            const Roaring* r_{nullptr};
+            usize index_{0};
+            u32 pos_{0};
+        };
+    }
+
+    // ## Classes
+
+    // ### roaring
+
+    class roaring final
+    {
+      public:
+        // #### Types
+
+        using value_type     = u32;
+        using iterator       = detail::roaring::iterator<roaring>;
+        using const_iterator = iterator;
+
+        using trivially_relocatable_type =
+            trivially_relocatable_if_t<roaring, vec<u16>, vec<detail::roaring::container>>;
+
+        // #### Default constructor
+
+        roaring() noexcept = default;
+
+        // #### Converting constructors
+
+        roaring(init_list<u32> values)
+        {
+            for (const u32 v : values)
+            {
+                insert(v);
+            }
+        }
+
+        // #### Explicit conversion operators
+
+        explicit operator bool() const noexcept
+        {
+            return !is_empty();
+        }
+
+        // #### Iterators
+
+        // In ascending order.
+
+        [[nodiscard]] iterator begin() const noexcept
+        {
+            return iterator{this, 0};
+        }
+
+        [[nodiscard]] iterator end() const noexcept
+        {
+            return iterator{this, containers_.count()};
+        }
+
+        [[nodiscard]] iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        // #### Count
+
+        [[nodiscard]] usize count() const noexcept
+        {
+            usize count = 0;
+            for (const auto& c : containers_)
+            {
+                count += c.count();
+            }
+            return count;
+        }
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            return containers_.is_empty();
+        }
+
+        // Number of containers (distinct high 16 bits).
+        [[nodiscard]] usize container_count() const noexcept
+        {
+            return containers_.count();
+        }
+
+        // #### Single value
+
+        [[nodiscard]] bool contains(const u32 value) const noexcept
+        {
+            const usize index = find_(high_(value));
+            return index < keys_.count() &&
+                   keys_.at(index, assume::within_bounds) == high_(value) &&
+                   containers_.at(index, assume::within_bounds).contains(low_(value));
+        }
+
+        // Returns `true` if the value was inserted (`false` if it already existed).
+        bool insert(const u32 value)
+        {
+            const u16 high    = high_(value);
+            const usize index = find_(high);
+            if (index == keys_.count() || keys_.at(index, assume::within_bounds) != high)
+            {
+                containers_.insert_at(index, detail::roaring::container{});
+                keys_.insert_at(index, high);
+            }
+            return containers_.at(index, assume::within_bounds).insert(low_(value));
+        }
+
+        // Returns `true` if the value was removed (`false` if it didn't exist).
+        bool remove(const u32 value)
+        {
+            const u16 high    = high_(value);
+            const usize index = find_(high);
+            if (index == keys_.count() || keys_.at(index, assume::within_bounds) != high)
+            {
+                return false;
+            }
+
+            auto& c = containers_.at(index, assume::within_bounds);
+            if (!c.remove(low_(value)))
+            {
+                return false;
+            }
+            if (c.count() == 0)
+            {
+                drop_(index);
+            }
+            return true;
+        }
+
+        // #### Set operations
+
+        // Keep only values also in `other`.
+        roaring& operator&=(const roaring& other)
+        {
+            usize kept = 0;
+            usize j    = 0;
+            for (usize i = 0; i < keys_.count(); ++i)
+            {
+                const u16 key = keys_.at(i, assume::within_bounds);
+                while (j < other.keys_.count() && other.keys_.at(j, assume::within_bounds) < key)
+                {
+                    ++j;
+                }
+                if (j == other.keys_.count() || other.keys_.at(j, assume::within_bounds) != key)
+                {
+                    continue;
+                }
+
+                auto& c = containers_.at(i, assume::within_bounds);
+                c.intersect(other.containers_.at(j, assume::within_bounds));
+                if (c.count() > 0)
+                {
+                    if (kept != i)
+                    {
+                        keys_.at(kept, assume::within_bounds) = key;
+                        containers_.at(kept, assume::within_bounds) = std::move(c);
+                    }
+                    ++kept;
+                }
+            }
+            keys_.truncate(kept);
+            containers_.truncate(kept);
+            return *this;
+        }
+
+        // Add all values in `other`.
+        roaring& operator|=(const roaring& other)
+        {
+            usize i = 0;
+            for (usize j = 0; j < other.keys_.count(); ++j)
+            {
+                const u16 key = other.keys_.at(j, assume::within_bounds);
+                const auto& c = other.containers_.at(j, assume::within_bounds);
+                while (i < keys_.count() && keys_.at(i, assume::within_bounds) < key)
+                {
+                    ++i;
+                }
+                if (i < keys_.count() && keys_.at(i, assume::within_bounds) == key)
+                {
+                    containers_.at(i, assume::within_bounds).unite(c);
+                }
+                else
+                {
+                    containers_.insert_at(i, c);
+                    keys_.insert_at(i, key);
+                }
+                ++i;
+            }
+            return *this;
+        }
+
+        // Remove all values in `other`.
+        roaring& and_not(const roaring& other)
+        {
+            usize j = 0;
+            for (usize i = 0; i < keys_.count();)
+            {
+                const u16 key = keys_.at(i, assume::within_bounds);
+                while (j < other.keys_.count() && other.keys_.at(j, assume::within_bounds) < key)
+                {
+                    ++j;
+                }
+                if (j < other.keys_.count() && other.keys_.at(j, assume::within_bounds) == key)
+                {
+                    auto& c = containers_.at(i, assume::within_bounds);
+                    c.subtract(other.containers_.at(j, assume::within_bounds));
+                    if (c.count() == 0)
+                    {
+                        drop_(i);
+                        continue;
+                    }
+                }
+                ++i;
+            }
+            return *this;
+        }
+
+        // Number of values in both sets (without creating the intersection).
+        [[nodiscard]] usize count_and(const roaring& other) const noexcept
+        {
+            usize count = 0;
+            usize i     = 0;
+            usize j     = 0;
+            while (i < keys_.count() && j < other.keys_.count())
+            {
+                const u16 a = keys_.at(i, assume::within_bounds);
+                const u16 b = other.keys_.at(j, assume::within_bounds);
+                if (a < b)
+                {
+                    ++i;
+                }
+                else if (b < a)
+                {
+                    ++j;
+                }
+                else
+                {
+                    count += containers_.at(i, assume::within_bounds)
+                                 .count_and(other.containers_.at(j, assume::within_bounds));
+                    ++i;
+                    ++j;
+                }
+            }
+            return count;
+        }
+
+        // #### Range
+
+        [[nodiscard]] auto range() const noexcept
+        {
+            return snn::range::forward{init::from, begin(), end()};
+        }
+
+        // #### Modifiers
+
+        void clear() noexcept
+        {
+            keys_.clear();
+            containers_.clear();
+        }
+
+        // #### Swap
+
+        void swap(roaring& other) noexcept
+        {
+            keys_.swap(other.keys_);
+            containers_.swap(other.containers_);
+        }
+
+        // #### Comparison
+
+        bool operator==(const roaring& other) const noexcept
+        {
+            return keys_ == other.keys_ && containers_ == other.containers_;
+        }
+
+      private:
+        template <typename>
+        friend class detail::roaring::iterator;
+
+        vec<u16> keys_; // High 16 bits, sorted.
+        vec<detail::roaring::container> containers_;
+
+        static u16 high_(const u32 value) noexcept
+        {
+            return static_cast<u16>(value >> 16);
+        }
+
+        static u16 low_(const u32 value) noexcept
+        {
+            return static_cast<u16>(value);
+        }
+
+        usize find_(const u16 high) const noexcept
+        {
+            return algo::find_greater_than_or_equal_to(keys_.range(), high, assume::is_sorted)
+                .value_or(keys_.count());
+        }
+
+        void drop_(const usize index) noexcept
+        {
+            keys_.drop_at(index, 1);
+            containers_.drop_at(index, 1);
+        }
+    };
+
+    // ## Functions
+
+    // ### swap
+
+    inline void swap(roaring& a, roaring& b) noexcept
+    {
+        a.swap(b);
+    }
+}
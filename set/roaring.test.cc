@@ -0,0 +1,234 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/set/roaring.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/algo/is_sorted.hh"
+#include "snn-core/set/sorted.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            set::roaring ids{7, 3, 100'000, 4'000'000'000};
+            snn_require(ids.count() == 4);
+            snn_require(ids.contains(100'000));
+            snn_require(!ids.contains(8));
+
+            snn_require(ids.insert(8));
+            snn_require(!ids.insert(8)); // Already exists.
+            snn_require(ids.remove(7));
+            snn_require(!ids.remove(7));
+
+            // Ascending order.
+            u64 sum = 0;
+            for (const u32 id : ids)
+            {
+                sum += id;
+            }
+            snn_require(sum == 3 + 8 + 100'000 + u64{4'000'000'000});
+            snn_require(algo::is_sorted(ids.range()));
+
+            // Intersection.
+            const set::roaring filter{3, 4, 5, 100'000};
+            snn_require(ids.count_and(filter) == 2);
+            ids &= filter;
+            snn_require(ids == set::roaring{3, 100'000});
+
+            return true;
+        }
+
+        // Deterministic pseudo-random values.
+        struct generator final
+        {
+            u64 state;
+
+            u32 next(const u32 max) noexcept
+            {
+                state = (state * 6364136223846793005) + 1442695040888963407;
+                return static_cast<u32>((state >> 33) % max);
+            }
+        };
+
+        template <typename Set>
+        bool is_same(const set::roaring& r, const Set& s)
+        {
+            if (r.count() != s.count())
+            {
+                return false;
+            }
+            auto it = s.begin();
+            for (const u32 v : r)
+            {
+                if (v != *it)
+                {
+                    return false;
+                }
+                ++it;
+            }
+            return true;
+        }
+
+        bool test_roaring()
+        {
+            {
+                set::roaring r;
+                snn_require(r.is_empty());
+                snn_require(!r);
+                snn_require(r.count() == 0);
+                snn_require(r.range().is_empty());
+                snn_require(!r.contains(0));
+                snn_require(!r.remove(0));
+            }
+            {
+                // Array container to bitmap container and back.
+                set::roaring r;
+                for (u32 i = 0; i < 10'000; ++i)
+                {
+                    snn_require(r.insert(i * 2));
+                }
+                snn_require(r.count() == 10'000);
+                snn_require(r.container_count() == 1);
+                snn_require(r.contains(19'998));
+                snn_require(!r.contains(19'999));
+
+                for (u32 i = 0; i < 9'000; ++i)
+                {
+                    snn_require(r.remove(i * 2));
+                }
+                snn_require(r.count() == 1'000);
+                snn_require(r.range().front().value() == 18'000);
+
+                for (u32 i = 9'000; i < 10'000; ++i)
+                {
+                    snn_require(r.remove(i * 2));
+                }
+                snn_require(r.is_empty());
+                snn_require(r.container_count() == 0);
+            }
+            {
+                // Compare with a sorted set.
+                generator gen{123};
+
+                for (const u32 max : {1'000u, 70'000u, 1'000'000u, 100'000'000u})
+                {
+                    set::roaring a;
+                    set::roaring b;
+                    set::sorted<u32> sa;
+                    set::sorted<u32> sb;
+
+                    for (usize i = 0; i < 20'000; ++i)
+                    {
+                        const u32 v = gen.next(max);
+                        snn_require(a.insert(v) == sa.insert(v).was_inserted());
+                        const u32 w = gen.next(max);
+                        snn_require(b.insert(w) == sb.insert(w).was_inserted());
+                    }
+                    for (usize i = 0; i < 5'000; ++i)
+                    {
+                        const u32 v = gen.next(max);
+                        snn_require(a.remove(v) == sa.remove(v));
+                    }
+                    snn_require(is_same(a, sa));
+                    snn_require(is_same(b, sb));
+
+                    set::sorted<u32> intersection;
+                    set::sorted<u32> difference;
+                    set::sorted<u32> union_ = sa;
+                    for (const u32 v : sa)
+                    {
+                        if (sb.contains(v))
+                        {
+                            intersection.insert(v);
+                        }
+                        else
+                        {
+                            difference.insert(v);
+                        }
+                    }
+                    for (const u32 v : sb)
+                    {
+                        union_.insert(v);
+                    }
+
+                    snn_require(a.count_and(b) == intersection.count());
+                    snn_require(b.count_and(a) == intersection.count());
+
+                    set::roaring c = a;
+                    c &= b;
+                    snn_require(is_same(c, intersection));
+
+                    c = b;
+                    c &= a;
+                    snn_require(is_same(c, intersection));
+
+                    c = a;
+                    c |= b;
+                    snn_require(is_same(c, union_));
+
+                    c = b;
+                    c |= a;
+                    snn_require(is_same(c, union_));
+
+                    c = a;
+                    c.and_not(b);
+                    snn_require(is_same(c, difference));
+
+                    c.and_not(c);
+                    snn_require(c.is_empty());
+                }
+            }
+            {
+                // Mixed container types.
+                set::roaring dense;
+                for (u32 i = 0; i < 65'536; i += 3)
+                {
+                    dense.insert(i);
+                }
+                set::roaring sparse{0, 1, 2, 3, 6, 65'535, 65'536};
+
+                snn_require(dense.count_and(sparse) == 4);
+                snn_require(sparse.count_and(dense) == 4);
+
+                set::roaring c = sparse;
+                c &= dense;
+                snn_require(c == set::roaring{0, 3, 6, 65'535});
+
+                c = dense;
+                c &= sparse;
+                snn_require(c == set::roaring{0, 3, 6, 65'535});
+
+                c = dense;
+                c |= sparse;
+                snn_require(c.count() == dense.count() + 3);
+
+                c = dense;
+                c.and_not(sparse);
+                snn_require(c.count() == dense.count() - 4);
+
+                c = sparse;
+                c.and_not(dense);
+                snn_require(c == set::roaring{1, 2, 65'536});
+
+                swap(c, dense);
+                snn_require(c.count() == 21'846);
+                c.clear();
+                snn_require(c.is_empty());
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_roaring());
+    }
+}
@@ -0,0 +1,28 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Small set
+
+// Stores up to `N` keys inline (like `vec<T, SmallCapacity>`) and finds them with a linear scan,
+// which is faster than hashing for a handful of keys. Beyond `N` keys an open addressing hash
+// table is used to index the keys (which are still stored contiguously).
+
+// Removing a key moves the last key into its place, iteration order is unspecified.
+
+#pragma once
+
+#include "snn-core/detail/small/table.hh"
+#include "snn-core/fn/common.hh"
+#include "snn-core/set/facade.hh"
+#include <functional> // hash
+
+namespace snn::set
+{
+    // ## Aliases
+
+    // ### small
+
+    template <typename Key, usize N, typename Hash = std::hash<Key>,
+              typename KeyEqual = fn::equal_to>
+    using small = facade<snn::detail::small::table<Key, void, N, Hash, KeyEqual>>;
+}
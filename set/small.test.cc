@@ -0,0 +1,181 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/set/small.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/algo/count.hh"
+#include "snn-core/set/unsorted.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // Up to 4 keys are stored inline.
+            set::small<str, 4> set = {"One", "Two", "Three"};
+
+            snn_require(set);
+            snn_require(set.count() == 3);
+
+            snn_require(set.contains("One"));
+            snn_require(set.contains("Two"));
+            snn_require(set.contains("Three"));
+            snn_require(!set.contains("Four"));
+
+            snn_require(!set.insert("One"));
+            snn_require(set.insert("Four"));
+
+            // Beyond 4 keys a hash table is used to find the keys.
+            snn_require(set.insert("Five"));
+            snn_require(set.count() == 5);
+            snn_require(set.contains("One"));
+            snn_require(set.contains("Five"));
+
+            snn_require(set.remove("One"));
+            snn_require(!set.remove("One"));
+            snn_require(!set.contains("One"));
+            snn_require(set.count() == 4);
+
+            auto rng = set.range();
+            static_assert(bidirectional_range<decltype(rng)>);
+
+            // Testing only (inefficient):
+            snn_require(algo::count(rng) == 4);
+            snn_require(algo::count(rng, "Two") == 1);
+            snn_require(algo::count(rng, "One") == 0);
+
+            return true;
+        }
+
+        // Compare with `set::unsorted` (random inserts and removes).
+        template <usize N>
+        bool test_small_random()
+        {
+            set::small<u32, N> small;
+            set::unsorted<u32> reference;
+
+            u32 state = 123;
+            for (usize i = 0; i < 20'000; ++i)
+            {
+                state         = (state * 1'103'515'245) + 12'345;
+                const u32 key = (state >> 16) % 300;
+
+                if ((state >> 8) % 3 == 0)
+                {
+                    snn_require(small.remove(key) == reference.remove(key));
+                }
+                else
+                {
+                    snn_require(static_cast<bool>(small.insert(key)) ==
+                                static_cast<bool>(reference.insert(key)));
+                }
+                snn_require(small.count() == reference.count());
+
+                if (i % 1'000 == 0)
+                {
+                    for (u32 k = 0; k < 300; ++k)
+                    {
+                        snn_require(small.contains(k) == reference.contains(k));
+                    }
+                }
+            }
+
+            // Every key once.
+            usize count = 0;
+            for (const u32 key : small)
+            {
+                snn_require(reference.contains(key));
+                ++count;
+            }
+            snn_require(count == reference.count());
+
+            return true;
+        }
+
+        bool test_small()
+        {
+            {
+                set::small<int, 2> set;
+                snn_require(!set);
+                snn_require(set.is_empty());
+                snn_require(!set.contains(1));
+                snn_require(!set.remove(1));
+
+                // Clustered keys (same low bits).
+                for (int i = 0; i < 100; ++i)
+                {
+                    snn_require(set.insert(i * 1024));
+                }
+                snn_require(set.count() == 100);
+                for (int i = 0; i < 100; ++i)
+                {
+                    snn_require(set.contains(i * 1024));
+                    snn_require(!set.contains((i * 1024) + 1));
+                }
+
+                // Remove every other key.
+                for (int i = 0; i < 100; i += 2)
+                {
+                    snn_require(set.remove(i * 1024));
+                }
+                snn_require(set.count() == 50);
+                for (int i = 0; i < 100; ++i)
+                {
+                    snn_require(set.contains(i * 1024) == (i % 2 == 1));
+                }
+
+                set::small<int, 2> other{init::reserve, 10};
+                other.insert_inplace(7);
+                swap(set, other);
+                snn_require(set.count() == 1);
+                snn_require(set.contains(7));
+                snn_require(other.count() == 50);
+
+                other.clear();
+                snn_require(other.is_empty());
+                snn_require(other.insert(3));
+                snn_require(other.contains(3));
+            }
+            {
+                // Copy and move.
+                set::small<str, 2> a = {"a", "b", "c"};
+                set::small<str, 2> b = a;
+                snn_require(b.count() == 3);
+                snn_require(b.contains("c"));
+
+                set::small<str, 2> c = std::move(a);
+                snn_require(c.count() == 3);
+                snn_require(c.contains("a"));
+
+                set::small<str, 2> d = {"x"};
+                d                    = std::move(c);
+                snn_require(d.count() == 3);
+                snn_require(d.contains("b"));
+                d = b;
+                snn_require(d.count() == 3);
+            }
+            {
+                // Duplicates in the initializer list.
+                const set::small<int, 8> set = {1, 2, 2, 3, 1};
+                snn_require(set.count() == 3);
+            }
+
+            snn_require(test_small_random<1>());
+            snn_require(test_small_random<8>());
+            snn_require(test_small_random<512>());
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_small());
+    }
+}
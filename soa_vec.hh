@@ -0,0 +1,873 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Structure of arrays vector
+
+// One contiguous column per field, all columns in a single allocation. Loops that only touch one
+// field (`column<Index>()`) read no bytes of the other fields, which makes them cache friendly and
+// easy for the compiler to vectorize.
+
+// Rows are accessed through a proxy (`at(...)`, `front(...)`, `back(...)`, iterators and `range()`)
+// that references one element in each column, use `get<Index>(row)` or structured bindings.
+
+// `soa_vec<Fields...>` uses `mem::allocator`, use `basic_soa_vec<Alloc, Fields...>` for another
+// allocator (e.g. `mem::resource_allocator`).
+
+// Rows can't be swapped in place, use `sort_permutation<Index>(...)` with `apply_permutation(...)`
+// (or `sort_by<Index>(...)`) to sort all columns by one column.
+
+#pragma once
+
+#include "snn-core/array_view.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/optional.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/algo/sort.hh"
+#include "snn-core/fn/common.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/construct.hh"
+#include "snn-core/mem/destruct.hh"
+#include "snn-core/mem/destruct_n.hh"
+#include "snn-core/mem/relocate.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/range/random_access.hh"
+
+namespace snn
+{
+    namespace detail::soa_vec
+    {
+        // ### row
+
+        // A row is a reference type, copying a row doesn't copy any fields.
+
+        template <typename... Ts>
+        class row final
+        {
+          public:
+            constexpr explicit row(Ts&... fields) noexcept
+                : fields_{&fields...}
+            {
+            }
+
+            // Non-const to const.
+            template <typename... Us>
+                requires(sizeof...(Us) == sizeof...(Ts) && (std::is_same_v<const Us, Ts> && ...) &&
+                         !(std::is_same_v<Us, Ts> && ...))
+            constexpr row(const row<Us...>& other) noexcept
+                : fields_{other.fields_}
+            {
+            }
+
+            template <usize Index>
+            [[nodiscard]] constexpr auto& get() const noexcept
+            {
+                return *std::get<Index>(fields_);
+            }
+
+          private:
+            template <typename...>
+            friend class row;
+
+            std::tuple<Ts*...> fields_;
+        };
+
+        template <usize Index, typename... Ts>
+        [[nodiscard]] constexpr auto& get(const row<Ts...>& r) noexcept
+        {
+            return r.template get<Index>();
+        }
+
+        // ### block
+
+        // Allocation unit, aligned for the most aligned field.
+
+        template <typename... Fields>
+        inline constexpr usize alignment = [] {
+            usize a = 1;
+            ((a = math::max(a, alignof(Fields))), ...);
+            return a;
+        }();
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        template <usize Alignment>
+        struct alignas(Alignment) block final
+        {
+            byte data[Alignment];
+        };
+
+        SNN_DIAGNOSTIC_POP
+
+        template <typename... Fields>
+        using block_for = block<alignment<Fields...>>;
+
+        // ### iterator
+
+        // Random access iterator, dereferencing returns a row (by value).
+
+        template <typename SoaVec>
+        class iterator final
+        {
+          public:
+            using iterator_category = std::random_access_iterator_tag;
+            using difference_type   = isize;
+
+            // A row is a reference type, so `reference` and `value_type` are the same type.
+            using value_type = decltype(std::declval<SoaVec&>().at(usize{}, assume::within_bounds));
+            using reference  = value_type;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr explicit iterator(SoaVec* const soa, const usize index) noexcept
+                : soa_{soa},
+                  index_{index}
+            {
+            }
+
+            constexpr reference operator*() const noexcept
+            {
+                return soa_->at(index_, assume::within_bounds);
+            }
+
+            constexpr iterator& operator++() noexcept
+            {
+                ++index_;
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept
+            {
+                iterator tmp{*this};
+                ++index_;
+                return tmp;
+            }
+
+            constexpr iterator& operator--() noexcept
+            {
+                --index_;
+                return *this;
+            }
+
+            constexpr iterator operator--(int) noexcept
+            {
+                iterator tmp{*this};
+                --index_;
+                return tmp;
+            }
+
+            constexpr iterator& operator+=(const isize n) noexcept
+            {
+                index_ += static_cast<usize>(n);
+                return *this;
+            }
+
+            constexpr iterator& operator-=(const isize n) noexcept
+            {
+                index_ -= static_cast<usize>(n);
+                return *this;
+            }
+
+            constexpr reference operator[](const isize n) const noexcept
+            {
+                return *(*this + n);
+            }
+
+            constexpr iterator operator+(const isize n) const noexcept
+            {
+                return iterator{soa_, index_ + static_cast<usize>(n)};
+            }
+
+            friend constexpr iterator operator+(const isize n, const iterator& it) noexcept
+            {
+                return it + n;
+            }
+
+            constexpr iterator operator-(const isize n) const noexcept
+            {
+                return iterator{soa_, index_ - static_cast<usize>(n)};
+            }
+
+            constexpr isize operator-(const iterator& other) const noexcept
+            {
+                return static_cast<isize>(index_ - other.index_);
+            }
+
+            constexpr bool operator==(const iterator& other) const noexcept
+            {
+                return index_ == other.index_;
+            }
+
+            constexpr auto operator<=>(const iterator& other) const noexcept
+            {
+                return index_ <=> other.index_;
+            }
+
+          private:
+            SoaVec* soa_{nullptr};
+            usize index_{0};
+        };
+    }
+
+    // ## Classes
+
+    // ### basic_soa_vec
+
+    // `Alloc` allocates `block_type` (the columns are placed in an array of blocks), e.g.
+    // `mem::resource_allocator<soa_vec<Fields...>::block_type, Resource>`.
+
+    template <typename Alloc, typename... Fields>
+        requires(sizeof...(Fields) > 0 &&
+                 ((std::is_nothrow_move_constructible_v<Fields> &&
+                   std::is_same_v<std::remove_cvref_t<Fields>, Fields>) &&
+                  ...))
+    class basic_soa_vec final
+    {
+      public:
+        // #### Types
+
+        using allocator_type = Alloc;
+        using block_type     = detail::soa_vec::block_for<Fields...>;
+
+        template <usize Index>
+        using field_type = std::tuple_element_t<Index, std::tuple<Fields...>>;
+
+        using row_type       = detail::soa_vec::row<Fields...>;
+        using const_row_type = detail::soa_vec::row<const Fields...>;
+
+        using iterator       = detail::soa_vec::iterator<basic_soa_vec>;
+        using const_iterator = detail::soa_vec::iterator<const basic_soa_vec>;
+
+        using trivially_relocatable_type = trivially_relocatable_if_t<basic_soa_vec, Alloc>;
+
+        // #### Constants
+
+        static constexpr usize field_count = sizeof...(Fields);
+
+        // #### Default constructor
+
+        basic_soa_vec() noexcept = default;
+
+        // #### Explicit constructors
+
+        explicit basic_soa_vec(init::reserve_t, const usize capacity)
+            : basic_soa_vec{}
+        {
+            reserve(capacity);
+        }
+
+        explicit basic_soa_vec(const Alloc& alloc) noexcept
+            : alloc_{alloc}
+        {
+        }
+
+        explicit basic_soa_vec(init::reserve_t, const usize capacity, const Alloc& alloc)
+            : basic_soa_vec{alloc}
+        {
+            reserve(capacity);
+        }
+
+        // #### Copy/move-assignment/constructor
+
+        // A copy uses a copy of the allocator (e.g. the same resource), copy assignment keeps the
+        // current allocator, move and swap exchange allocators along with the memory.
+
+        basic_soa_vec(const basic_soa_vec& other)
+            : basic_soa_vec{other.alloc_}
+        {
+            append_(other);
+        }
+
+        basic_soa_vec& operator=(const basic_soa_vec& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                append_(other);
+            }
+            return *this;
+        }
+
+        basic_soa_vec(basic_soa_vec&& other) noexcept
+            : columns_{std::exchange(other.columns_, columns_type{})},
+              count_{std::exchange(other.count_, 0)},
+              capacity_{std::exchange(other.capacity_, 0)},
+              alloc_{other.alloc_}
+        {
+        }
+
+        basic_soa_vec& operator=(basic_soa_vec&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        // #### Destructor
+
+        ~basic_soa_vec()
+        {
+            clear();
+            deallocate_(columns_, capacity_);
+        }
+
+        // #### Allocator
+
+        [[nodiscard]] const Alloc& allocator() const noexcept
+        {
+            return alloc_;
+        }
+
+        // #### Explicit conversion operators
+
+        explicit operator bool() const noexcept
+        {
+            return count_ > 0;
+        }
+
+        // #### Iterators
+
+        [[nodiscard]] iterator begin() noexcept
+        {
+            return iterator{this, 0};
+        }
+
+        [[nodiscard]] iterator end() noexcept
+        {
+            return iterator{this, count_};
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return const_iterator{this, 0};
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return const_iterator{this, count_};
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        // #### Columns
+
+        template <usize Index>
+            requires(Index < field_count)
+        [[nodiscard]] array_view<field_type<Index>> column() noexcept
+        {
+            return array_view<field_type<Index>>{std::get<Index>(columns_), count_};
+        }
+
+        template <usize Index>
+            requires(Index < field_count)
+        [[nodiscard]] array_view<const field_type<Index>> column() const noexcept
+        {
+            return array_view<const field_type<Index>>{std::get<Index>(columns_), count_};
+        }
+
+        // #### Single row access
+
+        [[nodiscard]] optional<row_type> at(const usize pos) noexcept
+        {
+            if (pos < count_)
+            {
+                return row_(pos);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] optional<const_row_type> at(const usize pos) const noexcept
+        {
+            if (pos < count_)
+            {
+                return row_(pos);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] row_type at(const usize pos, assume::within_bounds_t) noexcept
+        {
+            snn_assert(pos < count_);
+            return row_(pos);
+        }
+
+        [[nodiscard]] const_row_type at(const usize pos, assume::within_bounds_t) const noexcept
+        {
+            snn_assert(pos < count_);
+            return row_(pos);
+        }
+
+        [[nodiscard]] optional<row_type> back() noexcept
+        {
+            if (count_ > 0)
+            {
+                return row_(count_ - 1);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] optional<const_row_type> back() const noexcept
+        {
+            if (count_ > 0)
+            {
+                return row_(count_ - 1);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] row_type back(assume::not_empty_t) noexcept
+        {
+            snn_assert(count_ > 0);
+            return row_(count_ - 1);
+        }
+
+        [[nodiscard]] const_row_type back(assume::not_empty_t) const noexcept
+        {
+            snn_assert(count_ > 0);
+            return row_(count_ - 1);
+        }
+
+        [[nodiscard]] optional<row_type> front() noexcept
+        {
+            if (count_ > 0)
+            {
+                return row_(0);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] optional<const_row_type> front() const noexcept
+        {
+            if (count_ > 0)
+            {
+                return row_(0);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] row_type front(assume::not_empty_t) noexcept
+        {
+            snn_assert(count_ > 0);
+            return row_(0);
+        }
+
+        [[nodiscard]] const_row_type front(assume::not_empty_t) const noexcept
+        {
+            snn_assert(count_ > 0);
+            return row_(0);
+        }
+
+        // #### Append row
+
+        // One value per field.
+
+        void append(Fields... values)
+        {
+            append_inplace(std::move(values)...);
+        }
+
+        // One argument per field, each field is constructed from its argument.
+
+        template <typename... Args>
+            requires(sizeof...(Args) == field_count &&
+                     (brace_constructible_from<Fields, Args &&> && ...))
+        void append_inplace(Args&&... args)
+        {
+            if (count_ < capacity_) [[likely]]
+            {
+                construct_row_(columns_, count_, std::index_sequence_for<Fields...>{},
+                               std::forward<Args>(args)...);
+                ++count_;
+            }
+            else
+            {
+                // Arguments could come from within self, use slow grow path.
+                const usize capacity = check_capacity_(recommend_capacity_());
+                columns_type columns = allocate_(capacity);
+                try
+                {
+                    construct_row_(columns, count_, std::index_sequence_for<Fields...>{},
+                                   std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    deallocate_(columns, capacity);
+                    throw;
+                }
+                replace_(columns, capacity);
+                ++count_;
+            }
+        }
+
+        // #### Count
+
+        [[nodiscard]] usize count() const noexcept
+        {
+            return count_;
+        }
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            return count_ == 0;
+        }
+
+        // #### Capacity
+
+        [[nodiscard]] usize capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        void reserve(const usize capacity)
+        {
+            if (capacity > capacity_)
+            {
+                const usize new_capacity =
+                    check_capacity_(math::max(capacity, recommend_capacity_()));
+                replace_(allocate_(new_capacity), new_capacity);
+            }
+        }
+
+        void reserve_append(const usize append_count)
+        {
+            reserve(math::add_with_saturation(count_, append_count));
+        }
+
+        // #### Range
+
+        [[nodiscard]] auto range() noexcept
+        {
+            return range::random_access{init::from, begin(), end()};
+        }
+
+        [[nodiscard]] auto range() const noexcept
+        {
+            return range::random_access{init::from, begin(), end()};
+        }
+
+        // #### Modifiers
+
+        void clear() noexcept
+        {
+            truncate(0);
+        }
+
+        void drop_back(assume::not_empty_t) noexcept
+        {
+            snn_assert(count_ > 0);
+            truncate(count_ - 1);
+        }
+
+        void truncate(const usize count) noexcept
+        {
+            if (count < count_)
+            {
+                destruct_n_(count, count_ - count, std::index_sequence_for<Fields...>{});
+                count_ = count;
+            }
+        }
+
+        // #### Sort
+
+        // Returns the row order that sorts the rows by a single column. The sort is stable, equal
+        // values keep their relative order, so sorting by a secondary column first and then by a
+        // primary column sorts by both.
+
+        template <usize Index, typename TwoArgPred = fn::less_than>
+            requires(Index < field_count)
+        [[nodiscard]] vec<usize> sort_permutation(TwoArgPred is_less = TwoArgPred{}) const
+        {
+            vec<usize> permutation{init::reserve, count_};
+            for (usize i = 0; i < count_; ++i)
+            {
+                permutation.append(i);
+            }
+
+            const field_type<Index>* const col = std::get<Index>(columns_);
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            algo::sort(permutation.range(), [col, &is_less](const usize a, const usize b) {
+                if (is_less(col[a], col[b]))
+                {
+                    return true;
+                }
+                if (is_less(col[b], col[a]))
+                {
+                    return false;
+                }
+                return a < b;
+            });
+
+            SNN_DIAGNOSTIC_POP
+
+            return permutation;
+        }
+
+        // Reorder all columns, row `i` becomes the row that was at `permutation[i]`. The
+        // permutation must contain every position in `[0, count())` exactly once.
+
+        void apply_permutation(const array_view<const usize> permutation)
+        {
+            if (permutation.count() != count_)
+            {
+                throw_or_abort(generic::error::invalid_value);
+            }
+
+            if (count_ == 0)
+            {
+                return;
+            }
+
+            vec<bool> seen{init::reserve, count_};
+            for (usize i = 0; i < count_; ++i)
+            {
+                seen.append(false);
+            }
+            for (const usize pos : permutation)
+            {
+                if (pos >= count_ || seen.at(pos, assume::within_bounds))
+                {
+                    throw_or_abort(generic::error::invalid_value);
+                }
+                seen.at(pos, assume::within_bounds) = true;
+            }
+
+            columns_type columns = allocate_(capacity_);
+            relocate_permuted_(columns, permutation, std::index_sequence_for<Fields...>{});
+            deallocate_(columns_, capacity_);
+            columns_ = columns;
+        }
+
+        template <usize Index, typename TwoArgPred = fn::less_than>
+            requires(Index < field_count)
+        void sort_by(TwoArgPred is_less = TwoArgPred{})
+        {
+            const auto permutation = sort_permutation<Index>(std::move(is_less));
+            apply_permutation(permutation.view());
+        }
+
+        // #### Swap
+
+        void swap(basic_soa_vec& other) noexcept
+        {
+            // This works even if this == &other.
+            std::swap(columns_, other.columns_);
+            std::swap(count_, other.count_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(alloc_, other.alloc_); // Memory follows its allocator.
+        }
+
+      private:
+        using columns_type = std::tuple<Fields*...>;
+
+        // All columns are in a single allocation (the first column is at the start).
+        columns_type columns_{};
+        usize count_{0};
+        usize capacity_{0};
+        [[no_unique_address]] Alloc alloc_;
+
+        static constexpr usize alignment_ = detail::soa_vec::alignment<Fields...>;
+        static constexpr usize row_size_  = (sizeof(Fields) + ...);
+
+        // Leave room for alignment padding between columns.
+        static constexpr usize max_capacity_ =
+            (constant::limit<iptrdiff>::max - (alignment_ * field_count)) / row_size_;
+
+        static constexpr usize align_up_(const usize size, const usize alignment) noexcept
+        {
+            return (size + (alignment - 1)) & ~(alignment - 1);
+        }
+
+        static constexpr usize byte_size_(const usize capacity) noexcept
+        {
+            usize size = 0;
+            ((size = align_up_(size, alignof(Fields)) + (capacity * sizeof(Fields))), ...);
+            return size;
+        }
+
+        static constexpr usize block_count_(const usize capacity) noexcept
+        {
+            return align_up_(byte_size_(capacity), alignment_) / alignment_;
+        }
+
+        static constexpr usize check_capacity_(const usize capacity)
+        {
+            if (capacity <= max_capacity_)
+            {
+                return capacity;
+            }
+            throw_or_abort(generic::error::capacity_would_exceed_max_capacity);
+        }
+
+        usize recommend_capacity_() const noexcept
+        {
+            // Always return a capacity greater than the current count.
+            return count_ + ((count_ + 2) / 2); // ~1.5x
+        }
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        row_type row_(const usize pos) noexcept
+        {
+            return std::apply([pos](Fields*... cols) { return row_type{cols[pos]...}; }, columns_);
+        }
+
+        const_row_type row_(const usize pos) const noexcept
+        {
+            return std::apply([pos](const Fields*... cols) { return const_row_type{cols[pos]...}; },
+                              columns_);
+        }
+
+        columns_type allocate_(const usize capacity)
+        {
+            snn_should(capacity > 0 && capacity <= max_capacity_);
+
+            block_type* const blocks = alloc_.allocate(not_zero{block_count_(capacity)}).value();
+            byte* const data         = reinterpret_cast<byte*>(blocks);
+            columns_type columns;
+            usize offset = 0;
+            [&]<usize... Index>(std::index_sequence<Index...>) {
+                ((offset                   = align_up_(offset, alignof(Fields)),
+                  std::get<Index>(columns) = reinterpret_cast<Fields*>(data + offset),
+                  offset += capacity * sizeof(Fields)),
+                 ...);
+            }(std::index_sequence_for<Fields...>{});
+            return columns;
+        }
+
+        void deallocate_(const columns_type& columns, const usize capacity) noexcept
+        {
+            if (capacity > 0)
+            {
+                // The first column is at the start of the blocks.
+                alloc_.deallocate(reinterpret_cast<block_type*>(std::get<0>(columns)),
+                                  block_count_(capacity));
+            }
+        }
+
+        // Relocate all rows to `columns` (with `capacity`) and release the current allocation.
+        void replace_(const columns_type& columns, const usize capacity) noexcept
+        {
+            if (count_ > 0)
+            {
+                [&]<usize... Index>(std::index_sequence<Index...>) {
+                    (mem::relocate(not_null{std::get<Index>(columns_)},
+                                   not_null{std::get<Index>(columns_) + count_},
+                                   not_null{std::get<Index>(columns)}),
+                     ...);
+                }(std::index_sequence_for<Fields...>{});
+            }
+            deallocate_(columns_, capacity_);
+            columns_  = columns;
+            capacity_ = capacity;
+        }
+
+        template <usize... Index, typename... Args>
+        static void construct_row_(const columns_type& columns, const usize pos,
+                                   std::index_sequence<Index...>, Args&&... args)
+        {
+            // If a field constructor throws, the fields already constructed are destructed.
+            usize constructed = 0;
+            try
+            {
+                ((mem::construct(not_null{std::get<Index>(columns) + pos},
+                                 std::forward<Args>(args)),
+                  ++constructed),
+                 ...);
+            }
+            catch (...)
+            {
+                ((Index < constructed ? mem::destruct(not_null{std::get<Index>(columns) + pos})
+                                      : void()),
+                 ...);
+                throw;
+            }
+        }
+
+        template <usize... Index>
+        void destruct_n_(const usize pos, const usize count, std::index_sequence<Index...>) noexcept
+        {
+            (mem::destruct_n(std::get<Index>(columns_) + pos, count), ...);
+        }
+
+        template <usize... Index>
+        void relocate_permuted_(const columns_type& columns,
+                                const array_view<const usize> permutation,
+                                std::index_sequence<Index...>) noexcept
+        {
+            (
+                [&] {
+                    auto* const from = std::get<Index>(columns_);
+                    auto* const to   = std::get<Index>(columns);
+                    for (usize i = 0; i < count_; ++i)
+                    {
+                        auto* const src = from + permutation.at(i, assume::within_bounds);
+                        mem::relocate(not_null{src}, not_null{src + 1}, not_null{to + i});
+                    }
+                }(),
+                ...);
+        }
+
+        SNN_DIAGNOSTIC_POP
+
+        void append_(const basic_soa_vec& other)
+        {
+            reserve_append(other.count_);
+            for (usize i = 0; i < other.count_; ++i)
+            {
+                append_row_(other.row_(i), std::index_sequence_for<Fields...>{});
+            }
+        }
+
+        template <usize... Index>
+        void append_row_(const const_row_type r, std::index_sequence<Index...>)
+        {
+            append_inplace(r.template get<Index>()...);
+        }
+    };
+
+    // ### soa_vec
+
+    template <typename... Fields>
+    using soa_vec = basic_soa_vec<mem::allocator<detail::soa_vec::block_for<Fields...>>, Fields...>;
+
+    // ## Functions
+
+    // ### swap
+
+    template <typename Alloc, typename... Fields>
+    void swap(basic_soa_vec<Alloc, Fields...>& a, basic_soa_vec<Alloc, Fields...>& b) noexcept
+    {
+        a.swap(b);
+    }
+}
+
+// ## Specializations
+
+// ### std::tuple_element
+
+template <std::size_t Index, typename... Ts>
+    requires(Index < sizeof...(Ts))
+struct std::tuple_element<Index, snn::detail::soa_vec::row<Ts...>>
+{
+    using type = std::tuple_element_t<Index, std::tuple<Ts...>>&;
+};
+
+// ### std::tuple_size
+
+template <typename... Ts>
+struct std::tuple_size<snn::detail::soa_vec::row<Ts...>>
+    : public std::integral_constant<std::size_t, sizeof...(Ts)>
+{
+};
@@ -0,0 +1,275 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/soa_vec.hh"
+
+#include "snn-core/array.hh"
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+#include "snn-core/algo/count_if.hh"
+#include "snn-core/algo/find_greater_than_or_equal_to.hh"
+#include "snn-core/algo/is_sorted.hh"
+#include "snn-core/algo/sum.hh"
+#include "snn-core/mem/pool_resource.hh"
+#include "snn-core/mem/resource_allocator.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            // Id, score, name.
+            soa_vec<u32, double, str> players;
+            players.append(7, 12.5, "Gandalf");
+            players.append_inplace(3u, 18.0, "Bilbo");
+            players.append(5, 9.5, "Frodo");
+            snn_require(players.count() == 3);
+
+            // A single column (contiguous).
+            const array_view<double> scores = players.column<1>();
+            snn_require(scores.count() == 3);
+            snn_require(algo::sum(scores.range(), 0.0) == 40.0);
+
+            // A single row.
+            auto [id, score, name] = players.at(1, assume::within_bounds);
+            snn_require(id == 3);
+            snn_require(score == 18.0);
+            snn_require(name == "Bilbo");
+            score = 20.0; // The row references the columns.
+            snn_require(players.column<1>().at(1).value() == 20.0);
+
+            // Rows through a range.
+            snn_require(algo::count_if(players.range(), [](const auto row) {
+                            return get<1>(row) > 10.0;
+                        }) == 2);
+
+            // Sort all columns by the id column.
+            players.sort_by<0>();
+            snn_require(algo::is_sorted(players.column<0>().range()));
+            snn_require(get<2>(players.front(assume::not_empty)) == "Bilbo");
+            snn_require(get<2>(players.back(assume::not_empty)) == "Gandalf");
+
+            return true;
+        }
+
+        bool test_soa_vec()
+        {
+            static_assert(soa_vec<int, str>::field_count == 2);
+            static_assert(std::is_same_v<soa_vec<int, str>::field_type<1>, str>);
+            static_assert(is_trivially_relocatable_v<soa_vec<int, str>>);
+            static_assert(sizeof(soa_vec<u8, u64, str>) == sizeof(void*) * 5);
+
+            {
+                soa_vec<u8, u64, str> v;
+                snn_require(v.is_empty());
+                snn_require(!v);
+                snn_require(v.capacity() == 0);
+                snn_require(!v.at(0));
+                snn_require(!v.front());
+                snn_require(!v.back());
+                snn_require(v.column<0>().is_empty());
+                snn_require(v.range().is_empty());
+
+                // Grow (every column is aligned).
+                for (usize i = 0; i < 1000; ++i)
+                {
+                    v.append(static_cast<u8>(i), i * 3, "A longer string that goes on the heap.");
+                }
+                snn_require(v.count() == 1000);
+                snn_require(v.capacity() >= 1000);
+                snn_require((reinterpret_cast<uptr>(v.column<1>().begin()) % alignof(u64)) == 0);
+                snn_require((reinterpret_cast<uptr>(v.column<2>().begin()) % alignof(str)) == 0);
+                snn_require(v.column<0>().at(999).value() == static_cast<u8>(999));
+                snn_require(v.column<1>().at(999).value() == 2997);
+                snn_require(v.column<2>().at(999).value() ==
+                            "A longer string that goes on the heap.");
+
+                // Append a row from self (while growing).
+                while (v.count() < v.capacity())
+                {
+                    v.append(0, 0, "");
+                }
+                const auto row = v.front(assume::not_empty);
+                v.append_inplace(get<0>(row), get<1>(row), get<2>(row));
+                snn_require(get<2>(v.back(assume::not_empty)) ==
+                            "A longer string that goes on the heap.");
+
+                // Copy/move/swap.
+                soa_vec<u8, u64, str> copy{v};
+                snn_require(copy.count() == v.count());
+                snn_require(copy.column<2>() == v.column<2>());
+
+                soa_vec<u8, u64, str> moved{std::move(copy)};
+                snn_require(copy.is_empty());
+                snn_require(moved.count() == v.count());
+
+                soa_vec<u8, u64, str> other;
+                other.append(1, 2, "abc");
+                swap(other, moved);
+                snn_require(other.count() == v.count());
+                snn_require(moved.count() == 1);
+
+                moved = v;
+                snn_require(moved.count() == v.count());
+                moved = soa_vec<u8, u64, str>{};
+                snn_require(moved.is_empty());
+
+                // Drop/truncate.
+                v.drop_back(assume::not_empty);
+                v.truncate(10);
+                snn_require(v.count() == 10);
+                v.truncate(100); // No-op.
+                snn_require(v.count() == 10);
+                v.clear();
+                snn_require(v.is_empty());
+            }
+            {
+                // Const access.
+                soa_vec<int, int> v{init::reserve, 3};
+                snn_require(v.capacity() >= 3);
+                v.append(1, 10);
+                v.append(2, 20);
+
+                const auto& cv = v;
+                const auto r   = cv.at(1).value();
+                static_assert(std::is_same_v<decltype(get<0>(r)), const int&>);
+                snn_require(get<0>(r) == 2 && get<1>(r) == 20);
+                static_assert(std::is_same_v<decltype(cv.column<0>()), array_view<const int>>);
+
+                int sum = 0;
+                for (const auto row : cv)
+                {
+                    sum += get<0>(row) * get<1>(row);
+                }
+                snn_require(sum == 50);
+                snn_require(cv.end() - cv.begin() == 2);
+            }
+
+            return true;
+        }
+
+        bool test_sort()
+        {
+            soa_vec<int, str> v;
+            v.append(3, "c1");
+            v.append(1, "a1");
+            v.append(2, "b1");
+            v.append(1, "a2");
+            v.append(3, "c2");
+
+            // Stable.
+            const vec<usize> permutation = v.sort_permutation<0>();
+            snn_require(permutation == vec<usize>{1, 3, 2, 0, 4});
+
+            // Descending.
+            snn_require(v.sort_permutation<0>(fn::greater_than{}) == vec<usize>{0, 4, 2, 1, 3});
+
+            v.apply_permutation(permutation.view());
+            const array ascending{1, 1, 2, 3, 3};
+            snn_require(v.column<0>() == ascending.view());
+            snn_require(v.column<1>().at(0).value() == "a1");
+            snn_require(v.column<1>().at(1).value() == "a2");
+            snn_require(v.column<1>().at(4).value() == "c2");
+
+            v.sort_by<1>(fn::greater_than{});
+            const array descending{3, 3, 2, 1, 1};
+            snn_require(v.column<0>() == descending.view());
+            snn_require(v.column<1>().at(0).value() == "c2");
+
+            // Invalid permutations.
+            const array<usize, 3> too_short{0, 1, 2};
+            const array<usize, 5> out_of_bounds{0, 1, 2, 3, 5};
+            const array<usize, 5> duplicate{0, 1, 2, 3, 3};
+            snn_require_throws_code(v.apply_permutation(too_short), generic::error::invalid_value);
+            snn_require_throws_code(v.apply_permutation(out_of_bounds),
+                                    generic::error::invalid_value);
+            snn_require_throws_code(v.apply_permutation(duplicate), generic::error::invalid_value);
+            snn_require(v.column<0>() == descending.view()); // Unchanged.
+
+            return true;
+        }
+
+        bool test_iterator()
+        {
+            static_assert(std::random_access_iterator<soa_vec<int, str>::iterator>);
+            static_assert(std::random_access_iterator<soa_vec<int, str>::const_iterator>);
+
+            soa_vec<int, str> v;
+            v.append(1, "one");
+            v.append(3, "three");
+            v.append(5, "five");
+            v.append(7, "seven");
+
+            auto it = v.begin();
+            snn_require(get<0>(*it++) == 1);
+            snn_require(get<0>(*it) == 3);
+            snn_require(get<0>(*it--) == 3);
+            it += 3;
+            snn_require(get<1>(*it) == "seven");
+            it -= 2;
+            snn_require(get<0>(it[1]) == 5);
+            snn_require(get<0>(*(1 + it)) == 5);
+            snn_require(v.end() - it == 3);
+
+            // Binary search over the rows.
+            const auto is_less = [](const auto row, const int value) {
+                return get<0>(row) < value;
+            };
+            const soa_vec<int, str>& cv = v;
+            snn_require(algo::find_greater_than_or_equal_to(cv.range(), 4, is_less,
+                                                            assume::is_sorted)
+                            .value() == 2);
+            snn_require(algo::find_greater_than_or_equal_to(v.range(), 1, is_less,
+                                                            assume::is_sorted)
+                            .value() == 0);
+            snn_require(!algo::find_greater_than_or_equal_to(v.range(), 8, is_less,
+                                                             assume::is_sorted));
+
+            return true;
+        }
+
+        bool test_allocator()
+        {
+            static_assert(is_trivially_relocatable_v<soa_vec<u32, str>>);
+            static_assert(alignof(soa_vec<u8, u64>::block_type) == alignof(u64));
+
+            mem::pool_resource<> pool;
+
+            using block_type = soa_vec<u32, str>::block_type;
+            using allocator  = mem::resource_allocator<block_type, mem::pool_resource<>>;
+
+            basic_soa_vec<allocator, u32, str> v{allocator{pool}};
+            for (u32 i = 0; i < 50; ++i)
+            {
+                v.append(i, "A longer string that goes on the heap.");
+            }
+            snn_require(v.count() == 50);
+            snn_require(pool.chunk_count() > 0);
+            snn_require(get<1>(v.back(assume::not_empty)) ==
+                        "A longer string that goes on the heap.");
+
+            basic_soa_vec<allocator, u32, str> copy{v};
+            snn_require(copy.count() == 50);
+            snn_require(copy.column<0>() == v.column<0>());
+            snn_require(&copy.allocator().get_resource() == &pool);
+
+            v.sort_by<0>(fn::greater_than{});
+            snn_require(get<0>(v.front(assume::not_empty)) == 49);
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_soa_vec());
+        snn_require(app::test_sort());
+        snn_require(app::test_iterator());
+        snn_require(app::test_allocator());
+    }
+}
@@ -22,10 +22,25 @@ namespace snn
 
     // ### str/strbuf
 
+    namespace mem
+    {
+        template <typename T>
+            requires(std::is_trivially_copyable_v<T> && std::is_nothrow_default_constructible_v<T>)
+        class arena_allocator;
+
+        template <typename T>
+            requires(std::is_trivially_copyable_v<T> && std::is_nothrow_default_constructible_v<T>)
+        class trivial_allocator;
+    }
+
     namespace detail::strcore
     {
-        class buf;
+        template <typename Allocator>
+        class basic_buf;
         class sso;
+
+        using arena_buf = basic_buf<mem::arena_allocator<char>>;
+        using buf       = basic_buf<mem::trivial_allocator<char>>;
     }
 
     using str    = strcore<detail::strcore::sso>;
@@ -5,7 +5,7 @@
 
 // Owns a contiguous sequence of `char` objects.
 
-// Two strings are currently available (different buffers):
+// Three strings are currently available (different buffers):
 
 // `str` which is an alias for `strcore<detail::strcore::sso>`:
 // * Small string optimization (SSO).
@@ -15,6 +15,11 @@
 // * Without SSO.
 // * Not null-terminated.
 
+// `strcore<detail::strcore::arena_buf>`:
+// * Same as `strbuf`, but allocates from the `mem::arena` that is current when it first allocates
+//   (see `mem/arena_allocator.hh`).
+// * Freeing is a no-op, all memory is released when the arena is reset or destroyed.
+
 // `strcore` owns a buffer and is the interface for all strings.
 
 #pragma once
@@ -670,6 +670,26 @@ namespace snn::app
                 snn_require(s.find('e', 13).value_or_npos() == constant::npos);
             }
 
+            // find_any_of
+            {
+                T s{""};
+                snn_require(s.find_any_of("abc").value_or_npos() == constant::npos);
+                snn_require(s.find_any_of("").value_or_npos() == constant::npos);
+            }
+            {
+                T s{"One Two Three"};
+                snn_require(s.find_any_of("").value_or_npos() == constant::npos);
+                snn_require(s.find_any_of(" ").value_or_npos() == 3);
+                snn_require(s.find_any_of(" ", 4).value_or_npos() == 7);
+                snn_require(s.find_any_of("wT").value_or_npos() == 4);
+                snn_require(s.find_any_of("Tw", 5).value_or_npos() == 5);
+                snn_require(s.find_any_of("Tw", 6).value_or_npos() == 8);
+                snn_require(s.find_any_of("xyz").value_or_npos() == constant::npos);
+                snn_require(s.find_any_of("e", 13).value_or_npos() == constant::npos);
+                snn_require(s.find_any_of("e", 99).value_or_npos() == constant::npos);
+                snn_require(s.find_any_of("abcdefghijklmnopqrstuvwxyz").value_or_npos() == 1);
+            }
+
             // find_in_reverse
             {
                 T s{""};
@@ -3169,6 +3189,12 @@ namespace snn::app
                 usize pos2     = alt_haystack.find(alt_needle, start_pos);
                 snn_require(pos1 == pos2);
 
+                const cstrview chars = needle.view(0, random::number<usize>(0, 30));
+                const std::string_view alt_chars{chars.data().get(), chars.size()};
+                pos1 = haystack.find_any_of(chars, start_pos).value_or_npos();
+                pos2 = alt_haystack.find_first_of(alt_chars, start_pos);
+                snn_require(pos1 == pos2);
+
                 start_pos = random::number<usize>(0, size);
                 pos1      = haystack.find_in_reverse(needle, start_pos).value_or_npos();
                 pos2      = alt_haystack.rfind(alt_needle, start_pos);
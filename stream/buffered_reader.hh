@@ -7,10 +7,15 @@
 // `buffered_reader` is only in a state to clean up it's resources on destruction (basic exception
 // guarantee).
 
+// Consumed bytes are dropped from the front of the buffer before it is refilled, so memory use is
+// bounded by the longest string returned by `read_until()` (plus the read size) and not by the
+// total size of the stream.
+
 #pragma once
 
 #include "snn-core/result.hh"
 #include "snn-core/strcore.hh"
+#include "snn-core/vec.hh"
 #include "snn-core/generic/error.hh"
 #include "snn-core/math/common.hh"
 #include "snn-core/mem/raw/copy.hh"
@@ -102,6 +107,51 @@ namespace snn::stream
             return read_until<String>('\n');
         }
 
+        // #### Read lines
+
+        // Read all complete lines in the buffer (at least one line, refilling the buffer if
+        // needed). The lines (including the `'\n'` character) replace the contents of `lines` and
+        // are only valid until the next read call or until the `buffered_reader` is destroyed.
+        // Note that the last line before end-of-file (EOF) might not end with the `'\n'`
+        // character. Returns the number of lines, 0 on end-of-file (EOF).
+
+        [[nodiscard]] constexpr result<usize> read_lines(vec<cstrview>& lines)
+        {
+            lines.clear();
+
+            const auto res = read_until_<cstrview, char>('\n');
+            if (!res)
+            {
+                return res.error_code();
+            }
+
+            const cstrview first = res.value(assume::has_value);
+            if (first.is_empty())
+            {
+                return 0; // End-of-file
+            }
+            lines.append(first);
+
+            // The remaining lines are found without reading from the stream, so the buffer is not
+            // modified and all views stay valid.
+            if (offset_ != constant::npos)
+            {
+                while (true)
+                {
+                    usize pos = buffer_.find('\n', offset_).value_or_npos();
+                    if (pos == constant::npos)
+                    {
+                        break;
+                    }
+                    ++pos; // Include '\n'.
+                    lines.append(buffer_.view(offset_, pos - offset_));
+                    offset_ = pos;
+                }
+            }
+
+            return lines.count();
+        }
+
         // #### Read some
 
         // Read up to `buffer.size()` bytes. Returns 0 on end-of-file (EOF) or if `buffer` is empty.
@@ -186,6 +236,14 @@ namespace snn::stream
                     }
                 }
 
+                // Drop consumed bytes before reading more.
+                if (offset_ > 0)
+                {
+                    buffer_.drop_at(0, offset_);
+                    start_pos -= offset_;
+                    offset_ = 0;
+                }
+
                 // Do not allocate more than max size.
                 // This can not overflow (`57-bit-virtual-address-space` + `u32`).
                 if ((buffer_.size() + read_size_) > buffer_max_size_)
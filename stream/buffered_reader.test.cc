@@ -5,6 +5,7 @@
 
 #include "snn-core/unittest.hh"
 #include "snn-core/file/reader_writer.hh"
+#include "snn-core/string/repeat.hh"
 
 namespace snn::app
 {
@@ -178,6 +179,111 @@ namespace snn::app
 
             return true;
         }
+
+        constexpr bool test_read_lines()
+        {
+            for (const auto max_chunk_size : init_list<usize>{1, 2, 3, 4, 5, 9, 99})
+            {
+                stream::buffered_reader br{mock_reader{"one\ntwo\n\nfour\nfive", max_chunk_size}};
+                vec<cstrview> lines;
+                str joined;
+                usize total = 0;
+                while (true)
+                {
+                    const usize count = br.read_lines(lines).value();
+                    snn_require(count == lines.count());
+                    if (count == 0)
+                    {
+                        break;
+                    }
+                    for (const cstrview line : lines)
+                    {
+                        joined << line << "|";
+                    }
+                    total += count;
+                }
+                snn_require(total == 5);
+                snn_require(joined == "one\n|two\n|\n|four\n|five|");
+                snn_require(br.read_lines(lines).value() == 0); // End-of-file
+            }
+
+            {
+                // All complete lines in the buffer are returned at once.
+                stream::buffered_reader br{mock_reader{"a\nb\nc\nd", 99}};
+                vec<cstrview> lines;
+                snn_require(br.read_lines(lines).value() == 3);
+                snn_require(lines.at(0).value() == "a\n");
+                snn_require(lines.at(1).value() == "b\n");
+                snn_require(lines.at(2).value() == "c\n");
+                snn_require(br.read_lines(lines).value() == 1);
+                snn_require(lines.at(0).value() == "d");
+                snn_require(br.read_lines(lines).value() == 0);
+                snn_require(lines.is_empty());
+            }
+
+            {
+                // Mixed with other read calls.
+                stream::buffered_reader br{mock_reader{"a\nb\nc\nd\n", 99}};
+                vec<cstrview> lines;
+                snn_require(br.read<cstrview>(1).value() == "a");
+                snn_require(br.read_lines(lines).value() == 4);
+                snn_require(lines.at(0).value() == "\n");
+                snn_require(lines.at(3).value() == "d\n");
+                snn_require(br.read_line<cstrview>().value() == "");
+            }
+
+            return true;
+        }
+
+        constexpr bool test_bounded_memory()
+        {
+            // The total size is much larger than the max buffer size, but every line fits.
+            const str contents = string::repeat("0123456789abcdef\n", 1000);
+            snn_require(contents.size() == 17'000);
+
+            for (const auto max_chunk_size : init_list<usize>{7, 512, 99'999})
+            {
+                {
+                    stream::buffered_reader br{mock_reader{contents, max_chunk_size}, 512, 1024};
+                    usize count = 0;
+                    while (true)
+                    {
+                        const cstrview line = br.read_line<cstrview>().value();
+                        if (line.is_empty())
+                        {
+                            break;
+                        }
+                        snn_require(line == "0123456789abcdef\n");
+                        ++count;
+                    }
+                    snn_require(count == 1000);
+                }
+                {
+                    stream::buffered_reader br{mock_reader{contents, max_chunk_size}, 512, 1024};
+                    vec<cstrview> lines;
+                    usize count = 0;
+                    while (br.read_lines(lines).value() > 0)
+                    {
+                        snn_require(lines.all([](const cstrview line) {
+                            return line == "0123456789abcdef\n";
+                        }));
+                        count += lines.count();
+                    }
+                    snn_require(count == 1000);
+                }
+            }
+
+            {
+                // A line that doesn't fit.
+                const str long_line = string::repeat("x", 2000);
+                stream::buffered_reader br{mock_reader{long_line, 99}, 512, 1024};
+                auto res = br.read_line<cstrview>();
+                snn_require(!res);
+                snn_require(res.error_code() == generic::error::capacity_would_exceed_max_capacity);
+            }
+
+            return true;
+        }
     }
 }
 
@@ -187,6 +293,8 @@ namespace snn
     {
         snn_require(app::example());
         snn_static_require(app::test_buffered_reader());
+        snn_static_require(app::test_read_lines());
+        snn_static_require(app::test_bounded_memory());
 
         {
             stream::buffered_reader br{
@@ -0,0 +1,223 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Buffered writer for any writable stream
+
+// Small writes are collected in a buffer that is written to the stream when it is full (or on
+// `flush()`). Writes that are at least as large as the buffer size bypass the buffer, they are
+// written together with any buffered data, with a single vectored write if the stream supports it
+// (see `stream::vectored_writable`).
+
+// Buffered data is flushed on destruction but any error is ignored, it is recommended to
+// explicitly call `flush()` and check the return value.
+
+// If any `write*()` or `flush()` call fails, do not attempt any more calls.
+
+#pragma once
+
+#include "snn-core/result.hh"
+#include "snn-core/strcore.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/stream/common.hh"
+
+namespace snn::stream
+{
+    // ## Classes
+
+    // ### buffered_writer
+
+    template <stream::writable Stream>
+    class buffered_writer final
+    {
+      public:
+        // #### Explicit constructors
+
+        constexpr explicit buffered_writer(Stream stream, const u32 buffer_size = 8192) noexcept
+            : stream_{std::move(stream)},
+              buffer_size_{math::round_up_to_multiple<512, u32>(buffer_size).get()}
+        {
+        }
+
+        // #### Non-copyable
+
+        buffered_writer(const buffered_writer&)            = delete;
+        buffered_writer& operator=(const buffered_writer&) = delete;
+
+        // #### Move constructor/move assignment operator
+
+        constexpr buffered_writer(buffered_writer&&) noexcept = default;
+        buffered_writer& operator=(buffered_writer&&)         = delete;
+
+        // #### Destructor
+
+        constexpr ~buffered_writer()
+        {
+            ignore_if_unused(flush());
+        }
+
+        // #### Underlying stream
+
+        [[nodiscard]] constexpr Stream& stream() noexcept
+        {
+            return stream_;
+        }
+
+        [[nodiscard]] constexpr const Stream& stream() const noexcept
+        {
+            return stream_;
+        }
+
+        // #### Buffer
+
+        // Append directly to the buffer (e.g. formatting without a temporary string) and call
+        // `flush_if_full()` afterwards. The buffer can grow larger than the buffer size.
+
+        [[nodiscard]] constexpr strbuf& buffer() noexcept
+        {
+            return buffer_;
+        }
+
+        [[nodiscard]] constexpr usize buffer_size() const noexcept
+        {
+            return buffer_size_;
+        }
+
+        [[nodiscard]] constexpr usize buffered_size() const noexcept
+        {
+            return buffer_.size();
+        }
+
+        // #### Write
+
+        [[nodiscard]] constexpr result<void> write(const transient<cstrview> data)
+        {
+            const cstrview d = data.get();
+
+            if (d.size() >= buffer_size_)
+            {
+                // Pass-through.
+                return write_all_(d);
+            }
+
+            if ((buffer_.size() + d.size()) > buffer_size_)
+            {
+                const auto res = flush();
+                if (!res)
+                {
+                    return res;
+                }
+            }
+
+            reserve_();
+            buffer_.append(d);
+            return flush_if_full();
+        }
+
+        template <character Char>
+        [[nodiscard]] constexpr result<void> write(const Char c)
+        {
+            reserve_();
+            buffer_.append(c);
+            return flush_if_full();
+        }
+
+        // #### Flush
+
+        [[nodiscard]] constexpr result<void> flush()
+        {
+            return write_all_(cstrview{});
+        }
+
+        [[nodiscard]] constexpr result<void> flush_if_full()
+        {
+            if (buffer_.size() >= buffer_size_)
+            {
+                return flush();
+            }
+            return {};
+        }
+
+        // #### Stream append
+
+        constexpr buffered_writer& operator<<(const transient<cstrview> data)
+        {
+            write(data).or_throw();
+            return *this;
+        }
+
+        template <character Char>
+        constexpr buffered_writer& operator<<(const Char c)
+        {
+            write(c).or_throw();
+            return *this;
+        }
+
+      private:
+        Stream stream_;
+        strbuf buffer_;
+        u32 buffer_size_;
+
+        constexpr void reserve_()
+        {
+            if (buffer_.capacity() < buffer_size_)
+            {
+                buffer_.reserve(buffer_size_);
+            }
+        }
+
+        // Write the buffer followed by `data`. If a vectored write fails, the part of the buffer
+        // that was written is dropped.
+        constexpr result<void> write_all_(cstrview data)
+        {
+            cstrview buffered = buffer_.view();
+
+            if constexpr (stream::vectored_writable<Stream>)
+            {
+                while (buffered && data)
+                {
+                    const auto res = stream_.write_some(buffered, data);
+                    if (!res)
+                    {
+                        drop_written_(buffered);
+                        return res.error_code();
+                    }
+
+                    const usize written = res.value(assume::has_value);
+                    if (written >= buffered.size())
+                    {
+                        data.drop_front_n(written - buffered.size());
+                        buffered = cstrview{};
+                    }
+                    else
+                    {
+                        buffered.drop_front_n(written);
+                    }
+                }
+            }
+
+            if (buffered)
+            {
+                const auto res = stream_.write_all(buffered);
+                if (!res)
+                {
+                    // Partially written data is not reported by `write_all()`.
+                    return res;
+                }
+            }
+
+            buffer_.clear();
+
+            if (data)
+            {
+                return stream_.write_all(data);
+            }
+
+            return {};
+        }
+
+        constexpr void drop_written_(const cstrview remaining) noexcept
+        {
+            buffer_.drop_at(0, buffer_.size() - remaining.size());
+        }
+    };
+}
@@ -0,0 +1,215 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/stream/buffered_writer.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/file/read.hh"
+#include "snn-core/file/reader_writer.hh"
+#include "snn-core/file/remove.hh"
+#include "snn-core/file/dir/create_temporary.hh"
+#include "snn-core/file/dir/remove.hh"
+#include "snn-core/file/path/join.hh"
+#include "snn-core/string/repeat.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            const str tmp_dir  = file::dir::create_temporary("snn-unittest-").value();
+            const str tmp_file = file::path::join(tmp_dir, "lines");
+
+            {
+                file::reader_writer rw;
+                snn_require(rw.open_for_writing(tmp_file));
+
+                stream::buffered_writer bw{std::move(rw)};
+                bw << "One" << '\n';
+                bw << "Two\n";
+                snn_require(bw.write("Three\n"));
+                snn_require(bw.buffered_size() == 14);
+
+                // Nothing has been written yet.
+                snn_require(file::read(tmp_file).value() == "");
+
+                snn_require(bw.flush());
+                snn_require(bw.buffered_size() == 0);
+                snn_require(file::read(tmp_file).value() == "One\nTwo\nThree\n");
+
+                bw << "Four\n";
+            } // Flushed on destruction.
+
+            snn_require(file::read(tmp_file).value() == "One\nTwo\nThree\nFour\n");
+
+            snn_require(file::remove(tmp_file));
+            snn_require(file::dir::remove(tmp_dir));
+
+            return true;
+        }
+
+        template <bool Vectored>
+        class mock_writer final
+        {
+          public:
+            constexpr explicit mock_writer(str& output, usize& call_count,
+                                           const usize max_chunk_size) noexcept
+                : output_{output},
+                  call_count_{call_count},
+                  max_chunk_size_{math::max(max_chunk_size, 1)}
+            {
+            }
+
+            [[nodiscard]] constexpr result<usize> write_some(const transient<cstrview> data)
+            {
+                ++call_count_;
+                const cstrview d = data.get().view(0, max_chunk_size_);
+                output_.append(d);
+                return d.size();
+            }
+
+            [[nodiscard]] constexpr result<usize> write_some(const transient<cstrview> first,
+                                                             const transient<cstrview> second)
+                requires(Vectored)
+            {
+                ++call_count_;
+                const cstrview a = first.get().view(0, max_chunk_size_);
+                const cstrview b = second.get().view(0, max_chunk_size_ - a.size());
+                output_.append(a);
+                output_.append(b);
+                return a.size() + b.size();
+            }
+
+            [[nodiscard]] constexpr result<void> write_all(const transient<cstrview> data)
+            {
+                cstrview d = data.get();
+                while (d)
+                {
+                    d.drop_front_n(write_some(d).value());
+                }
+                return {};
+            }
+
+          private:
+            str& output_;
+            usize& call_count_;
+            usize max_chunk_size_;
+        };
+
+        constexpr bool test_buffered_writer()
+        {
+            static_assert(stream::vectored_writable<mock_writer<true>>);
+            static_assert(!stream::vectored_writable<mock_writer<false>>);
+
+            {
+                str output;
+                usize calls = 0;
+                stream::buffered_writer bw{mock_writer<true>{output, calls, 99'999}, 512};
+                snn_require(bw.buffer_size() == 512);
+
+                // Small writes are buffered.
+                for (usize i = 0; i < 100; ++i)
+                {
+                    snn_require(bw.write("abcd"));
+                }
+                snn_require(calls == 0);
+                snn_require(bw.buffered_size() == 400);
+
+                // Buffer would overflow, flush first.
+                snn_require(bw.write(string::repeat("x", 200)));
+                snn_require(calls == 1);
+                snn_require(output.size() == 400);
+                snn_require(bw.buffered_size() == 200);
+
+                // Exactly full, flushed.
+                snn_require(bw.write(string::repeat("y", 312)));
+                snn_require(calls == 2);
+                snn_require(output.size() == 912);
+                snn_require(bw.buffered_size() == 0);
+
+                // Large write with buffered data, a single vectored write.
+                snn_require(bw.write("123"));
+                snn_require(bw.write(string::repeat("z", 1000)));
+                snn_require(calls == 3);
+                snn_require(output.size() == 1915);
+                snn_require(output.view(909, 10) == "yyy123zzzz");
+                snn_require(bw.buffered_size() == 0);
+
+                // Large write without buffered data.
+                snn_require(bw.write(string::repeat("w", 600)));
+                snn_require(calls == 4);
+
+                snn_require(bw.write('!'));
+                snn_require(bw.flush());
+                snn_require(calls == 5);
+                snn_require(output.size() == 2516);
+                snn_require(output.view(2515) == "!");
+
+                // Flushing an empty buffer does nothing.
+                snn_require(bw.flush());
+                snn_require(calls == 5);
+            }
+
+            for (const auto max_chunk_size : init_list<usize>{1, 3, 7, 100, 99'999})
+            {
+                // Partial writes.
+                str expected;
+                str output_v;
+                str output_n;
+                usize calls_v = 0;
+                usize calls_n = 0;
+                {
+                    stream::buffered_writer bv{mock_writer<true>{output_v, calls_v, max_chunk_size},
+                                               512};
+                    stream::buffered_writer bn{
+                        mock_writer<false>{output_n, calls_n, max_chunk_size}, 512};
+                    for (usize i = 0; i < 50; ++i)
+                    {
+                        const str s = string::repeat("0123456789", i * 3);
+                        expected << s << '|';
+                        bv << s << '|';
+                        bn << s << '|';
+                    }
+                }
+                snn_require(output_v == expected);
+                snn_require(output_n == expected);
+            }
+
+            {
+                // Append directly to the buffer.
+                str output;
+                usize calls = 0;
+                stream::buffered_writer bw{mock_writer<false>{output, calls, 99'999}, 0};
+                snn_require(bw.buffer_size() == 512);
+                bw.buffer().append("abc");
+                snn_require(bw.flush_if_full());
+                snn_require(calls == 0);
+                bw.buffer().append(string::repeat("d", 600));
+                snn_require(bw.flush_if_full());
+                snn_require(calls == 1);
+                snn_require(output.size() == 603);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_static_require(app::test_buffered_writer());
+
+        {
+            file::reader_writer<> rw;
+            stream::buffered_writer bw{std::move(rw)};
+            snn_require(bw.write("abc")); // Buffered.
+            auto res = bw.flush();
+            snn_require(!res);
+            snn_require(res.error_code() == make_error_code(EBADF, system::error_category));
+        }
+    }
+}
@@ -26,4 +26,13 @@ namespace snn::stream
         { t.write_some(cstrview{}) } -> same_as<result<usize>>;
         { t.write_all(cstrview{}) } -> same_as<result<void>>;
     };
+
+    // ### vectored_writable
+
+    // A writable stream that can write two buffers with a single (vectored) write.
+
+    template <typename T>
+    concept vectored_writable = writable<T> && requires(T& t) {
+        { t.write_some(cstrview{}, cstrview{}) } -> same_as<result<usize>>;
+    };
 }
@@ -22,6 +22,10 @@ namespace snn::app
             static_assert(!stream::writable<int>);
             static_assert(!stream::writable<str>);
 
+            static_assert(stream::vectored_writable<file::reader_writer<>>);
+            static_assert(!stream::vectored_writable<int>);
+            static_assert(!stream::vectored_writable<str>);
+
             return true;
         }
 
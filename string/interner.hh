@@ -0,0 +1,352 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # String interning table
+
+// Stores each unique string once and maps it to a dense `u32` id (0, 1, 2, ...).
+// Strings are stored in append-only blocks (like `pool::append_only`), when a block is full a new
+// one is allocated. Strings larger than a block get a block of their own.
+// Strings are never moved, so views returned by `intern(...)`, `at(...)` and `find(...)` are valid
+// for the lifetime of the interner (even if moved).
+// Ids are looked up through an open addressing hash table keyed by `cityhash64`.
+
+// Not thread-safe, see [sharded\_interner.hh](sharded_interner.hh) for a thread-safe variant.
+
+#pragma once
+
+#include "snn-core/array_view.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/optional.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/detail/cityhash64/hash.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/trivial_allocator.hh"
+#include "snn-core/mem/raw/copy.hh"
+#include "snn-core/mem/raw/optimal_size.hh"
+#include "snn-core/num/bounded.hh"
+
+namespace snn::string
+{
+    // ## Classes
+
+    // ### interner
+
+    class interner final
+    {
+      public:
+        // #### Constants
+
+        static constexpr usize default_block_size = 16 * 1024;
+        static constexpr usize max_block_size     = constant::limit<iptrdiff>::max;
+
+        // The last id is reserved (the hash table stores `id + 1`).
+        static constexpr usize max_count = constant::limit<u32>::max;
+
+        // #### Explicit constructors
+
+        constexpr explicit interner(const num::bounded<usize, 1, max_block_size> min_block_size =
+                                        default_block_size) noexcept
+            : block_size_{mem::raw::optimal_size(min_block_size.not_zero())}
+        {
+        }
+
+        // #### Copy-constructor/assignment operator
+
+        interner(const interner&)            = delete;
+        interner& operator=(const interner&) = delete;
+
+        // #### Move-constructor/assignment operator
+
+        constexpr interner(interner&& other) noexcept
+            : blocks_{std::move(other.blocks_)},
+              views_{std::move(other.views_)},
+              slots_{std::move(other.slots_)},
+              next_{std::exchange(other.next_, nullptr)},
+              end_{std::exchange(other.end_, nullptr)},
+              block_size_{other.block_size_}
+        {
+        }
+
+        constexpr interner& operator=(interner&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        // #### Destructor
+
+        constexpr ~interner()
+        {
+            deallocate_();
+        }
+
+        // #### Explicit conversion operators
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return !is_empty();
+        }
+
+        // #### Intern
+
+        // Returns the id of the string, the string is copied if it hasn't been interned before.
+        constexpr u32 intern(const transient<cstrview> string)
+        {
+            return intern(string, hash(string));
+        }
+
+        // Same as above with a precomputed `hash(string)`.
+        constexpr u32 intern(const transient<cstrview> string, const u32 hash)
+        {
+            const cstrview s = string.get();
+            snn_should(hash == interner::hash(s));
+            if (const optional<u32> id = find_(s, hash))
+            {
+                return id.value(assume::has_value);
+            }
+            return insert_(s, hash);
+        }
+
+        // #### Lookup
+
+        // Id to string.
+
+        [[nodiscard]] constexpr optional<cstrview> at(const u32 id) const noexcept
+        {
+            return views_.at<cstrview>(id);
+        }
+
+        [[nodiscard]] constexpr cstrview at(const u32 id, assume::within_bounds_t) const noexcept
+        {
+            return views_.at(id, assume::within_bounds);
+        }
+
+        // String to id (without interning).
+
+        [[nodiscard]] constexpr optional<u32> find(const transient<cstrview> string) const noexcept
+        {
+            if (slots_.is_empty())
+            {
+                return nullopt;
+            }
+            const cstrview s = string.get();
+            return find_(s, hash(s));
+        }
+
+        // Same as above with a precomputed `hash(string)`.
+        [[nodiscard]] constexpr optional<u32> find(const transient<cstrview> string,
+                                                   const u32 hash) const noexcept
+        {
+            const cstrview s = string.get();
+            snn_should(hash == interner::hash(s));
+            return find_(s, hash);
+        }
+
+        [[nodiscard]] constexpr bool contains(const transient<cstrview> string) const noexcept
+        {
+            return find(string).has_value();
+        }
+
+        // #### Count
+
+        [[nodiscard]] constexpr usize count() const noexcept
+        {
+            return views_.count();
+        }
+
+        [[nodiscard]] constexpr bool is_empty() const noexcept
+        {
+            return views_.is_empty();
+        }
+
+        // #### Status
+
+        [[nodiscard]] constexpr usize block_count() const noexcept
+        {
+            return blocks_.count();
+        }
+
+        [[nodiscard]] constexpr usize block_size() const noexcept
+        {
+            return block_size_.get();
+        }
+
+        // #### Hash
+
+        // The low bits select a slot in the hash table. Pass the hash to `intern(...)` or
+        // `find(...)` to avoid hashing a string twice (e.g. when it is also used to pick a shard).
+
+        [[nodiscard]] static constexpr u32 hash(const transient<cstrview> string) noexcept
+        {
+            const cstrview s = string.get();
+            const u64 h      = detail::cityhash64::hash(s.begin(), s.size());
+            return static_cast<u32>(h ^ (h >> 32));
+        }
+
+        // #### Swap
+
+        constexpr void swap(interner& other) noexcept
+        {
+            // This works even if this == &other.
+            blocks_.swap(other.blocks_);
+            views_.swap(other.views_);
+            slots_.swap(other.slots_);
+            std::swap(next_, other.next_);
+            std::swap(end_, other.end_);
+            std::swap(block_size_, other.block_size_);
+        }
+
+      private:
+        struct block final
+        {
+            char* data;
+            usize size;
+        };
+
+        vec<block> blocks_;
+        vec<cstrview> views_; // Id to string.
+        vec<u64> slots_;      // Hash table, each slot is `hash << 32 | (id + 1)` or zero if empty.
+        char* next_{nullptr};
+        char* end_{nullptr};
+        not_zero<usize> block_size_;
+
+        constexpr optional<u32> find_(const cstrview s, const u32 hash) const noexcept
+        {
+            if (!slots_.is_empty())
+            {
+                const usize mask = slots_.count() - 1;
+                for (usize i = hash & mask;; i = (i + 1) & mask)
+                {
+                    const u64 slot = slots_.at(i, assume::within_bounds);
+                    if (slot == 0)
+                    {
+                        break;
+                    }
+                    if (is_match_(slot, hash, s))
+                    {
+                        return id_(slot);
+                    }
+                }
+            }
+            return nullopt;
+        }
+
+        static constexpr u32 id_(const u64 slot) noexcept
+        {
+            return static_cast<u32>(slot) - 1;
+        }
+
+        constexpr bool is_match_(const u64 slot, const u32 hash, const cstrview s) const noexcept
+        {
+            return static_cast<u32>(slot >> 32) == hash &&
+                   views_.at(id_(slot), assume::within_bounds) == s;
+        }
+
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        constexpr u32 insert_(const cstrview s, const u32 hash)
+        {
+            if (views_.count() >= (max_count - 1)) [[unlikely]]
+            {
+                throw_or_abort(generic::error::capacity_would_exceed_max_capacity);
+            }
+
+            // Grow at 75% load.
+            const usize new_count = views_.count() + 1;
+            if ((new_count * 4) > (slots_.count() * 3))
+            {
+                rehash_(math::max(slots_.count() * 2, usize{16}));
+            }
+
+            views_.reserve_append(1);
+
+            const cstrview stored = store_(s);
+            const auto id         = static_cast<u32>(views_.count());
+            views_.append(stored); // Will never throw since we reserved beforehand.
+
+            place_(slots_, (u64{hash} << 32) | (u64{id} + 1));
+
+            return id;
+        }
+
+        constexpr cstrview store_(const cstrview s)
+        {
+            if (s.is_empty())
+            {
+                return cstrview{};
+            }
+
+            if (s.size() > static_cast<usize>(end_ - next_))
+            {
+                grow_(s.size());
+            }
+
+            char* const p = next_;
+            mem::raw::copy(s.data(), not_null{p}, s.byte_size(), assume::no_overlap);
+            next_ += s.size();
+            return cstrview{not_null<const char*>{p}, s.size()};
+        }
+
+        constexpr void grow_(const usize min_size)
+        {
+            blocks_.reserve_append(1);
+
+            const auto size = mem::raw::optimal_size(not_zero{math::max(min_size, block_size())});
+
+            mem::trivial_allocator<char> alloc;
+            char* const data = alloc.allocate(size).value();
+
+            blocks_.append(block{data, size.get()}); // Will never throw since we reserved.
+            next_ = data;
+            end_  = data + size.get();
+        }
+
+        constexpr void rehash_(const usize slot_count)
+        {
+            snn_should(slot_count > 0 && (slot_count & (slot_count - 1)) == 0);
+
+            vec<u64> slots{init::reserve, slot_count};
+            for (usize i = 0; i < slot_count; ++i)
+            {
+                slots.append(0);
+            }
+
+            for (const u64 slot : slots_)
+            {
+                if (slot != 0)
+                {
+                    place_(slots, slot);
+                }
+            }
+
+            slots_.swap(slots);
+        }
+
+        static constexpr void place_(vec<u64>& slots, const u64 slot) noexcept
+        {
+            const usize mask = slots.count() - 1;
+            for (usize i = static_cast<u32>(slot >> 32) & mask;; i = (i + 1) & mask)
+            {
+                u64& s = slots.at(i, assume::within_bounds);
+                if (s == 0)
+                {
+                    s = slot;
+                    return;
+                }
+            }
+        }
+
+        constexpr void deallocate_() noexcept
+        {
+            mem::trivial_allocator<char> alloc;
+            for (const block b : blocks_)
+            {
+                alloc.deallocate(b.data, b.size);
+            }
+        }
+
+        SNN_DIAGNOSTIC_POP
+    };
+}
@@ -0,0 +1,131 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/string/interner.hh"
+
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            string::interner strings;
+
+            snn_require(strings.is_empty());
+            snn_require(!strings);
+
+            const u32 a = strings.intern("Content-Type");
+            const u32 b = strings.intern("Content-Length");
+            const u32 c = strings.intern("Content-Type");
+
+            // Ids are dense.
+            snn_require(a == 0);
+            snn_require(b == 1);
+            snn_require(c == a);
+
+            snn_require(strings.count() == 2);
+            snn_require(strings);
+
+            snn_require(strings.at(a).value() == "Content-Type");
+            snn_require(strings.at(b, assume::within_bounds) == "Content-Length");
+            snn_require(!strings.at(2));
+
+            snn_require(strings.find("Content-Length").value() == b);
+            snn_require(!strings.find("Accept"));
+            snn_require(!strings.contains("Accept"));
+            snn_require(strings.count() == 2);
+
+            // Precomputed hash.
+            const u32 hash = string::interner::hash("Accept");
+            snn_require(hash == string::interner::hash(str{"Accept"}));
+            snn_require(!strings.find("Accept", hash));
+            const u32 d = strings.intern("Accept", hash);
+            snn_require(d == 2);
+            snn_require(strings.intern("Accept") == d);
+            snn_require(strings.find("Accept", hash).value() == d);
+            snn_require(strings.count() == 3);
+
+            return true;
+        }
+
+        constexpr bool test_interner()
+        {
+            {
+                string::interner strings{10};
+                snn_require(strings.block_size() == 16); // Optimal size.
+                snn_require(strings.block_count() == 0);
+
+                // Empty string.
+                const u32 empty = strings.intern("");
+                snn_require(empty == 0);
+                snn_require(strings.intern(cstrview{}) == empty);
+                snn_require(strings.at(empty).value().is_empty());
+                snn_require(strings.block_count() == 0);
+
+                // Larger than a block.
+                const str large{init::fill, 112, 'x'}; // Optimal size, fills the block.
+                const u32 id = strings.intern(large);
+                snn_require(id == 1);
+                snn_require(strings.block_count() == 1);
+                snn_require(strings.at(id).value() == large);
+                snn_require(strings.at(id).value().data().get() != large.data().get());
+
+                // Doesn't fit in the current (full) block.
+                snn_require(strings.intern("abc") == 2);
+                snn_require(strings.block_count() == 2);
+                snn_require(strings.intern("def") == 3);
+                snn_require(strings.block_count() == 2);
+
+                // Move (views stay valid).
+                const cstrview abc = strings.at(2).value();
+                string::interner moved{std::move(strings)};
+                snn_require(strings.is_empty());
+                snn_require(moved.count() == 4);
+                snn_require(moved.at(2).value().data().get() == abc.data().get());
+                snn_require(moved.find("def").value() == 3);
+
+                strings = std::move(moved);
+                snn_require(strings.count() == 4);
+                snn_require(moved.is_empty());
+                snn_require(!moved.find("def"));
+            }
+            {
+                string::interner strings;
+
+                str s;
+                for (usize i = 0; i < 1000; ++i)
+                {
+                    s.clear();
+                    s << "key" << as_num(i);
+                    snn_require(strings.intern(s) == i);
+                }
+                snn_require(strings.count() == 1000);
+
+                for (usize i = 0; i < 1000; ++i)
+                {
+                    s.clear();
+                    s << "key" << as_num(i);
+                    snn_require(strings.intern(s) == i);
+                    snn_require(strings.find(s).value() == i);
+                    snn_require(strings.at(static_cast<u32>(i)).value() == s);
+                }
+                snn_require(strings.count() == 1000);
+                snn_require(!strings.find("key1000"));
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_interner());
+    }
+}
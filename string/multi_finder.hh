@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Find any of multiple needles
+
+// Finds the first (leftmost) occurrence of any of up to 8 needles in a single pass. If more than
+// one needle matches at the same position, the needle with the lowest index is reported.
+
+// Up to the first three bytes of each needle are classified with nibble lookup tables ("Teddy",
+// from the Hyperscan project), 16 or 32 positions at a time with SSSE3/AVX2 and one position at a
+// time otherwise. Only candidate positions are compared in full.
+
+// The needles are not copied and must outlive the finder.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/array_view.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/optional.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/raw/detail/simd.hh"
+
+namespace snn::string
+{
+    // ## Classes
+
+    // ### multi_finder
+
+    class multi_finder final
+    {
+      public:
+        // #### Constants
+
+        static constexpr usize max_needles = 8;
+
+        // #### Types
+
+        struct match final
+        {
+            usize position;
+            usize index; // Needle index.
+        };
+
+        // #### Explicit constructors
+
+        // Throws if there are no needles, more than `max_needles` needles or any empty needle.
+
+        constexpr explicit multi_finder(const array_view<const cstrview> needles)
+        {
+            if (needles.is_empty() || needles.count() > max_needles)
+            {
+                throw_or_abort(generic::error::invalid_value);
+            }
+
+            usize shortest = constant::limit<usize>::max;
+            for (const cstrview needle : needles)
+            {
+                if (needle.is_empty())
+                {
+                    throw_or_abort(generic::error::invalid_value);
+                }
+                needles_.at(count_, assume::within_bounds) = needle;
+                ++count_;
+                shortest = math::min(shortest, needle.size());
+            }
+
+            fingerprint_size_ = math::min(shortest, fingerprint_max_size_);
+
+            // Bytes after the fingerprint size match everything.
+            for (usize i = fingerprint_size_; i < fingerprint_max_size_; ++i)
+            {
+                lo_nibble_.at(i, assume::within_bounds).fill(0xff);
+                hi_nibble_.at(i, assume::within_bounds).fill(0xff);
+            }
+
+            for (usize index = 0; index < count_; ++index)
+            {
+                const cstrview needle = needles_.at(index, assume::within_bounds);
+                const auto bucket     = static_cast<u8>(1u << index);
+                for (usize i = 0; i < fingerprint_size_; ++i)
+                {
+                    const u8 b = to_byte(needle.at(i, assume::within_bounds));
+                    u8& lo = lo_nibble_.at(i, assume::within_bounds).at(b & 0xfu, bounds::mask);
+                    u8& hi = hi_nibble_.at(i, assume::within_bounds).at(b >> 4u, bounds::mask);
+                    lo     = static_cast<u8>(lo | bucket);
+                    hi     = static_cast<u8>(hi | bucket);
+                }
+            }
+        }
+
+        // #### Count
+
+        [[nodiscard]] constexpr usize count() const noexcept
+        {
+            return count_;
+        }
+
+        // #### Find
+
+        [[nodiscard]] constexpr optional<match> find(const transient<cstrview> subject,
+                                                     const usize start_pos = 0) const noexcept
+        {
+            const cstrview s = subject.get();
+            if (start_pos >= s.size())
+            {
+                return nullopt;
+            }
+
+            const cstrview rest = s.view(start_pos);
+            usize index         = 0;
+            const auto is_match = [&](const usize pos, const u8 buckets) noexcept {
+                for (usize i = 0; i < count_; ++i)
+                {
+                    if ((buckets & (1u << i)) != 0 &&
+                        rest.view(pos).has_front(needles_.at(i, assume::within_bounds)))
+                    {
+                        index = i;
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            usize pos = 0;
+            if (!std::is_constant_evaluated())
+            {
+                pos = mem::raw::detail::simd::find_fingerprint(rest.begin(), rest.size(),
+                                                               lo_nibble_, hi_nibble_, is_match);
+            }
+
+            for (; pos < rest.size(); ++pos)
+            {
+                if (is_match(pos, buckets_(rest, pos)))
+                {
+                    return match{start_pos + pos, index};
+                }
+            }
+
+            return nullopt;
+        }
+
+      private:
+        static constexpr usize fingerprint_max_size_ = 3;
+
+        array<cstrview, max_needles> needles_{};
+        usize count_{0};
+        usize fingerprint_size_{0};
+        array<array<u8, 16>, fingerprint_max_size_> lo_nibble_{};
+        array<array<u8, 16>, fingerprint_max_size_> hi_nibble_{};
+
+        [[nodiscard]] constexpr u8 buckets_(const cstrview s, const usize pos) const noexcept
+        {
+            u8 buckets = 0xff;
+            for (usize i = 0; i < fingerprint_size_; ++i)
+            {
+                const auto c = s.at(pos + i);
+                if (!c)
+                {
+                    return 0;
+                }
+                const u8 b  = to_byte(c.value(assume::has_value));
+                const u8 lo = lo_nibble_.at(i, assume::within_bounds).at(b & 0xfu, bounds::mask);
+                const u8 hi = hi_nibble_.at(i, assume::within_bounds).at(b >> 4u, bounds::mask);
+                buckets     = static_cast<u8>(buckets & lo & hi);
+            }
+            return buckets;
+        }
+    };
+}
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/string/multi_finder.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/random/number.hh"
+#include "snn-core/random/string.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        constexpr bool example()
+        {
+            const array<cstrview, 3> needles{"\r\n", "\n", "<br>"};
+            const string::multi_finder finder{needles};
+
+            const cstrview s{"One<br>Two\nThree\r\nFour"};
+
+            auto m = finder.find(s);
+            snn_require(m);
+            snn_require(m.value().position == 3);
+            snn_require(m.value().index == 2); // "<br>"
+
+            m = finder.find(s, 4);
+            snn_require(m);
+            snn_require(m.value().position == 10);
+            snn_require(m.value().index == 1); // "\n"
+
+            m = finder.find(s, 11);
+            snn_require(m);
+            snn_require(m.value().position == 16);
+            snn_require(m.value().index == 0); // "\r\n"
+
+            snn_require(!finder.find(s, 18));
+            snn_require(!finder.find(""));
+
+            return true;
+        }
+
+        constexpr bool test_multi_finder()
+        {
+            {
+                // Same position, lowest needle index.
+                const array<cstrview, 3> needles{"abc", "ab", "a"};
+                const string::multi_finder finder{needles};
+                snn_require(finder.count() == 3);
+                snn_require(finder.find("xxabc").value().position == 2);
+                snn_require(finder.find("xxabc").value().index == 0);
+                snn_require(finder.find("xxabx").value().index == 1);
+                snn_require(finder.find("xxaxx").value().index == 2);
+                snn_require(!finder.find("xxxxx"));
+            }
+            {
+                // Needle longer than the rest of the subject.
+                const array<cstrview, 1> needles{"abcd"};
+                const string::multi_finder finder{needles};
+                snn_require(!finder.find("xxabc"));
+                snn_require(finder.find("xxabcd").value().position == 2);
+            }
+            {
+                // Invalid needles.
+                snn_require_throws_code(string::multi_finder{array_view<const cstrview>{}},
+                                        generic::error::invalid_value);
+
+                const array<cstrview, 2> empty_needle{"a", ""};
+                snn_require_throws_code(string::multi_finder{empty_needle},
+                                        generic::error::invalid_value);
+
+                const array<cstrview, 9> too_many{"a", "b", "c", "d", "e", "f", "g", "h", "i"};
+                snn_require_throws_code(string::multi_finder{too_many},
+                                        generic::error::invalid_value);
+            }
+
+            return true;
+        }
+
+        bool test_multi_finder_simd()
+        {
+            const array<cstrview, 8> needles{
+                "needle", "ne", "x", "\xff\x80", "\r\n\r\n", "nEEDLE", "a\0b", "nnnnnnnnnnnnnnnnnn"};
+            const string::multi_finder finder{needles};
+
+            // Each needle at every position, the subject contains near misses.
+            for (usize size = 0; size < 80; ++size)
+            {
+                const str subject{init::fill, size, 'n'};
+                snn_require(!finder.find(subject) || size >= 18);
+
+                for (usize index = 0; index < needles.count(); ++index)
+                {
+                    const cstrview needle = needles.at(index, assume::within_bounds);
+                    for (usize pos = 0; (pos + needle.size()) <= size; ++pos)
+                    {
+                        str s = subject;
+                        s.replace_at(pos, needle.size(), needle);
+
+                        // Reference: first position where any needle matches.
+                        usize expected_pos   = constant::npos;
+                        usize expected_index = 0;
+                        for (usize p = 0; p < s.size() && expected_pos == constant::npos; ++p)
+                        {
+                            for (usize i = 0; i < needles.count(); ++i)
+                            {
+                                if (s.view(p).has_front(needles.at(i, assume::within_bounds)))
+                                {
+                                    expected_pos   = p;
+                                    expected_index = i;
+                                    break;
+                                }
+                            }
+                        }
+
+                        const auto m = finder.find(s);
+                        snn_require(m);
+                        snn_require(m.value().position == expected_pos);
+                        snn_require(m.value().index == expected_index);
+                    }
+                }
+            }
+
+            // Random subjects.
+            for (loop::count lc{100}; lc--;)
+            {
+                const auto s = random::string(random::number<usize>(0, 2'000));
+                for (usize start_pos = 0; start_pos < s.size(); start_pos += 97)
+                {
+                    usize expected = constant::npos;
+                    for (const cstrview needle : needles)
+                    {
+                        expected = math::min(expected, s.find(needle, start_pos).value_or_npos());
+                    }
+
+                    const auto m = finder.find(s, start_pos);
+                    if (expected == constant::npos)
+                    {
+                        snn_require(!m);
+                    }
+                    else
+                    {
+                        snn_require(m.value().position == expected);
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_static_require(app::example());
+        snn_static_require(app::test_multi_finder());
+        snn_require(app::test_multi_finder_simd());
+    }
+}
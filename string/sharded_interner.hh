@@ -0,0 +1,170 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Thread-safe string interning table
+
+// A thread-safe variant of [interner.hh](interner.hh). Strings are distributed over `ShardCount`
+// independently locked interners (by hash), which reduces lock contention.
+
+// The shard index is stored in the low bits of an id: `id = local_id * ShardCount + shard_index`.
+// Ids are stable, but they are only dense within each shard.
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/string/interner.hh"
+#include <mutex>        // lock_guard
+#include <shared_mutex> // shared_lock, shared_mutex
+
+namespace snn::string
+{
+    // ## Classes
+
+    // ### sharded_interner
+
+    template <usize ShardCount = 16>
+        requires(power_of_two<ShardCount> && ShardCount <= 256)
+    class sharded_interner final
+    {
+      public:
+        // #### Explicit constructors
+
+        explicit sharded_interner(const num::bounded<usize, 1, interner::max_block_size>
+                                      min_block_size = interner::default_block_size) noexcept
+        {
+            for (shard& sh : shards_)
+            {
+                sh.strings = interner{min_block_size};
+            }
+        }
+
+        // #### Non-copyable/non-movable
+
+        sharded_interner(const sharded_interner&)            = delete;
+        sharded_interner& operator=(const sharded_interner&) = delete;
+
+        sharded_interner(sharded_interner&&)            = delete;
+        sharded_interner& operator=(sharded_interner&&) = delete;
+
+        // #### Destructor
+
+        ~sharded_interner() = default;
+
+        // #### Intern
+
+        // Returns the id of the string, the string is copied if it hasn't been interned before.
+        u32 intern(const transient<cstrview> string)
+        {
+            const cstrview s  = string.get();
+            const u32 hash    = interner::hash(s);
+            const usize index = shard_index_(hash);
+            shard& sh         = shards_.at(index, assume::within_bounds);
+
+            {
+                std::shared_lock lock{sh.mutex};
+                const auto local_id = sh.strings.find(s, hash);
+                if (local_id)
+                {
+                    return to_id_(local_id.value(assume::has_value), index);
+                }
+            }
+
+            std::lock_guard lock{sh.mutex};
+            if (sh.strings.count() >= max_local_count_ && !sh.strings.find(s, hash)) [[unlikely]]
+            {
+                throw_or_abort(generic::error::capacity_would_exceed_max_capacity);
+            }
+            return to_id_(sh.strings.intern(s, hash), index);
+        }
+
+        // #### Lookup
+
+        // Id to string.
+
+        [[nodiscard]] optional<cstrview> at(const u32 id) const
+        {
+            const shard& sh = shards_.at(id % ShardCount, assume::within_bounds);
+            std::shared_lock lock{sh.mutex};
+            return sh.strings.at(id / ShardCount);
+        }
+
+        // String to id (without interning).
+
+        [[nodiscard]] optional<u32> find(const transient<cstrview> string) const
+        {
+            const cstrview s  = string.get();
+            const u32 hash    = interner::hash(s);
+            const usize index = shard_index_(hash);
+            const shard& sh   = shards_.at(index, assume::within_bounds);
+
+            std::shared_lock lock{sh.mutex};
+            const auto local_id = sh.strings.find(s, hash);
+            if (local_id)
+            {
+                return to_id_(local_id.value(assume::has_value), index);
+            }
+            return nullopt;
+        }
+
+        [[nodiscard]] bool contains(const transient<cstrview> string) const
+        {
+            return find(string).has_value();
+        }
+
+        // #### Count
+
+        [[nodiscard]] usize count() const
+        {
+            usize total = 0;
+            for (const shard& sh : shards_)
+            {
+                std::shared_lock lock{sh.mutex};
+                total += sh.strings.count();
+            }
+            return total;
+        }
+
+        [[nodiscard]] bool is_empty() const
+        {
+            return count() == 0;
+        }
+
+        // #### Status
+
+        [[nodiscard]] static constexpr usize shard_count() noexcept
+        {
+            return ShardCount;
+        }
+
+      private:
+        // Max number of strings per shard (so that all ids fit in an `u32`).
+        static constexpr usize max_local_count_ = (interner::max_count / ShardCount) - 1;
+
+        // Each shard on its own cache line(s) to avoid false sharing.
+        struct alignas(64) shard final
+        {
+            // Not an aggregate, the default constructor of `interner` is explicit.
+            shard() noexcept
+                : strings{interner::default_block_size}
+            {
+            }
+
+            interner strings;
+            mutable std::shared_mutex mutex;
+        };
+
+        array<shard, ShardCount> shards_;
+
+        // The string is hashed once, the same hash is passed to the interner of the shard.
+        static usize shard_index_(const u32 hash) noexcept
+        {
+            // Use the high bits, the low bits select the slot in each shard.
+            return usize{hash >> 24} % ShardCount;
+        }
+
+        static u32 to_id_(const u32 local_id, const usize shard_index) noexcept
+        {
+            return static_cast<u32>((usize{local_id} * ShardCount) + shard_index);
+        }
+    };
+}
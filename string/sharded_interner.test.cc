@@ -0,0 +1,108 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/string/sharded_interner.hh"
+
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+#include <thread> // thread
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            string::sharded_interner<16> strings;
+
+            snn_require(strings.is_empty());
+            snn_require(strings.shard_count() == 16);
+
+            const u32 a = strings.intern("Content-Type");
+            const u32 b = strings.intern("Content-Length");
+            snn_require(a != b);
+            snn_require(strings.intern("Content-Type") == a);
+
+            snn_require(strings.count() == 2);
+
+            snn_require(strings.at(a).value() == "Content-Type");
+            snn_require(strings.at(b).value() == "Content-Length");
+
+            snn_require(strings.find("Content-Length").value() == b);
+            snn_require(!strings.find("Accept"));
+            snn_require(!strings.contains("Accept"));
+
+            return true;
+        }
+
+        bool test_sharded_interner()
+        {
+            {
+                string::sharded_interner<1> strings{10};
+                snn_require(strings.intern("a") == 0);
+                snn_require(strings.intern("b") == 1);
+                snn_require(strings.intern("c") == 2);
+                snn_require(strings.intern("b") == 1);
+                snn_require(!strings.at(3));
+            }
+            {
+                string::sharded_interner<4> strings;
+
+                constexpr usize thread_count = 4;
+                constexpr usize key_count    = 2000;
+
+                vec<vec<u32>> ids;
+                for (usize t = 0; t < thread_count; ++t)
+                {
+                    ids.append_inplace();
+                }
+
+                vec<std::thread> threads;
+                for (usize t = 0; t < thread_count; ++t)
+                {
+                    threads.append_inplace([&strings, &ids, t] {
+                        vec<u32>& v = ids.at(t, assume::within_bounds);
+                        str s;
+                        for (usize i = 0; i < key_count; ++i)
+                        {
+                            s.clear();
+                            s << "key" << as_num(i);
+                            v.append(strings.intern(s));
+                        }
+                    });
+                }
+                for (std::thread& th : threads)
+                {
+                    th.join();
+                }
+
+                snn_require(strings.count() == key_count);
+
+                // All threads got the same ids.
+                const vec<u32>& first = ids.at(0, assume::within_bounds);
+                snn_require(ids.all(fn::is{fn::equal_to{}, first}));
+
+                str s;
+                for (usize i = 0; i < key_count; ++i)
+                {
+                    s.clear();
+                    s << "key" << as_num(i);
+                    const u32 id = first.at(i, assume::within_bounds);
+                    snn_require(strings.at(id).value() == s);
+                    snn_require(strings.find(s).value() == id);
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_sharded_interner());
+    }
+}
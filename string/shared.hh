@@ -0,0 +1,362 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Immutable reference-counted string
+
+// Copying is O(1) and only increments an atomic reference count (no allocation or copying of the
+// string data). The reference count, size, hash and string data are stored in a single
+// allocation.
+
+// A `substring(...)` shares the allocation of the string it was created from.
+
+// Instances can be copied and destroyed concurrently from multiple threads.
+
+#pragma once
+
+#include "snn-core/array_view.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/mem/construct.hh"
+#include "snn-core/mem/destruct.hh"
+#include "snn-core/mem/raw/copy.hh"
+#include "snn-core/num/safe.hh"
+#include "snn-core/range/contiguous.hh"
+#include <atomic>  // atomic, atomic_thread_fence, memory_order_*
+#include <cstdlib> // free, malloc
+
+namespace snn::string
+{
+    // ## Classes
+
+    // ### shared
+
+    class shared final
+    {
+      public:
+        // #### Types
+
+        using value_type = char;
+
+        using const_iterator = const char*;
+        using const_pointer  = const char*;
+
+        using trivially_relocatable_type = shared;
+
+        // #### Default constructor
+
+        shared() noexcept = default;
+
+        // #### Explicit constructors
+
+        // Copies the string once.
+        explicit shared(const transient<cstrview> s)
+        {
+            const cstrview v = s.get();
+            if (v)
+            {
+                header* const h = allocate_(v.size());
+                mem::raw::copy(v.data(), not_null{data_of_(h)}, v.byte_size(),
+                               assume::no_overlap);
+                h_    = h;
+                data_ = data_of_(h);
+                size_ = v.size();
+            }
+        }
+
+        // #### Copy constructor/copy assignment operator
+
+        shared(const shared& other) noexcept
+            : h_{other.h_},
+              data_{other.data_},
+              size_{other.size_}
+        {
+            increment_();
+        }
+
+        shared& operator=(const shared& other) noexcept
+        {
+            shared tmp{other};
+            swap(tmp);
+            return *this;
+        }
+
+        // #### Move constructor/move assignment operator
+
+        shared(shared&& other) noexcept
+            : h_{std::exchange(other.h_, nullptr)},
+              data_{std::exchange(other.data_, "")},
+              size_{std::exchange(other.size_, 0)}
+        {
+        }
+
+        shared& operator=(shared&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        // #### Destructor
+
+        ~shared()
+        {
+            decrement_();
+        }
+
+        // #### Conversion operators
+
+        explicit operator bool() const noexcept
+        {
+            return !is_empty();
+        }
+
+        operator cstrview() const& noexcept
+        {
+            return view();
+        }
+
+        operator cstrview() const&& = delete; // Temporary, use view() if safe.
+
+        // #### Iterators
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            return data_ + size_;
+
+            SNN_DIAGNOSTIC_POP
+        }
+
+        // #### Data
+
+        [[nodiscard]] not_null<const_pointer> data() const noexcept
+        {
+            return not_null{data_};
+        }
+
+        // #### Size
+
+        [[nodiscard]] snn::byte_size<usize> byte_size() const noexcept
+        {
+            return snn::byte_size<usize>{size_};
+        }
+
+        [[nodiscard]] usize count() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] usize size() const noexcept
+        {
+            return size_;
+        }
+
+        // #### Range
+
+        [[nodiscard]] cstrrng range() const noexcept
+        {
+            return view().range();
+        }
+
+        // #### View
+
+        [[nodiscard]] cstrview view() const noexcept
+        {
+            return cstrview{not_null{data_}, size_};
+        }
+
+        [[nodiscard]] cstrview view(const usize pos,
+                                    const usize size = constant::npos) const noexcept
+        {
+            return view().view(pos, size);
+        }
+
+        // #### Substring
+
+        // Shares the allocation (no copying).
+        [[nodiscard]] shared substring(const usize pos,
+                                       const usize size = constant::npos) const noexcept
+        {
+            const cstrview v = view(pos, size);
+            if (v)
+            {
+                return shared{h_, v.begin(), v.size()};
+            }
+            return shared{};
+        }
+
+        // #### Hash
+
+        // The hash of a string that has not been sliced is cached and shared by all copies.
+        [[nodiscard]] usize hash() const noexcept
+        {
+            if (h_ != nullptr && size_ == h_->size)
+            {
+                usize hash = h_->hash.load(std::memory_order_relaxed);
+                if (hash == 0)
+                {
+                    // A hash of zero is simply never cached.
+                    hash = view().hash();
+                    h_->hash.store(hash, std::memory_order_relaxed);
+                }
+                return hash;
+            }
+            return view().hash();
+        }
+
+        // #### Status
+
+        // Number of instances sharing the allocation (zero if empty).
+        [[nodiscard]] usize use_count() const noexcept
+        {
+            if (h_ != nullptr)
+            {
+                return h_->ref_count.load(std::memory_order_relaxed);
+            }
+            return 0;
+        }
+
+        // #### Comparison
+
+        template <usize N>
+        bool operator==(const char (&s)[N]) const noexcept
+        {
+            return view() == s;
+        }
+
+        bool operator==(const cstrview s) const noexcept
+        {
+            return view() == s;
+        }
+
+        bool operator==(const shared& other) const noexcept
+        {
+            return view() == other.view();
+        }
+
+        template <usize N>
+        std::strong_ordering operator<=>(const char (&s)[N]) const noexcept
+        {
+            return view() <=> cstrview{s};
+        }
+
+        std::strong_ordering operator<=>(const cstrview s) const noexcept
+        {
+            return view() <=> s;
+        }
+
+        std::strong_ordering operator<=>(const shared& other) const noexcept
+        {
+            return view() <=> other.view();
+        }
+
+        // #### Swap
+
+        void swap(shared& other) noexcept
+        {
+            // This works even if this == &other.
+            std::swap(h_, other.h_);
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+        }
+
+      private:
+        struct header final
+        {
+            std::atomic<usize> ref_count;
+            std::atomic<usize> hash;
+            usize size;
+        };
+
+        header* h_{nullptr};
+        const char* data_{""};
+        usize size_{0};
+
+        // Takes a new reference.
+        explicit shared(header* const h, const char* const data, const usize size) noexcept
+            : h_{h},
+              data_{data},
+              size_{size}
+        {
+            increment_();
+        }
+
+        static header* allocate_(const usize size)
+        {
+            // Header + data + '\0'.
+            const usize total_size = num::safe{sizeof(header)}.add(size).add(1).value();
+
+            void* const ptr = std::malloc(total_size);
+            if (ptr == nullptr)
+            {
+                throw_or_abort(generic::error::memory_allocation_failure);
+            }
+
+            header* const h = mem::construct(not_null{static_cast<header*>(ptr)}).get();
+            h->ref_count.store(1, std::memory_order_relaxed);
+            h->hash.store(0, std::memory_order_relaxed);
+            h->size = size;
+
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            data_of_(h)[size] = '\0';
+
+            SNN_DIAGNOSTIC_POP
+
+            return h;
+        }
+
+        static char* data_of_(header* const h) noexcept
+        {
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+            return reinterpret_cast<char*>(h + 1);
+
+            SNN_DIAGNOSTIC_POP
+        }
+
+        void increment_() const noexcept
+        {
+            if (h_ != nullptr)
+            {
+                h_->ref_count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void decrement_() noexcept
+        {
+            if (h_ != nullptr && h_->ref_count.fetch_sub(1, std::memory_order_release) == 1)
+            {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                mem::destruct(not_null{h_});
+                std::free(h_);
+            }
+        }
+    };
+}
+
+// ## Specializations
+
+// ### std::hash
+
+template <>
+struct std::hash<snn::string::shared>
+{
+    [[nodiscard]] std::size_t operator()(const snn::string::shared& s) const noexcept
+    {
+        return s.hash();
+    }
+};
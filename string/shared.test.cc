@@ -0,0 +1,169 @@
+// Copyright (c) 2022 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/string/shared.hh"
+
+#include "snn-core/strcore.hh"
+#include "snn-core/unittest.hh"
+#include "snn-core/vec.hh"
+
+namespace snn::app
+{
+    namespace
+    {
+        void indirect_self_assignment(string::shared& a, const string::shared& b)
+        {
+            a = b;
+        }
+
+        bool example()
+        {
+            string::shared s{"One Two Three"};
+            snn_require(s == "One Two Three");
+            snn_require(s.size() == 13);
+            snn_require(s.use_count() == 1);
+
+            // Copying only increments the reference count.
+            string::shared copy = s;
+            snn_require(copy.data().get() == s.data().get());
+            snn_require(s.use_count() == 2);
+
+            // A substring shares the allocation.
+            string::shared two = s.substring(4, 3);
+            snn_require(two == "Two");
+            snn_require(two.data().get() == s.data().get() + 4);
+            snn_require(s.use_count() == 3);
+
+            // Conversion to `cstrview`.
+            const cstrview v = s;
+            snn_require(v == "One Two Three");
+
+            snn_require(s.hash() == cstrview{"One Two Three"}.hash());
+            snn_require(two.hash() == cstrview{"Two"}.hash());
+
+            return true;
+        }
+
+        bool test_shared()
+        {
+            {
+                string::shared s;
+                snn_require(!s);
+                snn_require(s.is_empty());
+                snn_require(s.size() == 0);
+                snn_require(s.count() == 0);
+                snn_require(s.use_count() == 0);
+                snn_require(s.view() == "");
+                snn_require(s.hash() == cstrview{}.hash());
+                snn_require(s.substring(0).is_empty());
+                snn_require(s.begin() == s.end());
+
+                string::shared copy{s};
+                snn_require(copy.is_empty());
+                snn_require(copy.use_count() == 0);
+            }
+            {
+                string::shared s{cstrview{}};
+                snn_require(s.is_empty());
+                snn_require(s.use_count() == 0);
+            }
+            {
+                const str data{"abcdefghijklmnopqrstuvwxyz"};
+                string::shared s{data};
+                snn_require(s);
+                snn_require(s.view() == data);
+                snn_require(s.data().get() != data.data().get());
+                snn_require(s.byte_size().get() == 26);
+                snn_require(s.range().count() == 26);
+                snn_require(s.view(23) == "xyz");
+                snn_require(s.view(23, 2) == "xy");
+
+                // Null-terminated (but not a substring).
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+                snn_require(s.data().get()[26] == '\0');
+                SNN_DIAGNOSTIC_POP
+
+                // Cached hash.
+                const usize h = s.hash();
+                snn_require(h == data.hash());
+                snn_require(s.hash() == h);
+                snn_require(std::hash<string::shared>{}(s) == h);
+
+                string::shared sub = s.substring(24);
+                snn_require(sub == "yz");
+                snn_require(s.use_count() == 2);
+
+                snn_require(s.substring(26).is_empty());
+                snn_require(s.substring(100).is_empty());
+                snn_require(s.use_count() == 2);
+
+                // Substring of substring.
+                string::shared z = sub.substring(1, 10);
+                snn_require(z == "z");
+                snn_require(s.use_count() == 3);
+
+                // Outlives the original.
+                s = string::shared{};
+                snn_require(s.is_empty());
+                snn_require(sub.use_count() == 2);
+                snn_require(sub == "yz");
+
+                // Move.
+                string::shared moved{std::move(sub)};
+                snn_require(sub.is_empty());
+                snn_require(moved == "yz");
+                snn_require(moved.use_count() == 2);
+
+                moved = std::move(z);
+                snn_require(moved == "z");
+                snn_require(moved.use_count() == 2); // `z` now holds "yz".
+                snn_require(z == "yz");
+
+                // Self assignment.
+                indirect_self_assignment(moved, moved);
+                snn_require(moved == "z");
+                snn_require(moved.use_count() == 2);
+            }
+            {
+                string::shared a{"abc"};
+                string::shared b{"abd"};
+                snn_require(a < b);
+                snn_require(a != b);
+                snn_require(a == cstrview{"abc"});
+                snn_require(a <= "abc");
+                snn_require(b > "abc");
+                snn_require(a == string::shared{"abc"});
+            }
+            {
+                // Fan-out.
+                string::shared s{"Payload"};
+                vec<string::shared> v;
+                for (usize i = 0; i < 100; ++i)
+                {
+                    v.append(s);
+                }
+                snn_require(s.use_count() == 101);
+                snn_require(v.all([&](const string::shared& c) {
+                    return c.data().get() == s.data().get();
+                }));
+                v.clear();
+                snn_require(s.use_count() == 1);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_shared());
+
+        static_assert(sizeof(string::shared) == 24);
+        static_assert(is_trivially_relocatable_v<string::shared>);
+    }
+}
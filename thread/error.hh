@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Error (enum etc)
+
+#pragma once
+
+#include "snn-core/array.hh"
+#include "snn-core/error_code.hh"
+
+namespace snn::thread
+{
+    // ## Enums
+
+    // ### error
+
+    enum class error : u8
+    {
+        no_error = 0,
+        no_task_result,
+        unhandled_exception_in_task, // Last (used below).
+    };
+
+    // ## Constants
+
+    // ### error_count
+
+    inline constexpr usize error_count = 3;
+    static_assert(to_underlying(error::unhandled_exception_in_task) == (error_count - 1));
+
+    // ## Arrays
+
+    // ### error_messages
+
+    // clang-format off
+    inline constexpr array<null_term<const char*>, error_count> error_messages{
+        "No error",
+        "No task result (already taken or no task)",
+        "Unhandled exception in task",
+    };
+    // clang-format on
+
+    // ## Constants
+
+    // ### error_category
+
+    inline constexpr error_category error_category{"snn::thread", "Thread", error_messages};
+
+    // ## Functions
+
+    // ### make_error_code
+
+    [[nodiscard]] constexpr error_code make_error_code(const error e) noexcept
+    {
+        return error_code{i32{to_underlying(e)}, error_category};
+    }
+}
+
+namespace snn
+{
+    // ## Specializations
+
+    // ### is_error_code_enum_strict
+
+    template <>
+    struct is_error_code_enum_strict<thread::error> : public std::true_type
+    {
+    };
+}
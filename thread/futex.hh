@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Futex wait/wake on a 32-bit atomic
+
+// Process-private `futex` (Linux) or `_umtx_op` (FreeBSD). A wait only blocks if the atomic still
+// holds the expected value, so a wake between checking a condition and waiting is never lost.
+
+// Waits can return spuriously (signals, a wake meant for another condition), callers must check
+// their condition in a loop.
+
+#pragma once
+
+#include "snn-core/time/duration.hh"
+#include <atomic> // atomic
+#include <cerrno> // errno, ETIMEDOUT
+#include <time.h> // timespec
+#if defined(__linux__)
+    #include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+    #include <sys/syscall.h> // SYS_futex
+    #include <unistd.h>      // syscall
+#elif defined(__FreeBSD__)
+    #include <sys/types.h> // Must be included before <sys/umtx.h>.
+    #include <sys/umtx.h>  // _umtx_op, UMTX_OP_WAIT_UINT_PRIVATE, UMTX_OP_WAKE_PRIVATE
+#endif
+
+namespace snn::thread::futex
+{
+    static_assert(sizeof(std::atomic<u32>) == sizeof(u32));
+    static_assert(std::atomic<u32>::is_always_lock_free);
+
+    namespace detail
+    {
+        inline u32* address(const std::atomic<u32>& word) noexcept
+        {
+            // The kernel only reads the value.
+            return const_cast<u32*>(reinterpret_cast<const u32*>(&word));
+        }
+
+        // Returns `false` on timeout.
+        inline bool wait(const std::atomic<u32>& word, const u32 expected,
+                         ::timespec* const timeout) noexcept
+        {
+#if defined(__linux__)
+            // The timeout is relative (measured against `CLOCK_MONOTONIC`).
+            if (::syscall(SYS_futex, address(word), FUTEX_WAIT_PRIVATE, expected, timeout,
+                          nullptr, 0) == -1)
+            {
+                // `EAGAIN` (value changed) and `EINTR` are treated as a wake.
+                return errno != ETIMEDOUT;
+            }
+#elif defined(__FreeBSD__)
+            // "If uaddr2 is non-NULL, it points to a timeout ... uaddr must be the size of the
+            // structure pointed to by uaddr2."
+            void* const size = timeout != nullptr
+                                   ? reinterpret_cast<void*>(sizeof(::timespec))
+                                   : nullptr;
+            if (::_umtx_op(address(word), UMTX_OP_WAIT_UINT_PRIVATE, expected, size, timeout) ==
+                -1)
+            {
+                return errno != ETIMEDOUT;
+            }
+#else
+    #error "Unsupported platform"
+#endif
+            return true;
+        }
+
+        inline void wake(const std::atomic<u32>& word, const int count) noexcept
+        {
+#if defined(__linux__)
+            ::syscall(SYS_futex, address(word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#elif defined(__FreeBSD__)
+            ::_umtx_op(address(word), UMTX_OP_WAKE_PRIVATE, static_cast<unsigned long>(count),
+                       nullptr, nullptr);
+#endif
+        }
+    }
+
+    // ## Functions
+
+    // ### wait
+
+    // Block while `word == expected`.
+
+    inline void wait(const std::atomic<u32>& word, const u32 expected) noexcept
+    {
+        detail::wait(word, expected, nullptr);
+    }
+
+    // Returns `false` if `timeout` expired (a negative timeout is treated as zero).
+    inline bool wait(const std::atomic<u32>& word, const u32 expected,
+                     const time::duration timeout) noexcept
+    {
+        ::timespec ts{.tv_sec = 0, .tv_nsec = 0};
+        if (timeout > time::duration{})
+        {
+            ts.tv_sec  = timeout.seconds_part();
+            ts.tv_nsec = to_i32(timeout.nanoseconds_part());
+        }
+        return detail::wait(word, expected, &ts);
+    }
+
+    // ### wake_one
+
+    inline void wake_one(const std::atomic<u32>& word) noexcept
+    {
+        detail::wake(word, 1);
+    }
+
+    // ### wake_all
+
+    inline void wake_all(const std::atomic<u32>& word) noexcept
+    {
+        detail::wake(word, constant::limit<int>::max);
+    }
+}
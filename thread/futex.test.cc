@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/thread/futex.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/time/stopwatch.hh"
+#include "snn-core/time/unit.hh"
+#include <thread> // thread
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            std::atomic<u32> ready{0};
+
+            std::thread th{[&ready] {
+                ready.store(1);
+                thread::futex::wake_all(ready);
+            }};
+
+            // The wait doesn't block if the value isn't the expected value, and it can return
+            // spuriously, so always check in a loop.
+            while (ready.load() == 0)
+            {
+                thread::futex::wait(ready, 0);
+            }
+
+            th.join();
+
+            return true;
+        }
+
+        bool test_futex()
+        {
+            {
+                std::atomic<u32> word{7};
+
+                // Not the expected value, returns immediately.
+                snn_require(thread::futex::wait(word, 8, time::seconds{10}.duration().value()));
+
+                // Timeout.
+                const time::duration timeout = time::milliseconds{2}.duration().value();
+                time::stopwatch stopwatch;
+                snn_require(!thread::futex::wait(word, 7, timeout));
+                snn_require(stopwatch.nanoseconds() >= 2'000'000);
+
+                // Negative timeout.
+                snn_require(!thread::futex::wait(word, 7, time::duration{-1, 0}));
+
+                // No waiters.
+                thread::futex::wake_one(word);
+                thread::futex::wake_all(word);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_futex());
+    }
+}
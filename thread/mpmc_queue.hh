@@ -0,0 +1,384 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Bounded multi-producer/multi-consumer queue (lock-free)
+
+// Dmitry Vyukov's bounded MPMC queue: a ring buffer where every cell has a sequence number. A
+// producer claims a cell with a compare-and-swap on the tail index when the cell's sequence
+// equals the position, constructs the value and publishes it by storing `position + 1`. A
+// consumer does the same on the head index and frees the cell by storing
+// `position + capacity`. Producers and consumers only contend on their own index.
+
+// * The capacity is a power of two (rounded up, at least 2), allocated once.
+// * The head and tail indices are on separate cache lines.
+// * Batch push/pop (`try_push_n(...)`/`try_pop_n(...)`) claim a run of consecutive cells with a
+//   single compare-and-swap. Batch pop relocates values (`memcpy` for trivially relocatable
+//   types).
+// * Cells are allocated with `Alloc` (`allocator_type` and `cell_type`).
+// * Blocking `push(...)`/`pop()` (with optional timeouts) wait on a futex, see
+//   [futex.hh](futex.hh). A non-blocking operation never makes a system call unless another
+//   thread is blocked.
+
+// A claimed cell must be constructed, so values are constructed with a non-throwing constructor.
+
+#pragma once
+
+#include "snn-core/array_view.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/optional.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/detail/queue/signal.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/mem/construct.hh"
+#include "snn-core/mem/destruct.hh"
+#include "snn-core/time/duration.hh"
+#include <atomic> // atomic, memory_order
+#include <bit>    // bit_ceil
+
+namespace snn
+{
+    namespace detail::mpmc_queue
+    {
+        SNN_DIAGNOSTIC_PUSH
+        SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+        template <typename T>
+        struct cell final
+        {
+            std::atomic<usize> sequence;
+            alignas(T) byte data[sizeof(T)];
+
+            explicit cell(const usize seq) noexcept
+                : sequence{seq}
+            {
+                // `data` is uninitialized.
+            }
+
+            T* get() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(&data[0]));
+            }
+        };
+
+        SNN_DIAGNOSTIC_POP
+    }
+}
+
+namespace snn::thread
+{
+    // ## Classes
+
+    // ### mpmc_queue
+
+    template <typename T, typename Alloc = mem::allocator<detail::mpmc_queue::cell<T>>>
+    class mpmc_queue final
+    {
+      public:
+        static_assert(std::is_nothrow_move_constructible_v<T>);
+
+        // #### Types
+
+        using value_type     = T;
+        using allocator_type = Alloc;
+        using cell_type      = detail::mpmc_queue::cell<T>;
+
+        // #### Constants
+
+        static constexpr usize max_capacity = usize{1} << (sizeof(usize) * 8 - 2);
+
+        // #### Explicit constructors
+
+        // The capacity is rounded up to a power of two (at least 2, with a single cell the
+        // sequence number of a published value equals the next position).
+        explicit mpmc_queue(const not_zero<usize> capacity, const Alloc& alloc = Alloc{})
+            : alloc_{alloc}
+        {
+            if (capacity.get() > max_capacity)
+            {
+                throw_or_abort(generic::error::invalid_value);
+            }
+            const usize cap = std::bit_ceil(math::max(capacity.get(), usize{2}));
+            cells_          = alloc_.allocate(not_zero{cap}).value();
+            mask_           = cap - 1;
+            for (usize i = 0; i < cap; ++i)
+            {
+                mem::construct(not_null{cell_(i)}, i);
+            }
+        }
+
+        // #### Non-copyable/non-movable
+
+        mpmc_queue(const mpmc_queue&)            = delete;
+        mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+        mpmc_queue(mpmc_queue&&)            = delete;
+        mpmc_queue& operator=(mpmc_queue&&) = delete;
+
+        // #### Destructor
+
+        ~mpmc_queue()
+        {
+            const usize tail = tail_.load(std::memory_order_relaxed);
+            for (usize pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos)
+            {
+                mem::destruct(not_null{cell_(pos)->get()});
+            }
+            for (usize i = 0; i <= mask_; ++i)
+            {
+                mem::destruct(not_null{cell_(i)});
+            }
+            alloc_.deallocate(cells_, mask_ + 1);
+        }
+
+        // #### Capacity
+
+        [[nodiscard]] usize capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+        // #### Push
+
+        // Returns `false` if the queue is full (nothing is constructed, nothing is moved).
+        template <typename... Args>
+            requires(std::is_nothrow_constructible_v<T, Args...>)
+        bool try_push_inplace(Args&&... args) noexcept
+        {
+            usize pos = tail_.load(std::memory_order_relaxed);
+            if (claim_(tail_, pos, 0, 1) == 0)
+            {
+                return false;
+            }
+            cell_type* const c = cell_(pos);
+            mem::construct(not_null{c->get()}, std::forward<Args>(args)...);
+            c->sequence.store(pos + 1, std::memory_order_release);
+            not_empty_.notify();
+            return true;
+        }
+
+        // Returns `false` if the queue is full (`value` is only moved on success).
+        bool try_push(T&& value) noexcept
+        {
+            return try_push_inplace(std::move(value));
+        }
+
+        // Moves as many values as there is space for (from the front), returns the number of
+        // values moved.
+        usize try_push_n(array_view<T> values) noexcept
+        {
+            usize pos         = tail_.load(std::memory_order_relaxed);
+            const usize count = claim_(tail_, pos, 0, values.count());
+            if (count > 0)
+            {
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+                T* const src = values.begin();
+                for (usize i = 0; i < count; ++i)
+                {
+                    cell_type* const c = cell_(pos + i);
+                    mem::construct(not_null{c->get()}, std::move(src[i]));
+                    c->sequence.store(pos + i + 1, std::memory_order_release);
+                }
+
+                SNN_DIAGNOSTIC_POP
+
+                not_empty_.notify();
+            }
+            return count;
+        }
+
+        // Blocks while the queue is full.
+        void push(T&& value) noexcept
+        {
+            detail::queue::retry(
+                not_full_, [&] { return try_push(std::move(value)); },
+                [&] { return is_ready_to_push_(); });
+        }
+
+        // Returns `false` if `timeout` expired (`value` is only moved on success).
+        bool push(T&& value, const time::duration timeout) noexcept
+        {
+            return detail::queue::retry(
+                not_full_, [&] { return try_push(std::move(value)); },
+                [&] { return is_ready_to_push_(); }, timeout);
+        }
+
+        // Blocks until all values have been moved.
+        void push_n(array_view<T> values) noexcept
+        {
+            detail::queue::retry(
+                not_full_,
+                [&] {
+                    values.drop_front_n(try_push_n(values));
+                    return values.is_empty();
+                },
+                [&] { return is_ready_to_push_(); });
+        }
+
+        // #### Pop
+
+        [[nodiscard]] optional<T> try_pop() noexcept
+        {
+            usize pos = head_.load(std::memory_order_relaxed);
+            if (claim_(head_, pos, 1, 1) == 0)
+            {
+                return nullopt;
+            }
+            cell_type* const c = cell_(pos);
+            T* const value_ptr = c->get();
+            optional<T> value{std::move(*value_ptr)};
+            mem::destruct(not_null{value_ptr});
+            c->sequence.store(pos + capacity(), std::memory_order_release);
+            not_full_.notify();
+            return value;
+        }
+
+        // Appends at most `max_count` values to `out`, returns the number of values appended.
+        usize try_pop_n(vec<T>& out, const usize max_count)
+        {
+            // Reserve before claiming (a claimed cell must be consumed).
+            out.reserve_append(math::min(max_count, capacity()));
+
+            usize pos         = head_.load(std::memory_order_relaxed);
+            const usize count = claim_(head_, pos, 1, max_count);
+            if (count > 0)
+            {
+                for (usize i = 0; i < count; ++i)
+                {
+                    cell_type* const c = cell_(pos + i);
+                    T* const value_ptr = c->get();
+                    SNN_DIAGNOSTIC_PUSH
+                    SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+                    out.append_relocate(not_null{value_ptr}, not_null{value_ptr + 1});
+                    SNN_DIAGNOSTIC_POP
+                    c->sequence.store(pos + i + capacity(), std::memory_order_release);
+                }
+                not_full_.notify();
+            }
+            return count;
+        }
+
+        // Blocks while the queue is empty.
+        [[nodiscard]] T pop() noexcept
+        {
+            optional<T> value{nullopt};
+            detail::queue::retry(
+                not_empty_,
+                [&] {
+                    value = try_pop();
+                    return value.has_value();
+                },
+                [&] { return is_ready_to_pop_(); });
+            return std::move(value.value(assume::has_value));
+        }
+
+        // Returns an empty optional if `timeout` expired.
+        [[nodiscard]] optional<T> pop(const time::duration timeout) noexcept
+        {
+            optional<T> value{nullopt};
+            detail::queue::retry(
+                not_empty_,
+                [&] {
+                    value = try_pop();
+                    return value.has_value();
+                },
+                [&] { return is_ready_to_pop_(); }, timeout);
+            return value;
+        }
+
+        // Blocks while the queue is empty, then appends at most `max_count` values to `out`.
+        usize pop_n(vec<T>& out, const usize max_count)
+        {
+            usize count = 0;
+            detail::queue::retry(
+                not_empty_,
+                [&] {
+                    count = try_pop_n(out, max_count);
+                    return count > 0 || max_count == 0;
+                },
+                [&] { return is_ready_to_pop_(); });
+            return count;
+        }
+
+      private:
+        // Read-only after construction.
+        alignas(detail::queue::cache_line_size) cell_type* cells_{nullptr};
+        usize mask_{0};
+        [[no_unique_address]] Alloc alloc_;
+
+        alignas(detail::queue::cache_line_size) std::atomic<usize> head_{0};
+        alignas(detail::queue::cache_line_size) std::atomic<usize> tail_{0};
+
+        alignas(detail::queue::cache_line_size) detail::queue::signal not_empty_;
+        alignas(detail::queue::cache_line_size) detail::queue::signal not_full_;
+
+        cell_type* cell_(const usize pos) const noexcept
+        {
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+            cell_type* const c = cells_ + (pos & mask_);
+            SNN_DIAGNOSTIC_POP
+            return c;
+        }
+
+        // Claims at most `wanted` consecutive cells starting at `pos` (updated to the claimed
+        // position). A cell is ready when its sequence is `position + offset` (0 for producers,
+        // 1 for consumers). Returns the number of cells claimed (0 if the first cell isn't ready).
+        usize claim_(std::atomic<usize>& index, usize& pos, const usize offset,
+                     const usize wanted) noexcept
+        {
+            while (wanted > 0)
+            {
+                usize count = 0;
+                while (count < wanted && count <= mask_)
+                {
+                    const usize seq =
+                        cell_(pos + count)->sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<isize>(seq - (pos + count + offset));
+                    if (diff != 0)
+                    {
+                        if (diff > 0 && count == 0)
+                        {
+                            // Another thread claimed this position, reload and retry.
+                            count = constant::npos;
+                        }
+                        break;
+                    }
+                    ++count;
+                }
+
+                if (count == constant::npos)
+                {
+                    pos = index.load(std::memory_order_relaxed);
+                }
+                else if (count == 0)
+                {
+                    return 0; // Full (producer) or empty (consumer).
+                }
+                else if (index.compare_exchange_weak(pos, pos + count,
+                                                     std::memory_order_relaxed))
+                {
+                    return count;
+                }
+            }
+            return 0;
+        }
+
+        bool is_ready_to_push_() const noexcept
+        {
+            const usize pos = tail_.load(std::memory_order_relaxed);
+            const usize seq = cell_(pos)->sequence.load(std::memory_order_acquire);
+            return static_cast<isize>(seq - pos) >= 0; // Ready or already claimed (retry).
+        }
+
+        bool is_ready_to_pop_() const noexcept
+        {
+            const usize pos = head_.load(std::memory_order_relaxed);
+            const usize seq = cell_(pos)->sequence.load(std::memory_order_acquire);
+            return static_cast<isize>(seq - (pos + 1)) >= 0; // Ready or already claimed (retry).
+        }
+    };
+}
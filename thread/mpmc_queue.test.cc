@@ -0,0 +1,247 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/thread/mpmc_queue.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/mem/pool_resource.hh"
+#include "snn-core/mem/resource_allocator.hh"
+#include "snn-core/time/unit.hh"
+#include <atomic> // atomic
+#include <thread> // thread
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            thread::mpmc_queue<str> q{not_zero<usize>{16}};
+
+            vec<std::thread> producers;
+            for (usize t = 0; t < 2; ++t)
+            {
+                producers.append_inplace([&q] {
+                    for (usize i = 0; i < 1000; ++i)
+                    {
+                        q.push(str{"record"}); // Blocks while the queue is full.
+                    }
+                });
+            }
+
+            std::atomic<usize> count{0};
+            vec<std::thread> consumers;
+            for (usize t = 0; t < 2; ++t)
+            {
+                consumers.append_inplace([&q, &count] {
+                    while (true)
+                    {
+                        const str s = q.pop(); // Blocks while the queue is empty.
+                        if (s.is_empty())
+                        {
+                            break; // End marker.
+                        }
+                        count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+
+            for (std::thread& th : producers)
+            {
+                th.join();
+            }
+            q.push(str{});
+            q.push(str{});
+            for (std::thread& th : consumers)
+            {
+                th.join();
+            }
+
+            snn_require(count.load() == 2000);
+
+            return true;
+        }
+
+        bool test_mpmc_queue()
+        {
+            {
+                thread::mpmc_queue<str> q{not_zero<usize>{2}};
+                snn_require(q.capacity() == 2);
+                snn_require(!q.try_pop());
+
+                str a{"A string that is too long for the short string optimization."};
+                snn_require(q.try_push(std::move(a)));
+                snn_require(a.is_empty()); // Moved.
+
+                snn_require(q.try_push_inplace(str{"b"})); // Non-throwing constructor only.
+
+                str c{"Another string that is too long for the short string optimization."};
+                snn_require(!q.try_push(std::move(c))); // Full.
+                snn_require(c.size() > 60);             // Not moved.
+
+                snn_require(q.try_pop().value() ==
+                            "A string that is too long for the short string optimization.");
+                snn_require(q.try_push(std::move(c)));
+                snn_require(q.try_pop().value() == "b");
+                snn_require(q.try_pop().value().size() > 60);
+                snn_require(!q.try_pop());
+
+                // Destructor drops remaining values.
+                snn_require(q.try_push(str{"Yet another string that is not stored inline."}));
+            }
+            {
+                // Batch.
+                thread::mpmc_queue<usize> q{not_zero<usize>{8}};
+
+                vec<usize> values;
+                for (usize i = 0; i < 10; ++i)
+                {
+                    values.append(i);
+                }
+                snn_require(q.try_push_n(values.view()) == 8);
+
+                vec<usize> out;
+                snn_require(q.try_pop_n(out, 3) == 3);
+                snn_require(out.count() == 3);
+                snn_require(out.at(2).value() == 2);
+
+                snn_require(q.try_push_n(values.view(8)) == 2);
+                snn_require(q.try_pop_n(out, 100) == 7);
+                snn_require(out.count() == 10);
+                for (usize i = 0; i < 10; ++i)
+                {
+                    snn_require(out.at(i).value() == i);
+                }
+                snn_require(q.try_pop_n(out, 100) == 0);
+            }
+            {
+                // Batch with an allocator, the values are relocated.
+                using cell_type  = thread::mpmc_queue<str>::cell_type;
+                using alloc_type = mem::resource_allocator<cell_type, mem::pool_resource<>>;
+                using queue_type = thread::mpmc_queue<str, alloc_type>;
+
+                mem::pool_resource<> pool;
+                queue_type q{not_zero<usize>{4}, alloc_type{pool}};
+
+                vec<str> values;
+                values.append("A string that is long enough to be stored on the heap.");
+                values.append("Short");
+                values.append("Another string that is long enough to be stored on the heap.");
+                snn_require(q.try_push_n(values.view()) == 3);
+
+                vec<str> out;
+                snn_require(q.try_pop_n(out, 2) == 2);
+                snn_require(q.try_push(str{"Wraps"}));
+                snn_require(q.try_pop_n(out, 100) == 2);
+                snn_require(out.count() == 4);
+                snn_require(out.at(0).value() ==
+                            "A string that is long enough to be stored on the heap.");
+                snn_require(out.at(1).value() == "Short");
+                snn_require(out.at(2).value() ==
+                            "Another string that is long enough to be stored on the heap.");
+                snn_require(out.at(3).value() == "Wraps");
+            }
+            {
+                // Timeouts.
+                thread::mpmc_queue<int> q{not_zero<usize>{1}};
+                snn_require(q.capacity() == 2); // Minimum capacity.
+
+                const time::duration timeout = time::milliseconds{2}.duration().value();
+
+                snn_require(!q.pop(timeout));
+                snn_require(q.push(123, timeout));
+                snn_require(q.push(456, timeout));
+                snn_require(!q.push(789, timeout)); // Full.
+                snn_require(q.pop(timeout).value() == 123);
+                snn_require(q.pop(timeout).value() == 456);
+            }
+            {
+                // Every value is popped exactly once.
+                constexpr usize thread_count = 4;
+                constexpr usize per_thread   = 50'000;
+                constexpr usize total        = thread_count * per_thread;
+
+                thread::mpmc_queue<usize> q{not_zero<usize>{128}};
+
+                vec<std::thread> threads;
+                for (usize t = 0; t < thread_count; ++t)
+                {
+                    threads.append_inplace([&q, t] {
+                        vec<usize> batch;
+                        for (usize i = 0; i < per_thread;)
+                        {
+                            batch.clear();
+                            for (usize j = 0; j < 13 && i < per_thread; ++j, ++i)
+                            {
+                                batch.append((t * per_thread) + i);
+                            }
+                            q.push_n(batch.view());
+                        }
+                    });
+                }
+
+                vec<vec<usize>> popped;
+                for (usize t = 0; t < thread_count; ++t)
+                {
+                    popped.append_inplace();
+                }
+
+                std::atomic<usize> remaining{total};
+                vec<std::thread> consumers;
+                for (usize t = 0; t < thread_count; ++t)
+                {
+                    consumers.append_inplace([&q, &remaining, out = &popped.at(t).value()] {
+                        const time::duration timeout = time::milliseconds{1}.duration().value();
+                        while (remaining.load() > 0)
+                        {
+                            if (auto v = q.pop(timeout))
+                            {
+                                out->append(v.value());
+                                remaining.fetch_sub(1);
+                            }
+                        }
+                    });
+                }
+
+                for (std::thread& th : threads)
+                {
+                    th.join();
+                }
+                for (std::thread& th : consumers)
+                {
+                    th.join();
+                }
+
+                vec<u8> seen{init::reserve, total};
+                for (usize i = 0; i < total; ++i)
+                {
+                    seen.append(0);
+                }
+                for (const vec<usize>& out : popped)
+                {
+                    for (const usize v : out)
+                    {
+                        snn_require(v < total);
+                        ++seen.at(v).value();
+                    }
+                }
+                for (const u8 s : seen)
+                {
+                    snn_require(s == 1);
+                }
+                snn_require(!q.try_pop());
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_mpmc_queue());
+    }
+}
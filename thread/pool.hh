@@ -0,0 +1,744 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Thread pool with work stealing and per-worker arenas
+
+// * A fixed number of workers, optionally pinned to CPUs (worker `i` to CPU `i % cpu_count()`,
+//   Linux/FreeBSD).
+// * Every worker has its own bounded task queue (see [mpmc\_queue.hh](mpmc_queue.hh)). Tasks
+//   submitted from outside the pool are distributed round-robin, tasks submitted from a worker go
+//   to the worker's own queue. An idle worker steals from the other queues before it blocks (on a
+//   futex).
+// * `submit(...)` returns a `task<T>` handle, `get()` blocks until the task is done and returns a
+//   `result<T>`. An `snn::exception` thrown by a task becomes the error code of the result.
+// * Every worker has a `mem::arena` which is the current arena (see `arena_scope`) of the worker
+//   thread. The arena is reset after every task, so per-task scratch memory is never freed
+//   individually.
+// * Queue and run times are measured with `time::stopwatch`, per task (`task<T>`) and per worker
+//   (`stats(...)`).
+
+// A task can be invocable with no arguments or with a `thread::task_context&` (worker index and
+// arena).
+
+// Blocking on a task from inside another task can deadlock if all workers are blocked.
+
+#pragma once
+
+#include "snn-core/exception.hh"
+#include "snn-core/result.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/mem/arena.hh"
+#include "snn-core/mem/construct.hh"
+#include "snn-core/mem/destruct.hh"
+#include "snn-core/thread/error.hh"
+#include "snn-core/thread/futex.hh"
+#include "snn-core/thread/mpmc_queue.hh"
+#include "snn-core/time/duration.hh"
+#include "snn-core/time/stopwatch.hh"
+#include <atomic>     // atomic, memory_order
+#include <pthread.h>  // pthread_self, pthread_setaffinity_np
+#include <thread>     // thread
+#include <unistd.h>   // sysconf
+#if defined(__FreeBSD__)
+    #include <pthread_np.h> // pthread_setaffinity_np
+    #include <sys/cpuset.h> // cpuset_t, CPU_SET, CPU_ZERO
+#elif defined(__linux__)
+    #include <sched.h> // cpu_set_t, CPU_SET, CPU_ZERO
+#endif
+
+namespace snn::thread
+{
+    // ## Classes
+
+    // ### task_context
+
+    // Passed to a task that is invocable with a `task_context&`.
+
+    class task_context final
+    {
+      public:
+        explicit task_context(const usize worker_index, mem::arena& arena) noexcept
+            : worker_index_{worker_index},
+              arena_{arena}
+        {
+        }
+
+        [[nodiscard]] usize worker_index() const noexcept
+        {
+            return worker_index_;
+        }
+
+        // Scratch memory, reset after the task (unless the task was run inline by a worker
+        // because its queue was full).
+        [[nodiscard]] mem::arena& arena() noexcept
+        {
+            return arena_;
+        }
+
+      private:
+        usize worker_index_;
+        mem::arena& arena_;
+    };
+}
+
+namespace snn::detail::pool
+{
+    // Type-erased task (the state pointer owns a reference).
+    struct job final
+    {
+        time::duration (*run)(void*, thread::task_context&) noexcept;
+        void* state;
+    };
+
+    // Shared by a task handle and a job.
+    template <typename T>
+    struct state_base
+    {
+        static constexpr u32 pending             = 0;
+        static constexpr u32 done                = 1;
+        static constexpr u32 pending_with_waiter = 2;
+
+        std::atomic<u32> references{2};
+        std::atomic<u32> status{pending};
+        result<T> value{thread::error::no_task_result};
+        time::stopwatch stopwatch; // Started on submit.
+        time::duration queue_duration;
+        time::duration run_duration;
+        void (*destroy)(state_base*) noexcept;
+
+        explicit state_base(void (*const destroy_fn)(state_base*) noexcept) noexcept
+            : destroy{destroy_fn}
+        {
+        }
+
+        void release() noexcept
+        {
+            if (references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                destroy(this);
+            }
+        }
+
+        void complete() noexcept
+        {
+            if (status.exchange(done, std::memory_order_acq_rel) == pending_with_waiter)
+            {
+                thread::futex::wake_all(status);
+            }
+        }
+
+        [[nodiscard]] bool is_done() const noexcept
+        {
+            return status.load(std::memory_order_acquire) == done;
+        }
+
+        // Returns `false` if the timeout expired.
+        bool wait(const time::duration* const timeout) noexcept
+        {
+            u32 s = status.load(std::memory_order_acquire);
+            if (s == done)
+            {
+                return true;
+            }
+
+            const time::duration deadline =
+                timeout != nullptr ? time::steady::duration_since_boot() + *timeout
+                                   : time::duration{};
+            while (s != done)
+            {
+                if (s == pending && !status.compare_exchange_weak(s, pending_with_waiter,
+                                                                  std::memory_order_acquire))
+                {
+                    continue; // `s` has been updated.
+                }
+
+                if (timeout != nullptr)
+                {
+                    const time::duration now = time::steady::duration_since_boot();
+                    if (now >= deadline ||
+                        !thread::futex::wait(status, pending_with_waiter, deadline - now))
+                    {
+                        return is_done();
+                    }
+                }
+                else
+                {
+                    thread::futex::wait(status, pending_with_waiter);
+                }
+
+                s = status.load(std::memory_order_acquire);
+            }
+            return true;
+        }
+    };
+
+    // The result type of a task, a task returning `result<T>` is a `task<T>`.
+
+    template <typename R>
+    struct value_type
+    {
+        using type = R;
+    };
+
+    template <typename T>
+    struct value_type<result<T>>
+    {
+        using type = T;
+    };
+
+    template <typename F>
+    decltype(auto) invoke(F& f, thread::task_context& ctx)
+    {
+        if constexpr (std::is_invocable_v<F&, thread::task_context&>)
+        {
+            return f(ctx);
+        }
+        else
+        {
+            return f();
+        }
+    }
+
+    template <typename F>
+    using invoke_result_t =
+        decltype(detail::pool::invoke(std::declval<F&>(), std::declval<thread::task_context&>()));
+
+    template <typename F>
+    using value_type_t = typename value_type<std::remove_cv_t<invoke_result_t<F>>>::type;
+
+    template <typename T, typename F>
+    struct state final : public state_base<T>
+    {
+        union
+        {
+            F fn; // Destroyed after the task has run.
+        };
+
+        template <typename G>
+        explicit state(G&& g)
+            : state_base<T>{&destroy_},
+              fn{std::forward<G>(g)}
+        {
+        }
+
+        // Non-copyable
+        state(const state&)            = delete;
+        state& operator=(const state&) = delete;
+
+        // Non-movable
+        state(state&&)            = delete;
+        state& operator=(state&&) = delete;
+
+        ~state()
+        {
+            // `fn` has already been destroyed.
+        }
+
+        static time::duration run(void* const ptr, thread::task_context& ctx) noexcept
+        {
+            auto* const s     = static_cast<state*>(ptr);
+            s->queue_duration = s->stopwatch.duration();
+            s->stopwatch.reset();
+
+            try
+            {
+                using R = invoke_result_t<F>;
+                if constexpr (std::is_void_v<R>)
+                {
+                    detail::pool::invoke(s->fn, ctx);
+                    s->value = result<void>{};
+                }
+                else if constexpr (std::is_same_v<std::remove_cv_t<R>, result<T>>)
+                {
+                    s->value = detail::pool::invoke(s->fn, ctx);
+                }
+                else
+                {
+                    s->value = result<T>{detail::pool::invoke(s->fn, ctx)};
+                }
+            }
+            catch (const exception& e)
+            {
+                s->value = result<T>{e.error_code()};
+            }
+            catch (...)
+            {
+                s->value = result<T>{thread::error::unhandled_exception_in_task};
+            }
+
+            mem::destruct(not_null{&s->fn});
+
+            const time::duration run_duration = s->stopwatch.duration();
+            s->run_duration                   = run_duration;
+            s->complete();
+            s->release();
+            return run_duration;
+        }
+
+      private:
+        static void destroy_(state_base<T>* const base) noexcept
+        {
+            auto* const s = static_cast<state*>(base);
+            mem::destruct(not_null{s});
+            mem::allocator<state>{}.deallocate(s, 1);
+        }
+    };
+
+    struct alignas(detail::queue::cache_line_size) worker final
+    {
+        thread::mpmc_queue<job> queue;
+        mem::arena arena;
+        std::thread thread;
+
+        // Only written by the worker thread.
+        std::atomic<usize> task_count{0};
+        std::atomic<usize> steal_count{0};
+        std::atomic<i64> busy_nanoseconds{0};
+        std::atomic<i64> max_nanoseconds{0};
+
+        explicit worker(const usize queue_capacity, const usize arena_block_size)
+            : queue{not_zero{math::max(queue_capacity, usize{1})}},
+              arena{arena_block_size}
+        {
+        }
+    };
+
+    struct current_worker final
+    {
+        const void* pool;
+        usize index;
+    };
+
+    inline current_worker& current() noexcept
+    {
+        static thread_local current_worker cw{nullptr, 0};
+        return cw;
+    }
+
+    // Returns `false` if pinning is not supported or failed.
+    inline bool pin_to_cpu(const usize cpu) noexcept
+    {
+#if defined(__FreeBSD__) || defined(__linux__)
+    #if defined(__FreeBSD__)
+        cpuset_t set;
+    #else
+        cpu_set_t set;
+    #endif
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+        ignore_if_unused(cpu);
+        return false;
+#endif
+    }
+}
+
+namespace snn::thread
+{
+    // ## Classes
+
+    // ### task
+
+    // Handle to a submitted task. The task runs to completion even if the handle is destroyed.
+
+    template <typename T>
+    class task final
+    {
+      public:
+        // #### Default constructor
+
+        // No task.
+        constexpr task() noexcept = default;
+
+        // #### Explicit constructors
+
+        explicit task(detail::pool::state_base<T>* const state) noexcept
+            : state_{state}
+        {
+        }
+
+        // #### Non-copyable
+
+        task(const task&)            = delete;
+        task& operator=(const task&) = delete;
+
+        // #### Movable
+
+        task(task&& other) noexcept
+            : state_{std::exchange(other.state_, nullptr)}
+        {
+        }
+
+        task& operator=(task&& other) noexcept
+        {
+            std::swap(state_, other.state_);
+            return *this;
+        }
+
+        // #### Destructor
+
+        ~task()
+        {
+            if (state_ != nullptr)
+            {
+                state_->release();
+            }
+        }
+
+        // #### Explicit conversion operators
+
+        // Has a task.
+        explicit operator bool() const noexcept
+        {
+            return state_ != nullptr;
+        }
+
+        // #### Status
+
+        [[nodiscard]] bool is_done() const noexcept
+        {
+            return state_ != nullptr && state_->is_done();
+        }
+
+        // #### Wait
+
+        void wait() const noexcept
+        {
+            if (state_ != nullptr)
+            {
+                state_->wait(nullptr);
+            }
+        }
+
+        // Returns `false` if `timeout` expired (or if there is no task).
+        bool wait(const time::duration timeout) const noexcept
+        {
+            return state_ != nullptr && state_->wait(&timeout);
+        }
+
+        // #### Result
+
+        // Blocks until the task is done. The result can only be taken once.
+        [[nodiscard]] result<T> get() noexcept
+        {
+            if (state_ == nullptr)
+            {
+                return thread::error::no_task_result;
+            }
+            state_->wait(nullptr);
+            return std::exchange(state_->value, result<T>{thread::error::no_task_result});
+        }
+
+        // #### Timing
+
+        // Time from submit until the task started running. The task must be done.
+        [[nodiscard]] time::duration queue_duration() const noexcept
+        {
+            snn_assert(is_done());
+            return state_->queue_duration;
+        }
+
+        // The task must be done.
+        [[nodiscard]] time::duration run_duration() const noexcept
+        {
+            snn_assert(is_done());
+            return state_->run_duration;
+        }
+
+      private:
+        detail::pool::state_base<T>* state_{nullptr};
+    };
+
+    // ### pool_options
+
+    struct pool_options final
+    {
+        // Pin worker `i` to CPU `i % pool::cpu_count()` (best effort).
+        bool pin_to_cpus{false};
+
+        // Per worker, rounded up to a power of two. A full queue blocks submits from outside the
+        // pool, a task submitted from a worker with a full queue runs inline.
+        usize queue_capacity{1024};
+
+        usize arena_block_size{mem::arena::default_block_size};
+    };
+
+    // ### worker_stats
+
+    struct worker_stats final
+    {
+        usize task_count;
+        usize steal_count;       // Tasks taken from another worker's queue.
+        time::duration busy;     // Total run time.
+        time::duration max_task; // Longest run time.
+    };
+
+    // ### pool
+
+    class pool final
+    {
+      public:
+        // #### Explicit constructors
+
+        explicit pool(const not_zero<usize> worker_count, const pool_options options = {})
+            : worker_count_{worker_count.get()},
+              pin_to_cpus_{options.pin_to_cpus}
+        {
+            workers_ = alloc_.allocate(worker_count).value();
+
+            usize constructed = 0;
+            try
+            {
+                for (; constructed < worker_count_; ++constructed)
+                {
+                    mem::construct(not_null{&worker_(constructed)}, options.queue_capacity,
+                                   options.arena_block_size);
+                }
+                for (usize i = 0; i < worker_count_; ++i)
+                {
+                    worker_(i).thread = std::thread{[this, i] { work_(i); }};
+                }
+            }
+            catch (...)
+            {
+                stop_and_join_(constructed);
+                destroy_workers_(constructed);
+                throw;
+            }
+        }
+
+        // #### Non-copyable/non-movable
+
+        pool(const pool&)            = delete;
+        pool& operator=(const pool&) = delete;
+
+        pool(pool&&)            = delete;
+        pool& operator=(pool&&) = delete;
+
+        // #### Destructor
+
+        // Runs all queued tasks before the workers are joined.
+        ~pool()
+        {
+            stop_and_join_(worker_count_);
+            destroy_workers_(worker_count_);
+        }
+
+        // #### Workers
+
+        [[nodiscard]] usize worker_count() const noexcept
+        {
+            return worker_count_;
+        }
+
+        // Snapshot (the counters are updated while tasks run).
+        [[nodiscard]] worker_stats stats(const usize worker_index) const noexcept
+        {
+            snn_assert(worker_index < worker_count_);
+            const detail::pool::worker& w = worker_(worker_index);
+            const i64 busy                = w.busy_nanoseconds.load(std::memory_order_relaxed);
+            const i64 max                 = w.max_nanoseconds.load(std::memory_order_relaxed);
+            return worker_stats{
+                .task_count  = w.task_count.load(std::memory_order_relaxed),
+                .steal_count = w.steal_count.load(std::memory_order_relaxed),
+                .busy        = time::duration{0, busy},
+                .max_task    = time::duration{0, max},
+            };
+        }
+
+        // Number of online CPUs (at least 1).
+        [[nodiscard]] static usize cpu_count() noexcept
+        {
+            const long count = ::sysconf(_SC_NPROCESSORS_ONLN);
+            return count > 0 ? static_cast<usize>(count) : 1;
+        }
+
+        // #### Submit
+
+        template <typename F>
+            requires(std::is_move_constructible_v<std::decay_t<F>>)
+        [[nodiscard]] auto submit(F&& f) -> task<detail::pool::value_type_t<std::decay_t<F>>>
+        {
+            using Fn         = std::decay_t<F>;
+            using T          = detail::pool::value_type_t<Fn>;
+            using state_type = detail::pool::state<T, Fn>;
+
+            static_assert(!std::is_reference_v<T>, "A task can't return a reference.");
+
+            mem::allocator<state_type> alloc;
+            state_type* const s = alloc.allocate(not_zero<usize>{1}).value();
+            try
+            {
+                mem::construct(not_null{s}, std::forward<F>(f));
+            }
+            catch (...)
+            {
+                alloc.deallocate(s, 1);
+                throw;
+            }
+
+            task<T> handle{s};
+            push_(detail::pool::job{&state_type::run, s});
+            return handle;
+        }
+
+      private:
+        detail::pool::worker* workers_{nullptr};
+        usize worker_count_;
+        bool pin_to_cpus_;
+        [[no_unique_address]] mem::allocator<detail::pool::worker> alloc_;
+
+        alignas(detail::queue::cache_line_size) std::atomic<usize> next_{0};
+        alignas(detail::queue::cache_line_size) std::atomic<usize> queued_{0};
+        std::atomic<bool> stopping_{false};
+        alignas(detail::queue::cache_line_size) detail::queue::signal work_available_;
+
+        detail::pool::worker& worker_(const usize index) const noexcept
+        {
+            snn_should(index < worker_count_);
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+            detail::pool::worker& w = workers_[index];
+            SNN_DIAGNOSTIC_POP
+            return w;
+        }
+
+        void push_(const detail::pool::job j) noexcept
+        {
+            queued_.fetch_add(1, std::memory_order_relaxed);
+
+            const detail::pool::current_worker& cw = detail::pool::current();
+            if (cw.pool == this)
+            {
+                if (!worker_(cw.index).queue.try_push(detail::pool::job{j}))
+                {
+                    queued_.fetch_sub(1, std::memory_order_relaxed);
+                    run_(cw.index, j, false); // Nested, keep the arena.
+                    return;
+                }
+            }
+            else
+            {
+                const usize start = next_.fetch_add(1, std::memory_order_relaxed) % worker_count_;
+                bool pushed       = false;
+                for (usize i = 0; i < worker_count_ && !pushed; ++i)
+                {
+                    const usize index = (start + i) % worker_count_;
+                    pushed            = worker_(index).queue.try_push(detail::pool::job{j});
+                }
+                if (!pushed)
+                {
+                    worker_(start).queue.push(detail::pool::job{j});
+                }
+            }
+
+            work_available_.notify();
+        }
+
+        bool try_take_(const usize index, detail::pool::job& j) noexcept
+        {
+            if (auto opt = worker_(index).queue.try_pop())
+            {
+                j = opt.value(assume::has_value);
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            for (usize i = 1; i < worker_count_; ++i)
+            {
+                if (auto opt = worker_((index + i) % worker_count_).queue.try_pop())
+                {
+                    j = opt.value(assume::has_value);
+                    queued_.fetch_sub(1, std::memory_order_relaxed);
+                    detail::pool::worker& w = worker_(index);
+                    w.steal_count.store(w.steal_count.load(std::memory_order_relaxed) + 1,
+                                        std::memory_order_relaxed);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void run_(const usize index, const detail::pool::job j, const bool reset_arena) noexcept
+        {
+            detail::pool::worker& w = worker_(index);
+            task_context ctx{index, w.arena};
+
+            const i64 ns = j.run(j.state, ctx).to_nanoseconds<i64>(assume::not_negative);
+
+            w.task_count.store(w.task_count.load(std::memory_order_relaxed) + 1,
+                               std::memory_order_relaxed);
+            w.busy_nanoseconds.store(w.busy_nanoseconds.load(std::memory_order_relaxed) + ns,
+                                     std::memory_order_relaxed);
+            if (ns > w.max_nanoseconds.load(std::memory_order_relaxed))
+            {
+                w.max_nanoseconds.store(ns, std::memory_order_relaxed);
+            }
+
+            if (reset_arena)
+            {
+                w.arena.reset();
+            }
+        }
+
+        void work_(const usize index) noexcept
+        {
+            if (pin_to_cpus_)
+            {
+                detail::pool::pin_to_cpu(index % cpu_count());
+            }
+
+            detail::pool::current() = detail::pool::current_worker{this, index};
+            mem::arena_scope scope{worker_(index).arena};
+
+            detail::pool::job j{};
+            while (true)
+            {
+                if (try_take_(index, j))
+                {
+                    run_(index, j, true);
+                }
+                else if (stopping_.load(std::memory_order_acquire) &&
+                         queued_.load(std::memory_order_acquire) == 0)
+                {
+                    break;
+                }
+                else
+                {
+                    work_available_.wait([this] {
+                        return queued_.load(std::memory_order_acquire) != 0 ||
+                               stopping_.load(std::memory_order_acquire);
+                    });
+                }
+            }
+
+            detail::pool::current() = detail::pool::current_worker{nullptr, 0};
+        }
+
+        void stop_and_join_(const usize constructed_count) noexcept
+        {
+            stopping_.store(true, std::memory_order_release);
+            work_available_.notify();
+            for (usize i = 0; i < constructed_count; ++i)
+            {
+                // Not joinable if starting the thread failed.
+                if (worker_(i).thread.joinable())
+                {
+                    worker_(i).thread.join();
+                }
+            }
+        }
+
+        void destroy_workers_(const usize count) noexcept
+        {
+            for (usize i = 0; i < count; ++i)
+            {
+                mem::destruct(not_null{&worker_(i)});
+            }
+            alloc_.deallocate(workers_, worker_count_);
+        }
+    };
+}
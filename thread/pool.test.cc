@@ -0,0 +1,174 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/thread/pool.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/mem/arena_allocator.hh"
+#include "snn-core/time/unit.hh"
+#include <atomic> // atomic
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            thread::pool pool{not_zero<usize>{4}};
+            snn_require(pool.worker_count() == 4);
+
+            thread::task<usize> t = pool.submit([] { return usize{123}; });
+            snn_require(t.get().value() == 123);
+
+            // A task can return a `result<T>`.
+            thread::task<int> failing = pool.submit([]() -> result<int> {
+                return generic::error::invalid_value;
+            });
+            snn_require(failing.get().error_code() == generic::error::invalid_value);
+
+            // A task invocable with a `task_context&` gets the worker index and a scratch arena
+            // (reset after the task). The arena is also the current arena of the worker thread.
+            thread::task<usize> sum = pool.submit([](thread::task_context& ctx) {
+                vec<usize, 0, mem::arena_allocator<usize>> scratch;
+                for (usize i = 1; i <= 100; ++i)
+                {
+                    scratch.append(i);
+                }
+                snn_require(mem::arena::current() == &ctx.arena());
+                snn_require(ctx.worker_index() < 4);
+
+                usize total = 0;
+                for (const usize i : scratch)
+                {
+                    total += i;
+                }
+                return total;
+            });
+            snn_require(sum.get().value() == 5050);
+
+            // Timing.
+            snn_require(sum.is_done());
+            snn_require(sum.run_duration() >= time::duration{});
+            snn_require(sum.queue_duration() >= time::duration{});
+
+            return true;
+        }
+
+        bool test_pool()
+        {
+            {
+                // Void tasks, exceptions and handles.
+                thread::pool pool{not_zero<usize>{2}};
+
+                std::atomic<usize> counter{0};
+                thread::task<void> t = pool.submit([&counter] { ++counter; });
+                snn_require(t);
+                snn_require(t.get());
+                snn_require(counter.load() == 1);
+                snn_require(t.get().error_code() == thread::error::no_task_result); // Taken.
+
+                thread::task<int> thrower = pool.submit([]() -> int {
+                    throw_or_abort(generic::error::insufficient_capacity);
+                });
+                snn_require(thrower.get().error_code() == generic::error::insufficient_capacity);
+
+                thread::task<int> other = pool.submit([]() -> int { throw 123; });
+                snn_require(other.get().error_code() ==
+                            thread::error::unhandled_exception_in_task);
+
+                thread::task<int> empty;
+                snn_require(!empty);
+                snn_require(!empty.is_done());
+                snn_require(!empty.wait(time::milliseconds{1}.duration().value()));
+                snn_require(empty.get().error_code() == thread::error::no_task_result);
+
+                // Move.
+                thread::task<str> a = pool.submit([] { return str{"abc"}; });
+                thread::task<str> b = std::move(a);
+                snn_require(!a);
+                snn_require(b.get().value() == "abc");
+
+                // Dropped handle, the task still runs.
+                {
+                    thread::task<void> dropped = pool.submit([&counter] { ++counter; });
+                }
+
+                // Timed wait.
+                std::atomic<u32> gate{0};
+                thread::task<void> blocked = pool.submit([&gate] {
+                    while (gate.load() == 0)
+                    {
+                        thread::futex::wait(gate, 0);
+                    }
+                });
+                snn_require(!blocked.wait(time::milliseconds{2}.duration().value()));
+                snn_require(!blocked.is_done());
+                gate.store(1);
+                thread::futex::wake_all(gate);
+                snn_require(blocked.wait(time::seconds{10}.duration().value()));
+                snn_require(blocked.is_done());
+            }
+            {
+                // Many tasks, small queues (submit blocks while all queues are full), nested
+                // submits and stealing.
+                std::atomic<usize> counter{0};
+                {
+                    thread::pool pool{not_zero<usize>{4}, thread::pool_options{
+                                                              .pin_to_cpus      = true,
+                                                              .queue_capacity   = 8,
+                                                              .arena_block_size = 4096,
+                                                          }};
+
+                    vec<thread::task<usize>> tasks;
+                    for (usize i = 0; i < 1000; ++i)
+                    {
+                        tasks.append(pool.submit([&pool, &counter, i] {
+                            if (i % 10 == 0)
+                            {
+                                // Nested (not waited on).
+                                static_cast<void>(pool.submit([&counter] { ++counter; }));
+                            }
+                            ++counter;
+                            return i * 2;
+                        }));
+                    }
+
+                    for (usize i = 0; i < tasks.count(); ++i)
+                    {
+                        snn_require(tasks.at(i).value().get().value() == i * 2);
+                    }
+
+                    // The destructor runs all queued tasks.
+                    for (usize i = 0; i < 100; ++i)
+                    {
+                        static_cast<void>(pool.submit([&counter] { ++counter; }));
+                    }
+
+                    usize task_count = 0;
+                    for (usize i = 0; i < pool.worker_count(); ++i)
+                    {
+                        const thread::worker_stats stats = pool.stats(i);
+                        task_count += stats.task_count;
+                        snn_require(stats.max_task <= stats.busy);
+                    }
+                    snn_require(task_count <= 1200);
+                }
+                snn_require(counter.load() == 1200);
+            }
+            {
+                snn_require(thread::pool::cpu_count() >= 1);
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_pool());
+    }
+}
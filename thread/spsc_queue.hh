@@ -0,0 +1,335 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+// # Bounded single-producer/single-consumer queue (lock-free)
+
+// * A ring buffer with a power of two capacity (rounded up), allocated once.
+// * One thread may push and one (other) thread may pop at the same time.
+// * The producer and consumer indices are on separate cache lines, each side keeps a cached copy
+//   of the other side's index and only reloads it when the queue looks full/empty.
+// * Batch push/pop (`try_push_n(...)`/`try_pop_n(...)`) publish a whole batch with a single
+//   store. Batch pop relocates values (`memcpy` for trivially relocatable types).
+// * Blocking `push(...)`/`pop()` (with optional timeouts) wait on a futex, see
+//   [futex.hh](futex.hh). A non-blocking operation never makes a system call unless the other
+//   side is blocked.
+
+#pragma once
+
+#include "snn-core/array_view.hh"
+#include "snn-core/exception.hh"
+#include "snn-core/optional.hh"
+#include "snn-core/vec.hh"
+#include "snn-core/detail/queue/signal.hh"
+#include "snn-core/generic/error.hh"
+#include "snn-core/math/common.hh"
+#include "snn-core/mem/allocator.hh"
+#include "snn-core/mem/construct.hh"
+#include "snn-core/mem/destruct.hh"
+#include "snn-core/time/duration.hh"
+#include <atomic> // atomic, memory_order
+#include <bit>    // bit_ceil
+
+namespace snn::thread
+{
+    // ## Classes
+
+    // ### spsc_queue
+
+    template <typename T, typename Alloc = mem::allocator<T>>
+    class spsc_queue final
+    {
+      public:
+        // #### Types
+
+        using value_type     = T;
+        using allocator_type = Alloc;
+
+        // #### Constants
+
+        static constexpr usize max_capacity = usize{1} << (sizeof(usize) * 8 - 2);
+
+        // #### Explicit constructors
+
+        // The capacity is rounded up to a power of two.
+        explicit spsc_queue(const not_zero<usize> capacity, const Alloc& alloc = Alloc{})
+            : alloc_{alloc}
+        {
+            if (capacity.get() > max_capacity)
+            {
+                throw_or_abort(generic::error::invalid_value);
+            }
+            const usize cap = std::bit_ceil(capacity.get());
+            slots_          = alloc_.allocate(not_zero{cap}).value();
+            mask_           = cap - 1;
+        }
+
+        // #### Non-copyable/non-movable
+
+        spsc_queue(const spsc_queue&)            = delete;
+        spsc_queue& operator=(const spsc_queue&) = delete;
+
+        spsc_queue(spsc_queue&&)            = delete;
+        spsc_queue& operator=(spsc_queue&&) = delete;
+
+        // #### Destructor
+
+        ~spsc_queue()
+        {
+            const usize tail = tail_.load(std::memory_order_relaxed);
+            for (usize pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos)
+            {
+                mem::destruct(not_null{slot_(pos)});
+            }
+            alloc_.deallocate(slots_, mask_ + 1);
+        }
+
+        // #### Capacity
+
+        [[nodiscard]] usize capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+        // #### Push (producer)
+
+        // Returns `false` if the queue is full (nothing is constructed, nothing is moved).
+        template <typename... Args>
+        bool try_push_inplace(Args&&... args)
+        {
+            const usize tail = tail_.load(std::memory_order_relaxed);
+            if (!has_space_(tail, 1))
+            {
+                return false;
+            }
+            mem::construct(not_null{slot_(tail)}, std::forward<Args>(args)...);
+            tail_.store(tail + 1, std::memory_order_release);
+            not_empty_.notify();
+            return true;
+        }
+
+        // Returns `false` if the queue is full (`value` is only moved on success).
+        bool try_push(T&& value)
+        {
+            return try_push_inplace(std::move(value));
+        }
+
+        // Moves as many values as there is space for (from the front), returns the number of
+        // values moved.
+        usize try_push_n(array_view<T> values)
+        {
+            const usize tail  = tail_.load(std::memory_order_relaxed);
+            const usize count = free_count_(tail, values.count());
+            if (count > 0)
+            {
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+                T* const src = values.begin();
+                usize i      = 0;
+                try
+                {
+                    for (; i < count; ++i)
+                    {
+                        mem::construct(not_null{slot_(tail + i)}, std::move(src[i]));
+                    }
+                }
+                catch (...)
+                {
+                    // Publish what has been constructed.
+                    tail_.store(tail + i, std::memory_order_release);
+                    not_empty_.notify();
+                    throw;
+                }
+
+                SNN_DIAGNOSTIC_POP
+
+                tail_.store(tail + count, std::memory_order_release);
+                not_empty_.notify();
+            }
+            return count;
+        }
+
+        // Blocks while the queue is full.
+        void push(T&& value)
+        {
+            detail::queue::retry(
+                not_full_, [&] { return try_push_inplace(std::move(value)); },
+                [&] { return is_ready_to_push_(); });
+        }
+
+        // Returns `false` if `timeout` expired (`value` is only moved on success).
+        bool push(T&& value, const time::duration timeout)
+        {
+            return detail::queue::retry(
+                not_full_, [&] { return try_push_inplace(std::move(value)); },
+                [&] { return is_ready_to_push_(); }, timeout);
+        }
+
+        // Blocks until all values have been moved.
+        void push_n(array_view<T> values)
+        {
+            detail::queue::retry(
+                not_full_,
+                [&] {
+                    values.drop_front_n(try_push_n(values));
+                    return values.is_empty();
+                },
+                [&] { return is_ready_to_push_(); });
+        }
+
+        // #### Pop (consumer)
+
+        [[nodiscard]] optional<T> try_pop()
+        {
+            const usize head = head_.load(std::memory_order_relaxed);
+            if (available_count_(head, 1) == 0)
+            {
+                return nullopt;
+            }
+            T* const slot = slot_(head);
+            optional<T> value{std::move(*slot)};
+            mem::destruct(not_null{slot});
+            head_.store(head + 1, std::memory_order_release);
+            not_full_.notify();
+            return value;
+        }
+
+        // Appends at most `max_count` values to `out`, returns the number of values appended.
+        usize try_pop_n(vec<T>& out, const usize max_count)
+        {
+            const usize head  = head_.load(std::memory_order_relaxed);
+            const usize count = available_count_(head, max_count);
+            if (count > 0)
+            {
+                out.reserve_append(count);
+
+                SNN_DIAGNOSTIC_PUSH
+                SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+
+                // At most two runs (the values can wrap around).
+                T* const first          = slot_(head);
+                const usize first_count = math::min(count, capacity() - (head & mask_));
+                out.append_relocate(not_null{first}, not_null{first + first_count});
+                if (first_count < count)
+                {
+                    out.append_relocate(not_null{slots_}, not_null{slots_ + (count - first_count)});
+                }
+
+                SNN_DIAGNOSTIC_POP
+
+                head_.store(head + count, std::memory_order_release);
+                not_full_.notify();
+            }
+            return count;
+        }
+
+        // Blocks while the queue is empty.
+        [[nodiscard]] T pop()
+        {
+            optional<T> value{nullopt};
+            detail::queue::retry(
+                not_empty_,
+                [&] {
+                    value = try_pop();
+                    return value.has_value();
+                },
+                [&] { return is_ready_to_pop_(); });
+            return std::move(value.value(assume::has_value));
+        }
+
+        // Returns an empty optional if `timeout` expired.
+        [[nodiscard]] optional<T> pop(const time::duration timeout)
+        {
+            optional<T> value{nullopt};
+            detail::queue::retry(
+                not_empty_,
+                [&] {
+                    value = try_pop();
+                    return value.has_value();
+                },
+                [&] { return is_ready_to_pop_(); }, timeout);
+            return value;
+        }
+
+        // Blocks while the queue is empty, then appends at most `max_count` values to `out`.
+        usize pop_n(vec<T>& out, const usize max_count)
+        {
+            usize count = 0;
+            detail::queue::retry(
+                not_empty_,
+                [&] {
+                    count = try_pop_n(out, max_count);
+                    return count > 0 || max_count == 0;
+                },
+                [&] { return is_ready_to_pop_(); });
+            return count;
+        }
+
+      private:
+        // Read-only after construction.
+        alignas(detail::queue::cache_line_size) T* slots_{nullptr};
+        usize mask_{0};
+        [[no_unique_address]] Alloc alloc_;
+
+        // Consumer.
+        alignas(detail::queue::cache_line_size) std::atomic<usize> head_{0};
+        usize cached_tail_{0};
+
+        // Producer.
+        alignas(detail::queue::cache_line_size) std::atomic<usize> tail_{0};
+        usize cached_head_{0};
+
+        alignas(detail::queue::cache_line_size) detail::queue::signal not_empty_;
+        alignas(detail::queue::cache_line_size) detail::queue::signal not_full_;
+
+        T* slot_(const usize pos) const noexcept
+        {
+            SNN_DIAGNOSTIC_PUSH
+            SNN_DIAGNOSTIC_IGNORE_UNSAFE_BUFFER_USAGE
+            T* const slot = slots_ + (pos & mask_);
+            SNN_DIAGNOSTIC_POP
+            return slot;
+        }
+
+        // Producer only.
+        bool has_space_(const usize tail, const usize wanted) noexcept
+        {
+            return free_count_(tail, wanted) == wanted;
+        }
+
+        // Producer only.
+        usize free_count_(const usize tail, const usize wanted) noexcept
+        {
+            usize free = capacity() - (tail - cached_head_);
+            if (free < wanted)
+            {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                free         = capacity() - (tail - cached_head_);
+            }
+            return math::min(free, wanted);
+        }
+
+        // Consumer only.
+        usize available_count_(const usize head, const usize wanted) noexcept
+        {
+            usize available = cached_tail_ - head;
+            if (available < wanted)
+            {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                available    = cached_tail_ - head;
+            }
+            return math::min(available, wanted);
+        }
+
+        bool is_ready_to_push_() const noexcept
+        {
+            return (tail_.load(std::memory_order_relaxed) -
+                    head_.load(std::memory_order_acquire)) < capacity();
+        }
+
+        bool is_ready_to_pop_() const noexcept
+        {
+            return tail_.load(std::memory_order_acquire) != head_.load(std::memory_order_relaxed);
+        }
+    };
+}
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Mikael Simonsson <https://mikaelsimonsson.com>.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "snn-core/thread/spsc_queue.hh"
+
+#include "snn-core/unittest.hh"
+#include "snn-core/time/unit.hh"
+#include <thread> // thread
+
+namespace snn::app
+{
+    namespace
+    {
+        bool example()
+        {
+            thread::spsc_queue<str> q{not_zero<usize>{3}};
+            snn_require(q.capacity() == 4); // Rounded up to a power of two.
+
+            std::thread producer{[&q] {
+                for (usize i = 0; i < 1000; ++i)
+                {
+                    q.push(str{"record"}); // Blocks while the queue is full.
+                }
+                q.push(str{}); // End marker.
+            }};
+
+            usize count = 0;
+            while (true)
+            {
+                const str s = q.pop(); // Blocks while the queue is empty.
+                if (s.is_empty())
+                {
+                    break;
+                }
+                snn_require(s == "record");
+                ++count;
+            }
+            snn_require(count == 1000);
+
+            producer.join();
+
+            return true;
+        }
+
+        bool test_spsc_queue()
+        {
+            {
+                thread::spsc_queue<str> q{not_zero<usize>{2}};
+                snn_require(q.capacity() == 2);
+                snn_require(!q.try_pop());
+
+                str a{"A string that is too long for the short string optimization."};
+                snn_require(q.try_push(std::move(a)));
+                snn_require(a.is_empty()); // Moved.
+
+                str b{"b"};
+                snn_require(q.try_push_inplace(b));
+                snn_require(b == "b"); // Copied.
+
+                str c{"Another string that is too long for the short string optimization."};
+                snn_require(!q.try_push(std::move(c))); // Full.
+                snn_require(c.size() > 60);             // Not moved.
+
+                snn_require(q.try_pop().value() ==
+                            "A string that is too long for the short string optimization.");
+                snn_require(q.try_push(std::move(c)));
+                snn_require(q.try_pop().value() == "b");
+                snn_require(q.try_pop().value().size() > 60);
+                snn_require(!q.try_pop());
+
+                // Destructor drops remaining values.
+                snn_require(q.try_push(str{"Yet another string that is not stored inline."}));
+            }
+            {
+                // Batch.
+                thread::spsc_queue<usize> q{not_zero<usize>{8}};
+
+                vec<usize> values;
+                for (usize i = 0; i < 10; ++i)
+                {
+                    values.append(i);
+                }
+                snn_require(q.try_push_n(values.view()) == 8);
+
+                vec<usize> out;
+                snn_require(q.try_pop_n(out, 3) == 3);
+                snn_require(out.count() == 3);
+                snn_require(out.at(2).value() == 2);
+
+                snn_require(q.try_push_n(values.view(8)) == 2);
+                snn_require(q.try_pop_n(out, 100) == 7);
+                snn_require(out.count() == 10);
+                for (usize i = 0; i < 10; ++i)
+                {
+                    snn_require(out.at(i).value() == i);
+                }
+                snn_require(q.try_pop_n(out, 100) == 0);
+            }
+            {
+                // Timeouts.
+                thread::spsc_queue<int> q{not_zero<usize>{1}};
+                const time::duration timeout = time::milliseconds{2}.duration().value();
+
+                snn_require(!q.pop(timeout));
+                snn_require(q.push(123, timeout));
+                snn_require(!q.push(456, timeout)); // Full.
+                snn_require(q.pop(timeout).value() == 123);
+            }
+            {
+                // Wrap around many times with blocking batch push/pop.
+                constexpr usize total = 100'000;
+
+                thread::spsc_queue<usize> q{not_zero<usize>{64}};
+
+                std::thread producer{[&q] {
+                    vec<usize> batch;
+                    for (usize i = 0; i < total;)
+                    {
+                        batch.clear();
+                        for (usize j = 0; j < 37 && i < total; ++j, ++i)
+                        {
+                            batch.append(i);
+                        }
+                        q.push_n(batch.view());
+                    }
+                }};
+
+                vec<usize> out{init::reserve, total};
+                while (out.count() < total)
+                {
+                    snn_require(q.pop_n(out, 50) > 0);
+                }
+                producer.join();
+
+                for (usize i = 0; i < total; ++i)
+                {
+                    snn_require(out.at(i).value() == i);
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+namespace snn
+{
+    void unittest()
+    {
+        snn_require(app::example());
+        snn_require(app::test_spsc_queue());
+    }
+}
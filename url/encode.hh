@@ -11,7 +11,7 @@
 
 #include "snn-core/array.hh"
 #include "snn-core/strcore.hh"
-#include "snn-core/chr/fn/lookup.hh"
+#include "snn-core/chr/detail/simd.hh"
 #include "snn-core/hex/table/common.hh"
 #include "snn-core/range/contiguous.hh"
 
@@ -36,27 +36,26 @@ namespace snn::url
             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         };
 
+        inline constexpr chr::detail::simd::lookup encode_unreserved{encode_unreserved_lookup};
+
         template <typename Buf>
         constexpr void encode(const cstrview s, const array<char, 16>& hex_table,
                               strcore<Buf>& append_to)
         {
             append_to.reserve_append(s.size()); // Reserve minimal size.
 
-            constexpr auto is_unreserved = chr::fn::lookup{detail::encode_unreserved_lookup};
-
             auto rng = s.range();
             while (rng)
             {
-                const auto unreserved_rng = rng.pop_front_while(is_unreserved);
-                if (unreserved_rng)
+                const cstrview unreserved_view = detail::encode_unreserved.pop_front_while(rng);
+                if (unreserved_view)
                 {
-                    append_to.append(unreserved_rng.view());
+                    append_to.append(unreserved_view);
                 }
 
                 if (rng)
                 {
                     const char c = rng.pop_front(assume::not_empty);
-                    snn_should(!is_unreserved(c));
 
                     const auto b = to_byte(c);
 
@@ -107,6 +107,28 @@ namespace snn::app
 
             return true;
         }
+
+        bool test_encode_simd()
+        {
+            // Every character at every position.
+            for (usize size = 1; size < 80; ++size)
+            {
+                for (usize pos = 0; pos < size; ++pos)
+                {
+                    const str prefix{init::fill, pos, 'a'};
+                    const str suffix{init::fill, size - pos - 1, 'a'};
+
+                    for (const auto b : range::integral<byte>{})
+                    {
+                        const char c = to_char(b);
+                        const str s  = concat(prefix, c, suffix);
+                        snn_require(url::encode(s) ==
+                                    concat(prefix, url::encode(cstrview{as_ref(c)}), suffix));
+                    }
+                }
+            }
+            return true;
+        }
     }
 }
 
@@ -116,5 +138,6 @@ namespace snn
     {
         snn_static_require(app::example());
         snn_static_require(app::test_encode());
+        snn_require(app::test_encode_simd());
     }
 }
@@ -5,6 +5,8 @@
 
 // * Optional small-capacity (on stack).
 // * Trivially-relocatable optimization.
+// * Optional allocator with state, e.g. `mem::resource_allocator<T, mem::arena>` to allocate from
+//   an arena owned by the caller.
 
 #pragma once
 
@@ -18,6 +20,7 @@
 #include "snn-core/mem/construct.hh"
 #include "snn-core/mem/destruct.hh"
 #include "snn-core/mem/destruct_n.hh"
+#include "snn-core/mem/relocate.hh"
 #include "snn-core/mem/relocate_left.hh"
 #include "snn-core/mem/relocate_right.hh"
 #include "snn-core/range/contiguous.hh"
@@ -28,17 +31,18 @@ namespace snn
 
     // ### vec
 
-    template <typename T, usize SmallCapacity = 0>
+    template <typename T, usize SmallCapacity = 0, typename Alloc = mem::allocator<T>>
         requires(std::is_move_constructible_v<T> && std::is_same_v<std::remove_cvref_t<T>, T>)
-    class vec final : public contiguous_interface<vec<T, SmallCapacity>>
+    class vec final : public contiguous_interface<vec<T, SmallCapacity, Alloc>>
     {
       private:
-        using buffer_type = detail::vec::buffer<T, SmallCapacity>;
+        using buffer_type = detail::vec::buffer<T, SmallCapacity, Alloc>;
 
       public:
         // #### Types
 
-        using value_type = T;
+        using value_type     = T;
+        using allocator_type = Alloc;
 
         using iterator       = T*;
         using const_iterator = const T*;
@@ -63,6 +67,17 @@ namespace snn
             reserve(capacity);
         }
 
+        constexpr explicit vec(const Alloc& alloc) noexcept
+            : buf_{alloc}
+        {
+        }
+
+        constexpr explicit vec(init::reserve_t, const usize capacity, const Alloc& alloc)
+            : vec{alloc}
+        {
+            reserve(capacity);
+        }
+
         constexpr explicit vec(init::from_t, const const_iterator first, const const_iterator last)
             : vec{}
         {
@@ -94,8 +109,11 @@ namespace snn
 
         // #### Copy/move-assignment/constructor
 
+        // A copy uses a copy of the allocator (e.g. the same resource), copy assignment keeps the
+        // current allocator, move and swap exchange allocators along with the memory.
+
         constexpr vec(const vec& other)
-            : vec{}
+            : vec{other.buf_.allocator()}
         {
             append(other);
         }
@@ -132,6 +150,13 @@ namespace snn
             return !is_empty();
         }
 
+        // #### Allocator
+
+        [[nodiscard]] constexpr const Alloc& allocator() const noexcept
+        {
+            return buf_.allocator();
+        }
+
         // #### Iterators
 
         [[nodiscard]] constexpr iterator begin() noexcept
@@ -309,6 +334,18 @@ namespace snn
             }
         }
 
+        // #### Append relocated
+
+        // Relocates `[first, last)` to the end (with `memcpy` if `T` is trivially relocatable),
+        // the values are destroyed. The range must not be part of this vec.
+        constexpr void append_relocate(const not_null<T*> first, const not_null<T*> last)
+        {
+            const auto count = static_cast<usize>(last.get() - first.get());
+            reserve_append(count);
+            mem::relocate(first, last, not_null{buf_.end()});
+            buf_.set_count(buf_.count() + count, assume::has_capacity);
+        }
+
         // #### Append another vec
 
         constexpr void append(const same_as<vec> auto& other)
@@ -589,8 +626,8 @@ namespace snn
 
     // ### swap
 
-    template <typename T, usize SmallCapacity>
-    constexpr void swap(vec<T, SmallCapacity>& a, vec<T, SmallCapacity>& b) noexcept
+    template <typename T, usize SmallCapacity, typename Alloc>
+    constexpr void swap(vec<T, SmallCapacity, Alloc>& a, vec<T, SmallCapacity, Alloc>& b) noexcept
     {
         a.swap(b);
     }
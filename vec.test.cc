@@ -1299,6 +1299,24 @@ namespace snn::app
                 }
             }
 
+            // append_relocate
+            {
+                mem::allocator<str> alloc;
+                str* const first = alloc.allocate(not_zero<usize>{2}).value();
+                str* const last  = first + 2;
+                mem::construct(not_null{first}, "A long string, which goes on the heap.");
+                mem::construct(not_null{first + 1}, "Short");
+
+                vec<str, SmallCapacity> v{"One"};
+                v.append_relocate(not_null{first}, not_null{last});
+                alloc.deallocate(first, 2); // The strings have been relocated.
+
+                snn_require(count_eq(v, 3));
+                snn_require(v.at(0).value() == "One");
+                snn_require(v.at(1).value() == "A long string, which goes on the heap.");
+                snn_require(v.at(2).value() == "Short");
+            }
+
             return true;
         }
     }